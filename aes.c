@@ -120,6 +120,20 @@ int aes_instruction(struct pt_regs *regs,
 }
 
 // ==================================================================================== //
+/** VAES: the 128-bit round on each lane of a ymm, each lane with its own round key. **/
+static void vaes_lanes(void (*round)(XMM, XMM, XMM *), YMM key, YMM data, YMM *res)
+{
+    XMM k, d, r;
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        k.u128 = key.u128[i];
+        d.u128 = data.u128[i];
+        round(k, d, &r);
+        res->u128[i] = r.u128;
+    }
+}
+
 int vaes_instruction(struct pt_regs *regs,
                        uint8_t vexreg,
                        uint8_t opcode,
@@ -151,7 +165,10 @@ int vaes_instruction(struct pt_regs *regs,
     
     uint16_t rm_size = reg_size;
     
-    get_vexregs(modrm, high_reg, high_index, high_base, &xmmsrc, &xmmvsrc, &xmmdst, vexreg, regs, reg_size, rm_size, modbyte, &rmaddrs);
+    if (reg_size == 256)
+        get_vexregs(modrm, high_reg, high_index, high_base, &ymmsrc, &ymmvsrc, &ymmdst, vexreg, regs, reg_size, rm_size, modbyte, &rmaddrs);
+    else
+        get_vexregs(modrm, high_reg, high_index, high_base, &xmmsrc, &xmmvsrc, &xmmdst, vexreg, regs, reg_size, rm_size, modbyte, &rmaddrs);
     
     int consumed = get_consumed(modrm);
     imm = *((uint8_t*)&bytep[consumed]);
@@ -159,6 +176,7 @@ int vaes_instruction(struct pt_regs *regs,
     
     switch(opcode) {
         case 0xDB: //vaesimc
+            if (reg_size == 256) return 0;
             if (simd_prefix == 1) { //66
                 if (leading_opcode == 2) {//0F38
                     aesimc(xmmsrc, &xmmres);
@@ -172,8 +190,13 @@ int vaes_instruction(struct pt_regs *regs,
                 if (leading_opcode == 2) {//0F38
                     //round key (key) = mod.r/m (src)
                     //regs (data) = mod.reg (dst) / vex.v (vsrc)
-                    aesenc(xmmsrc, xmmvsrc, &xmmres);
-                    _load_xmm(num_dst, &xmmres);
+                    if (reg_size == 256) {
+                        vaes_lanes(aesenc, ymmsrc, ymmvsrc, &ymmres);
+                        _load_ymm(num_dst, &ymmres);
+                    } else {
+                        aesenc(xmmsrc, xmmvsrc, &xmmres);
+                        _load_xmm(num_dst, &xmmres);
+                    }
                 }
             }
             break;
@@ -183,8 +206,13 @@ int vaes_instruction(struct pt_regs *regs,
                 if (leading_opcode == 2) {//0F38
                     //round key (key) = mod.r/m (src)
                     //regs (data) = mod.reg (dst) / vex.v (vsrc)
-                    aesenclast(xmmsrc, xmmvsrc, &xmmres);
-                    _load_xmm(num_dst, &xmmres);
+                    if (reg_size == 256) {
+                        vaes_lanes(aesenclast, ymmsrc, ymmvsrc, &ymmres);
+                        _load_ymm(num_dst, &ymmres);
+                    } else {
+                        aesenclast(xmmsrc, xmmvsrc, &xmmres);
+                        _load_xmm(num_dst, &xmmres);
+                    }
                 }
             }
             break;
@@ -194,8 +222,13 @@ int vaes_instruction(struct pt_regs *regs,
                 if (leading_opcode == 2) {//0F38
                     //round key (key) = mod.r/m (src)
                     //regs (data) = mod.reg (dst) / vex.v (vsrc)
-                    aesdec(xmmsrc, xmmvsrc, &xmmres);
-                    _load_xmm(num_dst, &xmmres);
+                    if (reg_size == 256) {
+                        vaes_lanes(aesdec, ymmsrc, ymmvsrc, &ymmres);
+                        _load_ymm(num_dst, &ymmres);
+                    } else {
+                        aesdec(xmmsrc, xmmvsrc, &xmmres);
+                        _load_xmm(num_dst, &xmmres);
+                    }
                 }
             }
             break;
@@ -205,10 +238,16 @@ int vaes_instruction(struct pt_regs *regs,
                 if (leading_opcode == 2) {//0F38
                     //round key (key) = mod.r/m (src)
                     //regs (data) = mod.reg (dst) / vex.v (vsrc)
-                    aesdeclast(xmmsrc, xmmvsrc, &xmmres);
-                    _load_xmm(num_dst, &xmmres);
+                    if (reg_size == 256) {
+                        vaes_lanes(aesdeclast, ymmsrc, ymmvsrc, &ymmres);
+                        _load_ymm(num_dst, &ymmres);
+                    } else {
+                        aesdeclast(xmmsrc, xmmvsrc, &xmmres);
+                        _load_xmm(num_dst, &xmmres);
+                    }
                 }
                 if (leading_opcode == 3) {//0F3A
+                    if (reg_size == 256) return 0;
                     aeskeygenassist(xmmsrc, &xmmres, imm);
                     _load_xmm(num_dst, &xmmres);
                     ins_size++;
@@ -227,9 +266,6 @@ int vaes_instruction(struct pt_regs *regs,
                         _load_xmm(num_dst, &xmmres);
                         ins_size++;
                     } else {
-                        uint16_t rm_size = reg_size;
-                        get_vexregs(modrm, high_reg, high_index, high_base, &ymmsrc, &ymmvsrc, &ymmdst, vexreg, regs, reg_size, rm_size, modbyte, &rmaddrs);
-
                         //SRC1 = mod.reg (dst) / vex.v (vsrc)
                         //SRC2 = mod.r/m (src)
                         pclmulqdq_256(ymmsrc, ymmvsrc, &ymmres, imm);
@@ -247,14 +283,23 @@ int vaes_instruction(struct pt_regs *regs,
 }
 
 // ==================================================================================== //
+//64 x 64 -> 128 bit carry-less multiply, 4 bits of b per step
 __uint128_t cl_mul(__uint128_t a, __uint128_t b) {
+    __uint128_t T[16];
     __uint128_t r = 0;
-    while (b != 0)
-    {
-        if ((b & 1) != 0)
-            r ^= a;
-        a <<= 1;
-        b >>= 1;
+    uint64_t B = (uint64_t)b;
+    int i;
+
+    a = (uint64_t)a;
+    T[0] = 0;
+    T[1] = a;
+    for (i = 2; i < 16; i += 2) {
+        T[i] = T[i >> 1] << 1;
+        T[i + 1] = T[i] ^ a;
     }
+
+    for (i = 60; i >= 0; i -= 4)
+        r = (r << 4) ^ T[(B >> i) & 0xF];
+
     return r;
 }
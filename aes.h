@@ -57,55 +57,37 @@ static inline void aesimc(XMM src, XMM *res) {
 //round key (key) = mod.r/m (src)
 //state (data) = mod.reg (dst) / vex.v (vsrc)
 static inline void aesenc(XMM key, XMM data, XMM *res) {
-    XMM STATE, RoundKey;
-    STATE = data;
-    RoundKey = key;
-    
-    ShiftRows(&STATE);
-    SubBytes(&STATE);
-    MixColumns(&STATE);
-    
-    res->u128 = STATE.u128 ^ RoundKey.u128;
+    XMM STATE = data;
+
+    AESEncRound(&STATE, key);
+    res->u128 = STATE.u128;
 }
 
 //round key (key) = mod.r/m (src)
 //state (data) = mod.reg (dst) / vex.v (vsrc)
 static inline void aesenclast(XMM key, XMM data, XMM *res) {
-    XMM STATE, RoundKey;
-    STATE = data;
-    RoundKey = key;
-    
-    ShiftRows(&STATE);
-    SubBytes(&STATE);
-    
-    res->u128 = STATE.u128 ^ RoundKey.u128;
+    XMM STATE = data;
+
+    AESEncLastRound(&STATE, key);
+    res->u128 = STATE.u128;
 }
 
 //round key (key) = mod.r/m (src)
 //state (data) = mod.reg (dst) / vex.v (vsrc)
 static inline void aesdec(XMM key, XMM data, XMM *res) {
-    XMM STATE, RoundKey;
-    STATE = data;
-    RoundKey = key;
-    
-    InvShiftRows(&STATE);
-    InvSubBytes(&STATE);
-    InvMixColumns(&STATE);
-    
-    res->u128 = STATE.u128 ^ RoundKey.u128;
+    XMM STATE = data;
+
+    AESDecRound(&STATE, key);
+    res->u128 = STATE.u128;
 }
 
 //round key (key) = mod.r/m (src)
 //state (data) = mod.reg (dst) / vex.v (vsrc)
 static inline void aesdeclast(XMM key, XMM data, XMM *res) {
-    XMM STATE, RoundKey;
-    STATE = data;
-    RoundKey = key;
-    
-    InvShiftRows(&STATE);
-    InvSubBytes(&STATE);
-    
-    res->u128 = STATE.u128 ^ RoundKey.u128;
+    XMM STATE = data;
+
+    AESDecLastRound(&STATE, key);
+    res->u128 = STATE.u128;
 }
 
 static inline void aeskeygenassist(XMM src, XMM *res, uint8_t imm) {
@@ -20,6 +20,10 @@
 // MixColumns(&block);
 // InvMixColumns(&block);
 
+// Round (ShiftRows + SubBytes + MixColumns + AddRoundKey in one pass)
+// AESEncRound(&state, key);
+// AESDecRound(&state, key);
+
 unsigned char sBox[] =
 { /*  0    1    2    3    4    5    6    7    8    9    a    b    c    d    e    f */
     0x63,0x7c,0x77,0x7b,0xf2,0x6b,0x6f,0xc5,0x30,0x01,0x67,0x2b,0xfe,0xd7,0xab,0x76, /*0*/
@@ -230,3 +234,82 @@ uint32_t RotWord(uint32_t X) {
     
     return X;
 }
+
+/**********************************************/
+/**  Fast AES rounds                         **/
+/**********************************************/
+static const unsigned char ShiftRowsIdx[16] = { 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11 };
+static const unsigned char InvShiftRowsIdx[16] = { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 };
+
+static inline unsigned char xtime(unsigned char x) {
+    return (unsigned char)((x << 1) ^ ((x >> 7) * 0x1b));
+}
+
+static inline void MixColumn(unsigned char *a) {
+    unsigned char a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    unsigned char t = a0 ^ a1 ^ a2 ^ a3;
+
+    a[0] = a0 ^ t ^ xtime(a0 ^ a1);
+    a[1] = a1 ^ t ^ xtime(a1 ^ a2);
+    a[2] = a2 ^ t ^ xtime(a2 ^ a3);
+    a[3] = a3 ^ t ^ xtime(a3 ^ a0);
+}
+
+static inline void InvMixColumn(unsigned char *a) {
+    unsigned char u = xtime(xtime(a[0] ^ a[2]));
+    unsigned char v = xtime(xtime(a[1] ^ a[3]));
+
+    a[0] ^= u;
+    a[1] ^= v;
+    a[2] ^= u;
+    a[3] ^= v;
+    MixColumn(a);
+}
+
+//aesenc: ShiftRows -> SubBytes -> MixColumns -> AddRoundKey
+void AESEncRound(XMM *state, XMM key) {
+    XMM tmp;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        tmp.u8[i] = sBox[state->u8[ShiftRowsIdx[i]]];
+    for (i = 0; i < 16; i += 4)
+        MixColumn(&tmp.u8[i]);
+
+    state->u128 = tmp.u128 ^ key.u128;
+}
+
+//aesenclast: ShiftRows -> SubBytes -> AddRoundKey
+void AESEncLastRound(XMM *state, XMM key) {
+    XMM tmp;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        tmp.u8[i] = sBox[state->u8[ShiftRowsIdx[i]]];
+
+    state->u128 = tmp.u128 ^ key.u128;
+}
+
+//aesdec: InvShiftRows -> InvSubBytes -> InvMixColumns -> AddRoundKey
+void AESDecRound(XMM *state, XMM key) {
+    XMM tmp;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        tmp.u8[i] = invsBox[state->u8[InvShiftRowsIdx[i]]];
+    for (i = 0; i < 16; i += 4)
+        InvMixColumn(&tmp.u8[i]);
+
+    state->u128 = tmp.u128 ^ key.u128;
+}
+
+//aesdeclast: InvShiftRows -> InvSubBytes -> AddRoundKey
+void AESDecLastRound(XMM *state, XMM key) {
+    XMM tmp;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        tmp.u8[i] = invsBox[state->u8[InvShiftRowsIdx[i]]];
+
+    state->u128 = tmp.u128 ^ key.u128;
+}
@@ -24,4 +24,9 @@ void InvShiftRows(XMM *block);
 uint32_t SubWord(uint32_t X);
 uint32_t RotWord(uint32_t X);
 
+void AESEncRound(XMM *state, XMM key);
+void AESEncLastRound(XMM *state, XMM key);
+void AESDecRound(XMM *state, XMM key);
+void AESDecLastRound(XMM *state, XMM key);
+
 #endif /* aesins_h */
@@ -10,6 +10,9 @@
 #define avx_h
 
 #include "optrap.h"
+#include "perm.h"
+#include "softfloat.h"
+#include "sse2int.h"
 
 int avx_instruction(struct pt_regs *regs,
                     uint8_t vexreg,
@@ -321,142 +324,44 @@ static inline void vpblendd_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
 }
 
 static inline void vpermilpd_128a(XMM src, XMM vsrc, XMM *res) {
-    int i;
-    int cs;
-    uint64_t mask = 0;
-    
-    for (i = 0; i < 2; ++i) {
-        mask = src.u64[i];
-        cs = (mask >> 1) & 1;
-        if (cs == 1) {
-            res->fa64[i] = vsrc.fa64[1];
-        } else {
-            res->fa64[i] = vsrc.fa64[0];
-        }
-    }
+    uint8_t idx[16];
+
+    perm_elem_idx(idx, src.u8, 16, 8, 1, 1, 1);
+    perm_apply(res->u8, vsrc.u8, NULL, idx, 16);
 }
 static inline void vpermilpd_256a(YMM src, YMM vsrc, YMM *res) {
-    int i;
-    int cs;
-    uint64_t mask = 0;
-    
-    for (i = 0; i < 2; ++i) {
-        mask = src.u64[i];
-        cs = (mask >> 1) & 1;
-        if (cs == 1) {
-            res->fa64[i] = vsrc.fa64[1];
-        } else {
-            res->fa64[i] = vsrc.fa64[0];
-        }
-    }
-    for (i = 2; i < 4; ++i) {
-        mask = src.u64[i];
-        cs = (mask >> 1) & 1;
-        if (cs == 1) {
-            res->fa64[i] = vsrc.fa64[3];
-        } else {
-            res->fa64[i] = vsrc.fa64[2];
-        }
-    }
+    uint8_t idx[32];
 
+    perm_elem_idx(idx, src.u8, 32, 8, 1, 1, 1);
+    perm_apply(res->u8, vsrc.u8, NULL, idx, 32);
 }
 
 static inline void vpermilpd_128b(XMM src, XMM *res, uint8_t imm) {
-    int i;
-    int cs;
-    int mask = imm & 3;
-    
-    for (i = 0; i < 2; ++i) {
-        cs = (mask >> i) & 1;
-        if (cs == 1) {
-            res->fa64[i] = src.fa64[1];
-        } else {
-            res->fa64[i] = src.fa64[0];
-        }
-    }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PERMILPD, imm), 16);
 }
 static inline void vpermilpd_256b(YMM src, YMM *res, uint8_t imm) {
-    int i;
-    int cs;
-    int mask = imm & 15;
-    
-    for (i = 0; i < 2; ++i) {
-        cs = (mask >> i) & 1;
-        if (cs == 1) {
-            res->fa64[i] = src.fa64[1];
-        } else {
-            res->fa64[i] = src.fa64[0];
-        }
-    }
-    for (i = 2; i < 4; ++i) {
-        cs = (mask >> i) & 1;
-        if (cs == 1) {
-            res->fa64[i] = src.fa64[3];
-        } else {
-            res->fa64[i] = src.fa64[2];
-        }
-    }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PERMILPD, imm), 32);
 }
 
 static inline void vpermilps_128a(XMM src, XMM vsrc, XMM *res) {
-    int i;
-    int cs;
-    uint64_t mask = 0;
-    
-    for (i = 0; i < 4; ++i) {
-        mask = src.u32[i];
-        cs = mask & 3;
-        res->fa32[i] = vsrc.fa32[cs];
-    }
+    uint8_t idx[16];
+
+    perm_elem_idx(idx, src.u8, 16, 4, 0, 3, 1);
+    perm_apply(res->u8, vsrc.u8, NULL, idx, 16);
 }
 static inline void vpermilps_256a(YMM src, YMM vsrc, YMM *res) {
-    int i;
-    int cs;
-    uint64_t mask = 0;
-    
-    for (i = 0; i < 4; ++i) {
-        mask = src.u32[i];
-        cs = mask & 3;
-        res->fa32[i] = vsrc.fa32[cs];
-    }
-    for (i = 4; i < 8; ++i) {
-        mask = src.u32[i];
-        cs = mask & 3;
-        res->fa32[i] = vsrc.fa32[cs+4];
-    }
+    uint8_t idx[32];
 
+    perm_elem_idx(idx, src.u8, 32, 4, 0, 3, 1);
+    perm_apply(res->u8, vsrc.u8, NULL, idx, 32);
 }
 
 static inline void vpermilps_128b(XMM src, XMM *res, uint8_t imm) {
-    int i;
-    int cs;
-    int rof = 0;
-    
-    for (i = 0; i < 4; ++i) {
-        rof = i * 2;
-        cs = (imm >> rof) & 3;
-        
-        res->fa32[i] = src.fa32[cs];
-    }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PSHUFD, imm), 16);
 }
 
 static inline void vpermilps_256b(YMM src, YMM *res, uint8_t imm) {
-    int i;
-    int cs;
-    int rof = 0;
-    
-    for (i = 0; i < 4; ++i) {
-        rof = i * 2;
-        cs = (imm >> rof) & 3;
-        
-        res->fa32[i] = src.fa32[cs];
-    }
-    for (i = 4; i < 8; ++i) {
-        rof = (i - 4) * 2;
-        cs = (imm >> rof) & 3;
-
-        res->fa32[i] = src.fa32[cs+4];
-    }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PSHUFD, imm), 32);
 }
 
 static inline void vpmaskmovd_load_128(XMM src, XMM vsrc, XMM *res) {
@@ -579,426 +484,257 @@ static inline void vpmaskmovq_store_256(YMM src, YMM vsrc, YMM *res) {
 
 static inline void vpsllvd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
-    uint32_t ZeroExtend = 0;
-    uint32_t SRC1 = 0, COUNT = 0;
-    
+    uint32_t SRC1 = 0;
+    uint32_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 16, 4, 0);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.u32[i];
         COUNT = src.u32[i];
-        ZeroExtend = SRC1 << COUNT;
-        res->u32[i] = ZeroExtend;
+        res->u32[i] = (COUNT > 31) ? 0 : SRC1 << COUNT;
     }
 }
 static inline void vpsllvd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
-    uint32_t ZeroExtend = 0;
-    uint32_t SRC1 = 0, COUNT = 0;
-    
+    uint32_t SRC1 = 0;
+    uint32_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 32, 4, 0);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         SRC1 = vsrc.u32[i];
         COUNT = src.u32[i];
-        ZeroExtend = SRC1 << COUNT;
-        res->u32[i] = ZeroExtend;
+        res->u32[i] = (COUNT > 31) ? 0 : SRC1 << COUNT;
     }
 }
 
 static inline void vpsllvq_128(XMM src, XMM vsrc, XMM *res) {
     int i;
-    uint64_t ZeroExtend = 0;
-    uint64_t SRC1 = 0, COUNT = 0;
-    
+    uint64_t SRC1 = 0;
+    uint64_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 16, 8, 0);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
         SRC1 = vsrc.u64[i];
         COUNT = src.u64[i];
-        ZeroExtend = SRC1 << COUNT;
-        res->u64[i] = ZeroExtend;
+        res->u64[i] = (COUNT > 63) ? 0 : SRC1 << COUNT;
     }
 }
 static inline void vpsllvq_256(YMM src, YMM vsrc, YMM *res) {
     int i;
-    uint64_t ZeroExtend = 0;
-    uint64_t SRC1 = 0, COUNT = 0;
-    
+    uint64_t SRC1 = 0;
+    uint64_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 32, 8, 0);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.u64[i];
         COUNT = src.u64[i];
-        ZeroExtend = SRC1 << COUNT;
-        res->u64[i] = ZeroExtend;
+        res->u64[i] = (COUNT > 63) ? 0 : SRC1 << COUNT;
     }
 }
 
 static inline void vpsravd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
-    int32_t SignExtend;
-    int32_t SRC1 = 0, COUNT = 0;
+    int32_t SRC1 = 0;
+    uint32_t COUNT = 0;
 
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 16, 4, 2);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.a32[i];
-        COUNT = src.a32[i];
-        SignExtend = SRC1 << COUNT;
-        res->a32[i] = SignExtend;
+        COUNT = src.u32[i];
+        res->a32[i] = SRC1 >> ((COUNT > 31) ? 31 : COUNT);
     }
 }
 static inline void vpsravd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
-    int32_t SignExtend;
-    int32_t SRC1 = 0, COUNT = 0;
-    
+    int32_t SRC1 = 0;
+    uint32_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 32, 4, 2);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         SRC1 = vsrc.a32[i];
-        COUNT = src.a32[i];
-        SignExtend = SRC1 >> COUNT;
-        res->a32[i] = SignExtend;
+        COUNT = src.u32[i];
+        res->a32[i] = SRC1 >> ((COUNT > 31) ? 31 : COUNT);
     }
 }
 
 static inline void vpsrlvd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
-    uint32_t ZeroExtend = 0;
-    uint32_t SRC1 = 0, COUNT = 0;
-    
+    uint32_t SRC1 = 0;
+    uint32_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 16, 4, 1);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.u32[i];
         COUNT = src.u32[i];
-        ZeroExtend = SRC1 >> COUNT;
-        res->u32[i] = ZeroExtend;
+        res->u32[i] = (COUNT > 31) ? 0 : SRC1 >> COUNT;
     }
 }
 static inline void vpsrlvd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
-    uint32_t ZeroExtend = 0;
-    uint32_t SRC1 = 0, COUNT = 0;
-    
+    uint32_t SRC1 = 0;
+    uint32_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 32, 4, 1);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         SRC1 = vsrc.u32[i];
         COUNT = src.u32[i];
-        ZeroExtend = SRC1 >> COUNT;
-        res->u32[i] = ZeroExtend;
+        res->u32[i] = (COUNT > 31) ? 0 : SRC1 >> COUNT;
     }
 }
 
 static inline void vpsrlvq_128(XMM src, XMM vsrc, XMM *res) {
     int i;
-    uint64_t ZeroExtend = 0;
-    uint64_t SRC1 = 0, COUNT = 0;
-    
+    uint64_t SRC1 = 0;
+    uint64_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 16, 8, 1);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
         SRC1 = vsrc.u64[i];
         COUNT = src.u64[i];
-        ZeroExtend = SRC1 >> COUNT;
-        res->u64[i] = ZeroExtend;
+        res->u64[i] = (COUNT > 63) ? 0 : SRC1 >> COUNT;
     }
 }
 static inline void vpsrlvq_256(YMM src, YMM vsrc, YMM *res) {
     int i;
-    uint64_t ZeroExtend = 0;
-    uint64_t SRC1 = 0, COUNT = 0;
-    
+    uint64_t SRC1 = 0;
+    uint64_t COUNT = 0;
+
+    if (!opemu_softfp()) {
+        sse2_shiftv(res->u8, vsrc.u8, src.u8, 32, 8, 1);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.u64[i];
         COUNT = src.u64[i];
-        ZeroExtend = SRC1 >> COUNT;
-        res->u64[i] = ZeroExtend;
+        res->u64[i] = (COUNT > 63) ? 0 : SRC1 >> COUNT;
     }
 }
 
 static inline void vtestps_128(XMM src, XMM dst, struct pt_regs *regs) {
-    int tmp0 = 0, tmp1 = 0, tmp2 = 0, tmp3 = 0;
-    XMM TEMP;
+    uint64_t AND1 = 0, AND2 = 0;
     unsigned long FLAGS;
+    int i;
 
-    FLAGS = regs->flags;
-
-    TEMP.u128 = src.u128 & dst.u128;
-    tmp0 = (TEMP.u32[0] >> 31) & 1;
-    tmp1 = (TEMP.u32[1] >> 31) & 1;
-    tmp2 = (TEMP.u32[2] >> 31) & 1;
-    tmp3 = (TEMP.u32[3] >> 31) & 1;
-
-    if ((tmp0 = 0) && (tmp1 = 0) && (tmp2 = 0) && (tmp3 = 0)) {
-        //ZF = 1
-        FLAGS = FLAGS | 0x0040;
+    if (!opemu_softfp()) {
+        FLAGS = sse2_ptest(src.u8, dst.u8, 16, 4);
     } else {
-        //ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-    TEMP.u128 = src.u128 & ~dst.u128;
-    tmp0 = (TEMP.u32[0] >> 31) & 1;
-    tmp1 = (TEMP.u32[1] >> 31) & 1;
-    tmp2 = (TEMP.u32[2] >> 31) & 1;
-    tmp3 = (TEMP.u32[3] >> 31) & 1;
-
-    if ((tmp0 = 0) && (tmp1 = 0) && (tmp2 = 0) && (tmp3 = 0)) {
-        //CF = 1
-        FLAGS = FLAGS | 0x0001;
-    } else {
-        //CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
+        for (i = 0; i < 2; ++i) {
+            AND1 |= src.u64[i] & dst.u64[i];
+            AND2 |= src.u64[i] & ~dst.u64[i];
+        }
+        FLAGS = (unsigned long)((AND1 & 0x8000000080000000ULL) == 0) << 6 | ((AND2 & 0x8000000080000000ULL) == 0);
     }
-    //AF←OF←PF←SF←0
-    FLAGS = (FLAGS | 0x0010) ^ 0x0010;
-    FLAGS = (FLAGS | 0x0800) ^ 0x0800;
-    FLAGS = (FLAGS | 0x0004) ^ 0x0004;
-    FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-    
-    regs->flags = FLAGS;
+    //ZF and CF, AF←OF←PF←SF←0
+    regs->flags = (regs->flags & ~0x8D5UL) | FLAGS;
 }
 static inline void vtestps_256(YMM src, YMM dst, struct pt_regs *regs) {
-    int tmp0 = 0, tmp1 = 0, tmp2 = 0, tmp3 = 0, tmp4 = 0, tmp5 = 0, tmp6 = 0, tmp7 = 0;
-    YMM TEMP;
-
+    uint64_t AND1 = 0, AND2 = 0;
     unsigned long FLAGS;
+    int i;
 
-    FLAGS = regs->flags;
-
-    TEMP.u128[0] = src.u128[0] & dst.u128[0];
-    TEMP.u128[1] = src.u128[1] & dst.u128[1];
-    tmp0 = (TEMP.u32[0] >> 31) & 1;
-    tmp1 = (TEMP.u32[1] >> 31) & 1;
-    tmp2 = (TEMP.u32[2] >> 31) & 1;
-    tmp3 = (TEMP.u32[3] >> 31) & 1;
-    tmp4 = (TEMP.u32[4] >> 31) & 1;
-    tmp5 = (TEMP.u32[5] >> 31) & 1;
-    tmp6 = (TEMP.u32[6] >> 31) & 1;
-    tmp7 = (TEMP.u32[7] >> 31) & 1;
-
-    
-    if ((tmp0 = 0) && (tmp1 = 0) && (tmp2 = 0) && (tmp3 = 0) && (tmp4 = 0) && (tmp5 = 0) && (tmp6 = 0) && (tmp7 = 0)) {
-        //ZF = 1
-        FLAGS = FLAGS | 0x0040;
-    } else {
-        //ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-
-    TEMP.u128[0] = src.u128[0] & ~dst.u128[0];
-    TEMP.u128[1] = src.u128[1] & ~dst.u128[1];
-    tmp0 = (TEMP.u32[0] >> 31) & 1;
-    tmp1 = (TEMP.u32[1] >> 31) & 1;
-    tmp2 = (TEMP.u32[2] >> 31) & 1;
-    tmp3 = (TEMP.u32[3] >> 31) & 1;
-    tmp4 = (TEMP.u32[4] >> 31) & 1;
-    tmp5 = (TEMP.u32[5] >> 31) & 1;
-    tmp6 = (TEMP.u32[6] >> 31) & 1;
-    tmp7 = (TEMP.u32[7] >> 31) & 1;
-
-    if ((tmp0 = 0) && (tmp1 = 0) && (tmp2 = 0) && (tmp3 = 0) && (tmp4 = 0) && (tmp5 = 0) && (tmp6 = 0) && (tmp7 = 0)) {
-        //CF = 1
-        FLAGS = FLAGS | 0x0001;
+    if (!opemu_softfp()) {
+        FLAGS = sse2_ptest(src.u8, dst.u8, 32, 4);
     } else {
-        //CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
+        for (i = 0; i < 4; ++i) {
+            AND1 |= src.u64[i] & dst.u64[i];
+            AND2 |= src.u64[i] & ~dst.u64[i];
+        }
+        FLAGS = (unsigned long)((AND1 & 0x8000000080000000ULL) == 0) << 6 | ((AND2 & 0x8000000080000000ULL) == 0);
     }
-    //AF←OF←PF←SF←0
-    FLAGS = (FLAGS | 0x0010) ^ 0x0010;
-    FLAGS = (FLAGS | 0x0800) ^ 0x0800;
-    FLAGS = (FLAGS | 0x0004) ^ 0x0004;
-    FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-
-    regs->flags = FLAGS;
-
+    //ZF and CF, AF←OF←PF←SF←0
+    regs->flags = (regs->flags & ~0x8D5UL) | FLAGS;
 }
 
 static inline void vtestpd_128(XMM src, XMM dst, struct pt_regs *regs) {
-    int tmp0 = 0, tmp1 = 0;
-    XMM TEMP;
+    uint64_t AND1 = 0, AND2 = 0;
     unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
-    TEMP.u128 = src.u128 & dst.u128;
-    tmp0 = (TEMP.u64[0] >> 63) & 1;
-    tmp1 = (TEMP.u64[1] >> 63) & 1;
-
-    if ((tmp0 = 0) && (tmp1 = 0)) {
-        //ZF = 1
-        FLAGS = FLAGS | 0x0040;
-    } else {
-        //ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-    TEMP.u128 = src.u128 & ~dst.u128;
-    tmp0 = (TEMP.u64[0] >> 63) & 1;
-    tmp1 = (TEMP.u64[1] >> 63) & 1;
+    int i;
 
-    if ((tmp0 = 0) && (tmp1 = 0)) {
-        //CF = 1
-        FLAGS = FLAGS | 0x0001;
+    if (!opemu_softfp()) {
+        FLAGS = sse2_ptest(src.u8, dst.u8, 16, 8);
     } else {
-        //CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
+        for (i = 0; i < 2; ++i) {
+            AND1 |= src.u64[i] & dst.u64[i];
+            AND2 |= src.u64[i] & ~dst.u64[i];
+        }
+        FLAGS = (unsigned long)((AND1 & 0x8000000000000000ULL) == 0) << 6 | ((AND2 & 0x8000000000000000ULL) == 0);
     }
-    //AF←OF←PF←SF←0
-    FLAGS = (FLAGS | 0x0010) ^ 0x0010;
-    FLAGS = (FLAGS | 0x0800) ^ 0x0800;
-    FLAGS = (FLAGS | 0x0004) ^ 0x0004;
-    FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-
-    regs->flags = FLAGS;
+    //ZF and CF, AF←OF←PF←SF←0
+    regs->flags = (regs->flags & ~0x8D5UL) | FLAGS;
 }
 static inline void vtestpd_256(YMM src, YMM dst, struct pt_regs *regs) {
-    int tmp0 = 0, tmp1 = 0, tmp2 = 0, tmp3 = 0;
-    YMM TEMP;
-    
+    uint64_t AND1 = 0, AND2 = 0;
     unsigned long FLAGS;
-    FLAGS = regs->flags;
-
-    
-    TEMP.u128[0] = src.u128[0] & dst.u128[0];
-    TEMP.u128[1] = src.u128[1] & dst.u128[1];
-    tmp0 = (TEMP.u64[0] >> 63) & 1;
-    tmp1 = (TEMP.u64[1] >> 63) & 1;
-    tmp2 = (TEMP.u64[2] >> 63) & 1;
-    tmp3 = (TEMP.u64[3] >> 63) & 1;
+    int i;
 
-    
-    if ((tmp0 = 0) && (tmp1 = 0) && (tmp2 = 0) && (tmp3 = 0)) {
-        //ZF = 1
-        FLAGS = FLAGS | 0x0040;
+    if (!opemu_softfp()) {
+        FLAGS = sse2_ptest(src.u8, dst.u8, 32, 8);
     } else {
-        //ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-    
-    TEMP.u128[0] = src.u128[0] & ~dst.u128[0];
-    TEMP.u128[1] = src.u128[1] & ~dst.u128[1];
-    tmp0 = (TEMP.u64[0] >> 63) & 1;
-    tmp1 = (TEMP.u64[1] >> 63) & 1;
-    tmp2 = (TEMP.u64[2] >> 63) & 1;
-    tmp3 = (TEMP.u64[3] >> 63) & 1;
-
-    if ((tmp0 = 0) && (tmp1 = 0) && (tmp2 = 0) && (tmp3 = 0)) {
-        //CF = 1
-        FLAGS = FLAGS | 0x0001;
-    } else {
-        //CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
+        for (i = 0; i < 4; ++i) {
+            AND1 |= src.u64[i] & dst.u64[i];
+            AND2 |= src.u64[i] & ~dst.u64[i];
+        }
+        FLAGS = (unsigned long)((AND1 & 0x8000000000000000ULL) == 0) << 6 | ((AND2 & 0x8000000000000000ULL) == 0);
     }
-    //AF←OF←PF←SF←0
-    FLAGS = (FLAGS | 0x0010) ^ 0x0010;
-    FLAGS = (FLAGS | 0x0800) ^ 0x0800;
-    FLAGS = (FLAGS | 0x0004) ^ 0x0004;
-    FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-
-    regs->flags = FLAGS;
-    
+    //ZF and CF, AF←OF←PF←SF←0
+    regs->flags = (regs->flags & ~0x8D5UL) | FLAGS;
 }
 
 static inline void vperm2f128(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    YMM tmp;
-    int imm1_0 = imm & 3;
-    int imm5_4 = (imm >> 4) & 3;
-    int imm3 = (imm >> 3) & 1;
-    int imm7 = (imm >> 7) & 1;
-    
-    if (imm1_0 == 0) {
-        tmp.u128[0] = vsrc.u128[0];
-    } else if (imm1_0 == 1) {
-        tmp.u128[0] = vsrc.u128[1];
-    } else if (imm1_0 == 2) {
-        tmp.u128[0] = src.u128[0];
-    } else if (imm1_0 == 3) {
-        tmp.u128[0] = src.u128[1];
-    }
-    
-    if (imm5_4 == 0) {
-        tmp.u128[1] = vsrc.u128[0];
-    } else if (imm1_0 == 1) {
-        tmp.u128[1] = vsrc.u128[1];
-    } else if (imm1_0 == 2) {
-        tmp.u128[1] = src.u128[0];
-    } else if (imm1_0 == 3) {
-        tmp.u128[1] = src.u128[1];
-    }
-
-    if (imm3 == 1) {
-        tmp.u128[0] = 0;
-    }
-    if (imm7 == 1) {
-        tmp.u128[1] = 0;
-    }
-    
-    res->fa64[0] = tmp.fa64[0];
-    res->fa64[1] = tmp.fa64[1];
-    res->fa64[2] = tmp.fa64[2];
-    res->fa64[3] = tmp.fa64[3];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_PERM2X128, imm), 32);
 }
 
 static inline void vperm2i128(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    int imm1_0 = imm & 3;
-    int imm5_4 = (imm >> 4) & 3;
-    int imm3 = (imm >> 3) & 1;
-    int imm7 = (imm >> 7) & 1;
-    
-    if (imm1_0 == 0) {
-        res->u128[0] = vsrc.u128[0];
-    } else if (imm1_0 == 1) {
-        res->u128[0] = vsrc.u128[1];
-    } else if (imm1_0 == 2) {
-        res->u128[0] = src.u128[0];
-    } else if (imm1_0 == 3) {
-        res->u128[0] = src.u128[1];
-    }
-    
-    if (imm5_4 == 0) {
-        res->u128[1] = vsrc.u128[0];
-    } else if (imm1_0 == 1) {
-        res->u128[1] = vsrc.u128[1];
-    } else if (imm1_0 == 2) {
-        res->u128[1] = src.u128[0];
-    } else if (imm1_0 == 3) {
-        res->u128[1] = src.u128[1];
-    }
-    
-    if (imm3 == 1) {
-        res->u128[0] = 0;
-    }
-    if (imm7 == 1) {
-        res->u128[1] = 0;
-    }
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_PERM2X128, imm), 32);
 }
 
 static inline void vpermd(YMM src, YMM vsrc, YMM *res) {
-    int i;
-    int idx = 0;
+    uint8_t idx[32];
 
-    for (i = 0; i < 8; ++i) {
-        idx = vsrc.u32[i] & 7;
-        res->u32[i] = src.u32[idx];
-    }
+    perm_elem_idx(idx, vsrc.u8, 32, 4, 0, 7, 0);
+    perm_apply(res->u8, src.u8, NULL, idx, 32);
 }
 
 static inline void vpermps(YMM src, YMM vsrc, YMM *res) {
-    int i;
-    int idx = 0;
-    
-    for (i = 0; i < 8; ++i) {
-        idx = vsrc.u32[i] & 7;
-        res->fa32[i] = src.fa32[idx];
-    }
+    uint8_t idx[32];
+
+    perm_elem_idx(idx, vsrc.u8, 32, 4, 0, 7, 0);
+    perm_apply(res->u8, src.u8, NULL, idx, 32);
 }
 
 static inline void vpermq(YMM src, YMM *res, uint8_t imm) {
-    int i;
-    int j = 0;
-    int idx = 0;
-    
-    for (i = 0; i < 4; ++i) {
-        j = i * 2;
-        idx = (imm >> j) & 3;
-        res->u64[i] = src.u64[idx];
-    }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PERMQ, imm), 32);
 }
 
 static inline void vpermpd(YMM src, YMM *res, uint8_t imm) {
-    int i;
-    int j = 0;
-    int idx = 0;
-    
-    for (i = 0; i < 4; ++i) {
-        j = i * 2;
-        idx = (imm >> j) & 3;
-        res->fa64[i] = src.fa64[idx];
-    }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PERMQ, imm), 32);
 }
 
 static inline void vzeroupper(struct pt_regs *regs) {
@@ -115,8 +115,9 @@ int bmi_instruction(struct pt_regs *regs,
                     if (leading_opcode == 2) {//0F38
                         mulx64(m64src, &m64res, &m64dres, regs, operand_size);
                         //opcodename = "mulx64";
-                        _load_m64(num_dst, &m64res, regs);
+                        //same register twice: the high half wins
                         _load_m64(vexreg, &m64dres, regs);
+                        _load_m64(num_dst, &m64res, regs);
                     }
                 }
                 break;
@@ -231,8 +232,9 @@ int bmi_instruction(struct pt_regs *regs,
                     if (leading_opcode == 2) {//0F38
                         mulx32(m32src, &m32res, &m32dres, regs);
                         //opcodename = "mulx32";
-                        _load_m32(num_dst, &m32res, regs);
+                        //same register twice: the high half wins
                         _load_m32(vexreg, &m32dres, regs);
+                        _load_m32(num_dst, &m32res, regs);
                     }
                 }
                 break;
@@ -28,543 +28,125 @@ int bmi_instruction(struct pt_regs *regs,
 /**********************************************/
 /**  BMI1  instructions implementation       **/
 /**********************************************/
-static inline void andn64(M64 src, M64 vsrc, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
+//SF and ZF from the width-bit result, CF as given, OF cleared;
+//AF and PF are undefined and left as they were
+static inline void bmi1_flags(uint64_t DEST, int width, int CF, struct pt_regs *regs) {
     unsigned long FLAGS;
-    FLAGS = regs->flags;
 
-    int SF;
+    FLAGS = ((DEST >> (width - 1)) & 1) << 7 | (unsigned long)(DEST == 0) << 6 | CF;
+    regs->flags = (regs->flags & ~0x8C1UL) | FLAGS;
+}
 
-    if (operand_size == 64) {
-        int64_t SRC1 = vsrc.a64;
-        int64_t SRC2 = src.a64;
-        res->a64 = (~SRC1) & SRC2;
-        
-        //set flag
-        uint64_t DEST = res->u64;
-        //SF = bit[63]
-        SF = (DEST >> 63) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
+//bits START up to START + LEN - 1, nothing past the operand width
+static inline uint64_t bmi1_bextr(uint64_t SRC, uint16_t CTRL, int width) {
+    uint8_t START = CTRL & 0xFF;
+    uint8_t LEN = CTRL >> 8;
+    uint64_t DEST;
 
-    } else {
-        int32_t SRC1 = vsrc.a32[0];
-        int32_t SRC2 = src.a32[0];
-        res->a32[0] = (~SRC1) & SRC2;
-        
-        //set flag
-        uint32_t DEST = res->u32[0];
-        //SF = bit[31]
-        SF = (DEST >> 31) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-    }
-    
-    regs->flags = FLAGS;
+    DEST = (START < width) ? SRC >> START : 0;
+    DEST &= (LEN < width) ? ((uint64_t)1 << LEN) - 1 : ~(uint64_t)0;
+    return DEST;
 }
 
-static inline void andn32(M32 src, M32 vsrc, M32 *res, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
-    
-    int32_t SRC1 = vsrc.a32;
-    int32_t SRC2 = src.a32;
-    res->a32 = (~SRC1) & SRC2;
-    
-    //set flag
-    uint32_t DEST = res->u32;
-    //SF = bit[31]
-    SF = (DEST >> 31) & 1;
-    if (SF == 1) {
-        //set SF = 1
-        FLAGS = FLAGS | 0x0080;
-    } else {
-        //set SF = 0
-        FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-    }
-    if (DEST == 0) {
-        //set ZF = 1
-        FLAGS = FLAGS | 0x0040;
-    } else {
-        //set ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
+static inline void andn64(M64 src, M64 vsrc, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
+    int width = (operand_size == 64) ? 64 : 32;
+    uint64_t MASK = (width == 64) ? ~(uint64_t)0 : 0xFFFFFFFF;
 
-    regs->flags = FLAGS;
+    res->u64 = ~vsrc.u64 & src.u64 & MASK;
+    bmi1_flags(res->u64, width, 0, regs);
 }
 
-static inline void bextr64(M64 src, M64 vsrc, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
-    uint8_t start = vsrc.u8[0];
-    uint8_t len = vsrc.u8[1];
+static inline void andn32(M32 src, M32 vsrc, M32 *res, struct pt_regs *regs) {
+    res->u32 = ~vsrc.u32 & src.u32;
+    bmi1_flags(res->u32, 32, 0, regs);
+}
 
-    if (operand_size == 64) {
-        uint64_t DEST = 0;
-        uint64_t SRC = src.u64;
-        if (start < 64) {
-            DEST = (SRC >> start) & ((1LL << (len + 1)) - 1);
-            res->u64 = DEST;
-        }
-        
-        //set flag
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-        
-    } else {
-        uint32_t DEST = 0;
-        uint32_t SRC = src.u32[0];
-        if (start < 32) {
-            DEST = (SRC >> start) & ((1 << (len + 1)) - 1);
-            res->u32[0] = DEST;
-        }
+static inline void bextr64(M64 src, M64 vsrc, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
+    int width = (operand_size == 64) ? 64 : 32;
+    uint64_t MASK = (width == 64) ? ~(uint64_t)0 : 0xFFFFFFFF;
 
-        //set flag
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-    }
-    regs->flags = FLAGS;
+    res->u64 = bmi1_bextr(src.u64 & MASK, vsrc.u16[0], width);
+    bmi1_flags(res->u64, width, 0, regs);
 }
 
 static inline void bextr32(M32 src, M32 vsrc, M32 *res, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
-    uint8_t start = vsrc.u8[0];
-    uint8_t len = vsrc.u8[1];
-    
-    uint32_t DEST = 0;
-    uint32_t SRC = src.u32;
-
-    if (start < 32) {
-        DEST = (SRC >> start) & ((1 << (len + 1)) - 1);
-        res->u32 = DEST;
-    }
-
-    //set flag
-    if (DEST == 0) {
-        //set ZF = 1
-        FLAGS = FLAGS | 0x0040;
-    } else {
-        //set ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-
-    regs->flags = FLAGS;
+    res->u32 = (uint32_t)bmi1_bextr(src.u32, vsrc.u16[0], 32);
+    bmi1_flags(res->u32, 32, 0, regs);
 }
 
 static inline void blsr64(M64 src, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
+    int width = (operand_size == 64) ? 64 : 32;
+    uint64_t MASK = (width == 64) ? ~(uint64_t)0 : 0xFFFFFFFF;
+    uint64_t SRC = src.u64 & MASK;
 
-    if (operand_size == 64) {
-        int64_t SRC1 = src.a64;
-        int64_t SRC2 = src.a64;
-        res->a64 = (SRC1 - 1) & (SRC2);
-        
-        //set flag
-        uint64_t DEST = res->u64;
-        //SF = bit[63]
-        SF = (DEST >> 63) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-        if (SRC2 == 0) {
-            //set CF = 1
-            FLAGS = FLAGS | 0x0001;
-        } else {
-            //set CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        }
-
-    } else {
-        int32_t SRC1 = src.a32[0];
-        int32_t SRC2 = src.a32[0];
-        res->a32[0] = (SRC1 - 1) & (SRC2);
-        
-        //set flag
-        uint32_t DEST = res->u32[0];
-        //SF = bit[31]
-        SF = (DEST >> 31) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-        if (SRC2 == 0) {
-            //set CF = 1
-            FLAGS = FLAGS | 0x0001;
-        } else {
-            //set CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        }
-    }
-    regs->flags = FLAGS;
+    res->u64 = (SRC - 1) & SRC;
+    //CF = source is zero
+    bmi1_flags(res->u64, width, SRC == 0, regs);
 }
 
 static inline void blsr32(M32 src, M32 *res, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
-
-    int32_t SRC1 = src.a32;
-    int32_t SRC2 = src.a32;
-    res->a32 = (SRC1 - 1) & (SRC2);
-
-    //set flag
-    uint32_t DEST = res->u32;
-    //SF = bit[31]
-    SF = (DEST >> 31) & 1;
-    if (SF == 1) {
-        //set SF = 1
-        FLAGS = FLAGS | 0x0080;
-    } else {
-        //set SF = 0
-        FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-    }
-    if (DEST == 0) {
-        //set ZF = 1
-        FLAGS = FLAGS | 0x0040;
-    } else {
-        //set ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-    if (SRC2 == 0) {
-        //set CF = 1
-        FLAGS = FLAGS | 0x0001;
-    } else {
-        //set CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-    }
-    regs->flags = FLAGS;
+    uint32_t SRC = src.u32;
+
+    res->u32 = (SRC - 1) & SRC;
+    bmi1_flags(res->u32, 32, SRC == 0, regs);
 }
 
+//the result is never zero, so ZF always clears
 static inline void blsmsk64(M64 src, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
-
-    if (operand_size == 64) {
-        int64_t SRC1 = src.a64;
-        int64_t SRC2 = src.a64;
-        res->a64 = (SRC1 - 1) ^ (SRC2);
-
-        //set flag
-        uint64_t DEST = res->u64;
-        //SF = bit[63]
-        SF = (DEST >> 63) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        
-        //set ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-
-        if (SRC2 == 0) {
-            //set CF = 1
-            FLAGS = FLAGS | 0x0001;
-        } else {
-            //set CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        }
-    } else {
-        int32_t SRC1 = src.a32[0];
-        int32_t SRC2 = src.a32[0];
-        res->a32[0] = (SRC1 - 1) ^ (SRC2);
-
-        //set flag
-        uint32_t DEST = res->u32[0];
-        //SF = bit[31]
-        SF = (DEST >> 31) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        
-        //set ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-
-        if (SRC2 == 0) {
-            //set CF = 1
-            FLAGS = FLAGS | 0x0001;
-        } else {
-            //set CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        }
+    int width = (operand_size == 64) ? 64 : 32;
+    uint64_t MASK = (width == 64) ? ~(uint64_t)0 : 0xFFFFFFFF;
+    uint64_t SRC = src.u64 & MASK;
 
-    }
-    regs->flags = FLAGS;
+    res->u64 = ((SRC - 1) ^ SRC) & MASK;
+    bmi1_flags(res->u64, width, SRC == 0, regs);
 }
 
 static inline void blsmsk32(M32 src, M32 *res, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
-
-    int32_t SRC = src.a32;
-    res->a32 = (SRC - 1) ^ (SRC);
-    
-    //set flag
-    uint32_t DEST = res->u32;
-    //SF = bit[31]
-    SF = (DEST >> 31) & 1;
-    if (SF == 1) {
-        //set SF = 1
-        FLAGS = FLAGS | 0x0080;
-    } else {
-        //set SF = 0
-        FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-    }
-
-    //set ZF = 0
-    FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-
-    if (SRC == 0) {
-        //set CF = 1
-        FLAGS = FLAGS | 0x0001;
-    } else {
-        //set CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-    }
-
-    regs->flags = FLAGS;
+    uint32_t SRC = src.u32;
 
+    res->u32 = (SRC - 1) ^ SRC;
+    bmi1_flags(res->u32, 32, SRC == 0, regs);
 }
 
 static inline void blsi64(M64 src, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
+    int width = (operand_size == 64) ? 64 : 32;
+    uint64_t MASK = (width == 64) ? ~(uint64_t)0 : 0xFFFFFFFF;
+    uint64_t SRC = src.u64 & MASK;
 
-    if (operand_size == 64) {
-        int64_t SRC1 = src.a64;
-        int64_t SRC2 = src.a64;
-        res->a64 = (-SRC1) & (SRC2);
-        
-        //set flag
-        uint64_t DEST = res->u64;
-        //SF = bit[63]
-        SF = (DEST >> 63) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-        if (SRC2 == 0) {
-            //set CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        } else {
-            //set CF = 1
-            FLAGS = FLAGS | 0x0001;
-        }
-
-    } else {
-        int32_t SRC1 = src.a32[0];
-        int32_t SRC2 = src.a32[0];
-        res->a32[0] = (-SRC1 ) & (SRC2);
-        
-        //set flag
-        uint32_t DEST = res->u32[0];
-        //SF = bit[31]
-        SF = (DEST >> 31) & 1;
-        if (SF == 1) {
-            //set SF = 1
-            FLAGS = FLAGS | 0x0080;
-        } else {
-            //set SF = 0
-            FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-        }
-        if (DEST == 0) {
-            //set ZF = 1
-            FLAGS = FLAGS | 0x0040;
-        } else {
-            //set ZF = 0
-            FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-        }
-        if (SRC2 == 0) {
-            //set CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        } else {
-            //set CF = 1
-            FLAGS = FLAGS | 0x0001;
-        }
-    }
-    regs->flags = FLAGS;
+    res->u64 = -SRC & SRC;
+    //CF = source is not zero
+    bmi1_flags(res->u64, width, SRC != 0, regs);
 }
 
 static inline void blsi32(M32 src, M32 *res, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    int SF;
-
-    int32_t SRC1 = src.a32;
-    int32_t SRC2 = src.a32;
-    res->a32 = (-SRC1 ) & (SRC2);
-
-    //set flag
-    uint32_t DEST = res->u32;
-    //SF = bit[31]
-    SF = (DEST >> 31) & 1;
-    if (SF == 1) {
-        //set SF = 1
-        FLAGS = FLAGS | 0x0080;
-    } else {
-        //set SF = 0
-        FLAGS = (FLAGS | 0x0080) ^ 0x0080;
-    }
-    if (DEST == 0) {
-        //set ZF = 1
-        FLAGS = FLAGS | 0x0040;
-    } else {
-        //set ZF = 0
-        FLAGS = (FLAGS | 0x0040) ^ 0x0040;
-    }
-    if (SRC2 == 0) {
-        //set CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-    } else {
-        //set CF = 1
-        FLAGS = FLAGS | 0x0001;
-    }
-    regs->flags = FLAGS;
+    uint32_t SRC = src.u32;
+
+    res->u32 = -SRC & SRC;
+    bmi1_flags(res->u32, 32, SRC != 0, regs);
 }
 
 /**********************************************/
 /**  BMI2  instructions implementation       **/
 /**********************************************/
+//SF and ZF from the result, OF cleared, CF when the index is past the operand width
 static inline void bzhi64(M64 src, M64 vsrc, M64 *res, uint8_t operand_size, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
+    int width = (operand_size == 64) ? 64 : 32;
+    uint64_t MASK = (width == 64) ? ~(uint64_t)0 : 0xFFFFFFFF;
     uint8_t INDEX = vsrc.u8[0];
 
-    if (operand_size == 64) {
-        uint64_t SRC = src.u64;
-        if (INDEX < 64) {
-            SRC &= ((1LL << INDEX) -1);
-        }
-        res->u64 = SRC;
-
-        if (INDEX > 63) {
-            //CF = 1
-            FLAGS = FLAGS | 0x0001;
-        } else {
-            //CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        }
-
-    } else {
-        uint32_t SRC = src.u32[0];
-        if (INDEX < 32) {
-            SRC &= (1 << INDEX) -1;
-        }
-        res->u32[0] = SRC;
-        
-        if (INDEX > 31) {
-            //CF = 1
-            FLAGS = FLAGS | 0x0001;
-        } else {
-            //CF = 0
-            FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-        }
-    }
-    
-    regs->flags = FLAGS;
+    res->u64 = src.u64 & MASK;
+    if (INDEX < width)
+        res->u64 &= ((uint64_t)1 << INDEX) - 1;
+    bmi1_flags(res->u64, width, INDEX >= width, regs);
 }
 
 static inline void bzhi32(M32 src, M32 vsrc, M32 *res, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
     uint8_t INDEX = vsrc.u8[0];
-    uint32_t SRC = src.u32;
-
-    if (INDEX < 32) {
-        SRC &= (1 << INDEX) -1;
-    }
-    res->u32 = SRC;
-    
-    if (INDEX > 31) {
-        //CF = 1
-        FLAGS = FLAGS | 0x0001;
-    } else {
-        //CF = 0
-        FLAGS = (FLAGS | 0x0001) ^ 0x0001;
-    }
 
-    regs->flags = FLAGS;
+    res->u32 = src.u32;
+    if (INDEX < 32)
+        res->u32 &= ((uint32_t)1 << INDEX) - 1;
+    bmi1_flags(res->u32, 32, INDEX >= 32, regs);
 }
 
 static inline void mulx64(M64 src, M64 *res, M64 *dres, struct pt_regs *regs, uint8_t operand_size) {
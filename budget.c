@@ -0,0 +1,49 @@
+//
+//  budget.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/math64.h>
+#include <linux/module.h>
+#include <linux/sched.h>
+#include <linux/timex.h>
+#include <asm/tsc.h>
+
+#include "budget.h"
+
+/*********************************************************
+ *** Emulation time ceiling per trap.                  ***
+ *** Single instructions have a fixed worst case (see  ***
+ *** opemu-wcet); what grows with the input is the     ***
+ *** number of instructions one trap runs. The loop    ***
+ *** and fused sequence emulators check the deadline   ***
+ *** between instructions and hand back to user mode   ***
+ *** at an instruction boundary once it has passed.    ***
+ *** The deadline lives on the trap's stack and is     ***
+ *** passed down, so a trap that migrates keeps it;    ***
+ *** the TSC it is kept in is synchronized across CPUs ***
+ *** wherever it is the clocksource.                   ***
+ *********************************************************/
+
+static unsigned int trap_budget_us;
+module_param(trap_budget_us, uint, 0644);
+MODULE_PARM_DESC(trap_budget_us, "Ceiling on emulation time per trap in microseconds (0 = none)");
+
+/** Start the clock of the trap about to be emulated. returns its TSC deadline, 0 for none. **/
+uint64_t opemu_budget_begin(void)
+{
+    unsigned int us = READ_ONCE(trap_budget_us);
+
+    if (!us)
+        return 0;
+    return get_cycles() + div_u64((uint64_t)us * tsc_khz, 1000);
+}
+
+/** returns 1 once the trap holding deadline has used up its time. **/
+int opemu_budget_expired(uint64_t deadline)
+{
+    return deadline && ((int64_t)(get_cycles() - deadline) > 0);
+}
@@ -0,0 +1,26 @@
+//
+//  budget.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef budget_h
+#define budget_h
+
+#ifdef __KERNEL__
+
+#include <linux/types.h>
+
+uint64_t opemu_budget_begin(void);
+int opemu_budget_expired(uint64_t deadline);
+
+#else
+
+//userspace stub: no ceiling
+#define opemu_budget_expired(deadline)  0
+
+#endif
+
+#endif /* budget_h */
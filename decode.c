@@ -0,0 +1,409 @@
+//
+//  decode.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/debugfs.h>
+#include <linux/file.h>
+#include <linux/fs.h>
+#include <linux/hash.h>
+#include <linux/hashtable.h>
+#include <linux/mm.h>
+#include <linux/module.h>
+#include <linux/percpu.h>
+#include <linux/rculist.h>
+#include <linux/capability.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/spinlock.h>
+#include <linux/uaccess.h>
+#include <linux/version.h>
+
+#include "decode.h"
+#include "exec.h"
+#include "opdev.h"
+
+/*********************************************************
+ *** Shared VEX decode cache.                          ***
+ *** Entries for read-only executable file mappings    ***
+ *** are keyed by (device, inode, generation, file     ***
+ *** offset), found by translating RIP through its     ***
+ *** VMA, so every process mapping the same library    ***
+ *** shares them. Lookups are RCU; an entry is used    ***
+ *** only if the bytes at RIP still match its copy.    ***
+ *** debugfs opemu/decode_stat, a write flushes it.    ***
+ *** Hot sites of a file are exported and preloaded    ***
+ *** through /dev/opemu for warm starts (opemu-profd). ***
+ *********************************************************/
+
+#if LINUX_VERSION_CODE < KERNEL_VERSION(5,8,0)
+#define mmap_read_trylock(mm)   down_read_trylock(&(mm)->mmap_sem)
+#define mmap_read_unlock(mm)    up_read(&(mm)->mmap_sem)
+#endif
+
+static bool decode_cache = true;
+module_param(decode_cache, bool, 0644);
+MODULE_PARM_DESC(decode_cache, "Share VEX decodes of file-backed code between processes");
+
+struct decode_entry {
+    struct hlist_node node;
+    struct rcu_head rcu;
+    struct decode_key key;
+    struct vex_decode d;
+    uint32_t hits;
+    uint8_t bytes[DECODE_BYTES];
+};
+
+struct decode_stat {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stale;         //key matched, bytes did not
+    uint64_t uncached;      //anonymous, writable or contended mm
+};
+
+static DEFINE_HASHTABLE(decode_hash, DECODE_BITS);
+static DEFINE_SPINLOCK(decode_lock);
+static DEFINE_PER_CPU(struct decode_stat, decode_stats);
+static int decode_count;
+static struct dentry *decode_file;
+
+static inline uint64_t decode_hashkey(const struct decode_key *key)
+{
+    return key->ino ^ ((uint64_t)key->dev << 32) ^ key->generation ^ (key->offset * GOLDEN_RATIO_64);
+}
+
+static inline int decode_same(const struct decode_key *a, const struct decode_key *b)
+{
+    return (a->ino == b->ino) && (a->dev == b->dev) &&
+           (a->generation == b->generation) && (a->offset == b->offset);
+}
+
+//RIP to its file position, never waits for the mmap lock
+static int decode_key(struct pt_regs *regs, struct decode_key *key)
+{
+    struct mm_struct *mm = current->mm;
+    struct vm_area_struct *vma;
+    struct inode *inode;
+    int ok = 0;
+
+    if (!mm || !mmap_read_trylock(mm))
+        return 0;
+
+    vma = find_vma(mm, regs->ip);
+    //MAP_PRIVATE text is VM_MAYWRITE too: a COW-modified page fails the byte compare on a hit
+    if (vma && (vma->vm_start <= regs->ip) && vma->vm_file &&
+        (vma->vm_flags & VM_EXEC) && !(vma->vm_flags & VM_WRITE)) {
+        inode = file_inode(vma->vm_file);
+        key->ino = inode->i_ino;
+        key->dev = inode->i_sb->s_dev;
+        key->generation = inode->i_generation;
+        key->offset = ((uint64_t)vma->vm_pgoff << PAGE_SHIFT) + (regs->ip - vma->vm_start);
+        ok = 1;
+    }
+    mmap_read_unlock(mm);
+
+    return ok;
+}
+
+/** returns 1 with d filled on a hit; on a miss key is ready for opemu_decode_insert. **/
+int opemu_decode_lookup(struct pt_regs *regs, uint8_t *instruction, struct vex_decode *d, struct decode_key *key)
+{
+    struct decode_entry *e;
+    uint8_t cached[DECODE_BYTES];
+    uint8_t code[DECODE_BYTES];
+    int found = 0;
+
+    key->ino = 0;
+    //batch execution: RIP is not in the caller's mappings
+    if (!READ_ONCE(decode_cache) || !is_saved_state64(regs) || opemu_exec_running())
+        return 0;
+    if (!decode_key(regs, key)) {
+        key->ino = 0;
+        this_cpu_inc(decode_stats.uncached);
+        return 0;
+    }
+
+    rcu_read_lock();
+    hash_for_each_possible_rcu(decode_hash, e, node, decode_hashkey(key)) {
+        if (decode_same(&e->key, key)) {
+            *d = e->d;
+            memcpy(cached, e->bytes, sizeof(cached));
+            WRITE_ONCE(e->hits, e->hits + 1);
+            found = 1;
+            break;
+        }
+    }
+    rcu_read_unlock();
+
+    if (!found) {
+        this_cpu_inc(decode_stats.misses);
+        return 0;
+    }
+    if (copy_from_user(code, (void __user *)regs->ip, d->len) || memcmp(code, cached, d->len)) {
+        this_cpu_inc(decode_stats.stale);
+        return 0;
+    }
+
+    this_cpu_inc(decode_stats.hits);
+    return 1;
+}
+
+//add or replace the entry of key, bytes already in kernel memory
+static void decode_add(const struct decode_key *key, const struct vex_decode *d, const uint8_t *bytes, uint32_t hits)
+{
+    struct decode_entry *e, *old = NULL;
+
+    if (READ_ONCE(decode_count) >= DECODE_MAX)
+        return;
+
+    e = kmalloc(sizeof(*e), GFP_KERNEL);
+    if (!e)
+        return;
+    e->key = *key;
+    e->d = *d;
+    e->hits = hits;
+    memset(e->bytes, 0, sizeof(e->bytes));
+    memcpy(e->bytes, bytes, d->len);
+
+    spin_lock(&decode_lock);
+    hash_for_each_possible(decode_hash, old, node, decode_hashkey(key)) {
+        if (decode_same(&old->key, key))
+            break;
+    }
+    if (old) {
+        hlist_replace_rcu(&old->node, &e->node);
+    } else if (decode_count < DECODE_MAX) {
+        hash_add_rcu(decode_hash, &e->node, decode_hashkey(key));
+        decode_count++;
+    } else {
+        spin_unlock(&decode_lock);
+        kfree(e);
+        return;
+    }
+    spin_unlock(&decode_lock);
+
+    if (old)
+        kfree_rcu(old, rcu);
+}
+
+/** Called after a set emulated the instruction. Replaces a stale entry of the same key. **/
+void opemu_decode_insert(const struct decode_key *key, uint8_t *instruction, const struct vex_decode *d)
+{
+    uint8_t bytes[DECODE_BYTES];
+
+    if (!key->ino || (d->len > DECODE_BYTES))
+        return;
+    if (copy_from_user(bytes, (void __user *)instruction, d->len))
+        return;
+
+    decode_add(key, d, bytes, 0);
+}
+
+/**********************************************/
+/**  Hot-site profiles                       **/
+/**********************************************/
+static int decode_fd_key(int fd, struct decode_key *key)
+{
+    struct inode *inode;
+    struct file *file;
+
+    file = fget(fd);
+    if (!file)
+        return -EBADF;
+    inode = file_inode(file);
+    key->ino = inode->i_ino;
+    key->dev = inode->i_sb->s_dev;
+    key->generation = inode->i_generation;
+    key->offset = 0;
+    fput(file);
+
+    return 0;
+}
+
+static int decode_site_cmp(const void *a, const void *b)
+{
+    const struct opemu_profile_site *x = a;
+    const struct opemu_profile_site *y = b;
+
+    return (x->hits < y->hits) - (x->hits > y->hits);
+}
+
+/** OPEMU_IOC_GET_PROFILE: the hottest cached sites of a file. **/
+int opemu_decode_get_profile(void __user *argp)
+{
+    struct opemu_profile_req req;
+    struct opemu_profile_site *sites;
+    struct decode_entry *e;
+    struct decode_key key;
+    uint32_t n = 0;
+    int bkt, err;
+
+    //the hit counts are every process' that maps the file
+    if (!capable(CAP_SYS_ADMIN))
+        return -EPERM;
+    if (copy_from_user(&req, argp, sizeof(req)))
+        return -EFAULT;
+    err = decode_fd_key(req.fd, &key);
+    if (err)
+        return err;
+
+    sites = kvmalloc_array(DECODE_MAX, sizeof(*sites), GFP_KERNEL);
+    if (!sites)
+        return -ENOMEM;
+
+    rcu_read_lock();
+    hash_for_each_rcu(decode_hash, bkt, e, node) {
+        if ((e->key.ino != key.ino) || (e->key.dev != key.dev) || (e->key.generation != key.generation))
+            continue;
+        if (n == DECODE_MAX)
+            break;
+        memset(&sites[n], 0, sizeof(sites[n]));
+        sites[n].offset = e->key.offset;
+        sites[n].hits = READ_ONCE(e->hits);
+        sites[n].len = e->d.len;
+        sites[n].set = e->d.set;
+        memcpy(sites[n].bytes, e->bytes, e->d.len);
+        n++;
+    }
+    rcu_read_unlock();
+
+    sort(sites, n, sizeof(*sites), decode_site_cmp, NULL);
+    n = min3(n, req.count, (uint32_t)OPEMU_PROFILE_MAX);
+
+    err = 0;
+    if (copy_to_user((void __user *)(unsigned long)req.sites, sites, n * sizeof(*sites)))
+        err = -EFAULT;
+    kvfree(sites);
+    if (err)
+        return err;
+
+    req.count = n;
+    if (copy_to_user(argp, &req, sizeof(req)))
+        return -EFAULT;
+    return 0;
+}
+
+/** OPEMU_IOC_LOAD_PROFILE: preload sites of a file, each decoded again here. **/
+int opemu_decode_load_profile(void __user *argp)
+{
+    struct opemu_profile_req req;
+    struct opemu_profile_site *sites;
+    struct vex_decode d;
+    struct decode_key key;
+    uint32_t i, n = 0;
+    int err;
+
+    //entries are shared by every process mapping the file
+    if (!capable(CAP_SYS_ADMIN))
+        return -EPERM;
+    if (copy_from_user(&req, argp, sizeof(req)))
+        return -EFAULT;
+    if (req.count > OPEMU_PROFILE_MAX)
+        return -E2BIG;
+    err = decode_fd_key(req.fd, &key);
+    if (err)
+        return err;
+
+    sites = kvmalloc_array(req.count, sizeof(*sites), GFP_KERNEL);
+    if (!sites)
+        return -ENOMEM;
+    if (copy_from_user(sites, (void __user *)(unsigned long)req.sites, req.count * sizeof(*sites))) {
+        kvfree(sites);
+        return -EFAULT;
+    }
+
+    for (i = 0; i < req.count; i++) {
+        if ((sites[i].len > DECODE_BYTES) || (sites[i].set >= VEX_SET_MAX))
+            continue;
+        if (!vex_decode(sites[i].bytes, &d) || (d.ins_size >= sites[i].len))
+            continue;
+        d.set = sites[i].set;
+        d.len = sites[i].len;
+        key.offset = sites[i].offset;
+        decode_add(&key, &d, sites[i].bytes, 0);
+        n++;
+    }
+    kvfree(sites);
+
+    req.count = n;
+    if (copy_to_user(argp, &req, sizeof(req)))
+        return -EFAULT;
+    return 0;
+}
+
+static void decode_flush(void)
+{
+    struct decode_entry *e;
+    struct hlist_node *tmp;
+    int bkt;
+
+    spin_lock(&decode_lock);
+    hash_for_each_safe(decode_hash, bkt, tmp, e, node) {
+        hash_del_rcu(&e->node);
+        kfree_rcu(e, rcu);
+    }
+    decode_count = 0;
+    spin_unlock(&decode_lock);
+}
+
+/**********************************************/
+/**  debugfs                                 **/
+/**********************************************/
+static int decode_stat_show(struct seq_file *m, void *v)
+{
+    struct decode_stat sum = { 0 };
+    struct decode_stat *st;
+    int cpu;
+
+    for_each_possible_cpu(cpu) {
+        st = per_cpu_ptr(&decode_stats, cpu);
+        sum.hits += st->hits;
+        sum.misses += st->misses;
+        sum.stale += st->stale;
+        sum.uncached += st->uncached;
+    }
+
+    seq_printf(m, "entries %d\nhits %llu\nmisses %llu\nstale %llu\nuncached %llu\n",
+               READ_ONCE(decode_count), (unsigned long long)sum.hits, (unsigned long long)sum.misses,
+               (unsigned long long)sum.stale, (unsigned long long)sum.uncached);
+    return 0;
+}
+
+static int decode_stat_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, decode_stat_show, NULL);
+}
+
+static ssize_t decode_stat_write(struct file *file, const char __user *buf, size_t len, loff_t *ppos)
+{
+    decode_flush();
+    return len;
+}
+
+static const struct file_operations decode_stat_fops = {
+    .owner   = THIS_MODULE,
+    .open    = decode_stat_open,
+    .read    = seq_read,
+    .write   = decode_stat_write,
+    .llseek  = seq_lseek,
+    .release = single_release,
+};
+
+int opemu_decode_init(void)
+{
+    decode_file = debugfs_create_file("decode_stat", 0600, opemu_debugfs, NULL, &decode_stat_fops);
+    return 0;
+}
+
+//after the hooks are gone: no more lookups
+void opemu_decode_exit(void)
+{
+    debugfs_remove(decode_file);
+    decode_flush();
+    rcu_barrier();
+}
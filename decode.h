@@ -0,0 +1,80 @@
+//
+//  decode.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef decode_h
+#define decode_h
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+
+//VEX ISA sets in dispatch order
+enum vex_set {
+    VEX_SET_VAES = 0,
+    VEX_SET_AVX,
+    VEX_SET_VGATHER,
+    VEX_SET_FMA,
+    VEX_SET_F16C,
+    VEX_SET_BMI,
+    VEX_SET_VSSE,
+    VEX_SET_VSSE2,
+    VEX_SET_VSSE3,
+    VEX_SET_VSSSE3,
+    VEX_SET_VSSE41,
+    VEX_SET_VSSE42,
+    VEX_SET_MAX
+};
+
+//A decoded VEX instruction, enough to dispatch it again without decoding
+struct vex_decode {
+    uint8_t set;            //enum vex_set that emulated it
+    uint8_t len;            //instruction length
+    uint8_t ins_size;       //prefix + opcode bytes
+    uint8_t modbyte;
+    uint8_t opcode;
+    uint8_t vexreg;
+    uint8_t high_reg;
+    uint8_t high_index;
+    uint8_t high_base;
+    uint8_t operand_size;
+    uint8_t leading_opcode;
+    uint8_t simd_prefix;
+    uint16_t reg_size;
+};
+
+//Where the instruction lives in its file, ino 0 if not file-backed
+struct decode_key {
+    uint64_t ino;
+    uint32_t dev;
+    uint32_t generation;
+    uint64_t offset;
+};
+
+#define DECODE_BITS 12      //hash buckets
+#define DECODE_MAX  16384   //entries
+#define DECODE_BYTES 15     //longest x86 instruction
+
+int vex_decode(uint8_t *instruction, struct vex_decode *d);
+
+#ifdef __KERNEL__
+
+int opemu_decode_lookup(struct pt_regs *regs, uint8_t *instruction, struct vex_decode *d, struct decode_key *key);
+void opemu_decode_insert(const struct decode_key *key, uint8_t *instruction, const struct vex_decode *d);
+int opemu_decode_get_profile(void __user *argp);
+int opemu_decode_load_profile(void __user *argp);
+int opemu_decode_init(void);
+void opemu_decode_exit(void);
+
+#else
+
+//userspace stub: no shared cache
+#define opemu_decode_lookup(regs, instruction, d, key)  0
+#define opemu_decode_insert(key, instruction, d)        do { } while (0)
+
+#endif
+
+#endif /* decode_h */
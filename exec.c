@@ -0,0 +1,258 @@
+//
+//  exec.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/capability.h>
+#include <linux/mm.h>
+#include <linux/mutex.h>
+#include <linux/percpu.h>
+#include <linux/slab.h>
+#include <linux/timex.h>
+#include <linux/uaccess.h>
+#include <asm/fpu/api.h>
+
+#include "optrap.h"
+#include "exec.h"
+
+/*********************************************************
+ *** Batch execution for OPEMU_IOC_EXEC.               ***
+ *** Runs instruction bytes through rex_ins/vex_ins,   ***
+ *** the handlers of the trap path, on a register      ***
+ *** image inside kernel_fpu_begin, published as this  ***
+ *** CPU's XMM file where traps have one (OPEMU_XFILE) ***
+ *** and in the registers where they do not, and on a  ***
+ *** kernel copy of the memory window. Every           ***
+ *** memory operand goes through opemu_exec_addr: in   ***
+ *** the window it is moved to the copy, outside it    ***
+ *** hits a scratch sink and ends the batch. No trap,  ***
+ *** no loop or fused emulation: one instruction per   ***
+ *** step, TSC cycles per step.                        ***
+ *********************************************************/
+
+DEFINE_STATIC_KEY_FALSE(opemu_exec_key);
+
+struct exec_ctx {
+    uint8_t *win;
+    uint64_t base;
+    uint64_t len;
+    uint64_t fault;
+    int faulted;
+    uint8_t xmm[16][16] __aligned(16);
+    uint8_t sink[EXEC_SLACK] __aligned(16);
+};
+
+static DEFINE_PER_CPU(struct exec_ctx *, exec_ctxs);
+//one batch at a time, they share the virtual YMM upper halves
+static DEFINE_MUTEX(exec_mutex);
+
+uint64_t __opemu_exec_addr(uint64_t addr)
+{
+    struct exec_ctx *ctx = this_cpu_read(exec_ctxs);
+
+    //preemption is off for the whole batch, a trap elsewhere sees NULL
+    if (!ctx)
+        return addr;
+    if (addr - ctx->base < ctx->len)
+        return (uint64_t)(ctx->win + (addr - ctx->base));
+    if (!ctx->faulted) {
+        ctx->faulted = 1;
+        ctx->fault = addr;
+    }
+    return (uint64_t)ctx->sink;
+}
+
+int __opemu_exec_running(void)
+{
+    return this_cpu_read(exec_ctxs) != NULL;
+}
+
+//64-bit code only, the window copy does not fit a 32-bit address
+static void exec_regs_in(struct pt_regs *regs, const struct opemu_trace_regs *r)
+{
+    regs->r15 = r->r15;
+    regs->r14 = r->r14;
+    regs->r13 = r->r13;
+    regs->r12 = r->r12;
+    regs->bp = r->bp;
+    regs->bx = r->bx;
+    regs->r11 = r->r11;
+    regs->r10 = r->r10;
+    regs->r9 = r->r9;
+    regs->r8 = r->r8;
+    regs->ax = r->ax;
+    regs->cx = r->cx;
+    regs->dx = r->dx;
+    regs->si = r->si;
+    regs->di = r->di;
+    regs->orig_ax = r->orig_ax;
+    regs->ip = r->ip;
+    regs->cs = __USER_CS;
+    regs->flags = r->flags;
+    regs->sp = r->sp;
+    regs->ss = __USER_DS;
+}
+
+static void exec_regs_out(struct opemu_trace_regs *r, const struct pt_regs *regs)
+{
+    r->r15 = regs->r15;
+    r->r14 = regs->r14;
+    r->r13 = regs->r13;
+    r->r12 = regs->r12;
+    r->bp = regs->bp;
+    r->bx = regs->bx;
+    r->r11 = regs->r11;
+    r->r10 = regs->r10;
+    r->r9 = regs->r9;
+    r->r8 = regs->r8;
+    r->ax = regs->ax;
+    r->cx = regs->cx;
+    r->dx = regs->dx;
+    r->si = regs->si;
+    r->di = regs->di;
+    r->orig_ax = regs->orig_ax;
+    r->ip = regs->ip;
+    r->cs = regs->cs;
+    r->flags = regs->flags;
+    r->sp = regs->sp;
+    r->ss = regs->ss;
+}
+
+//inside kernel_fpu_begin: the handlers see the image as a trap would, nothing of the caller's
+static int exec_run(struct exec_ctx *ctx, struct opemu_exec_state *st, uint8_t *code, uint32_t code_len,
+                    uint32_t max, uint64_t *cycles, uint32_t *count)
+{
+    uint8_t saved[16][16];
+    struct pt_regs regs;
+    uint64_t start, end;
+    uint32_t off = 0, n;
+    int bytes, err = 0;
+    uint8_t i;
+
+    exec_regs_in(&regs, &st->regs);
+    opemu_xfile_enter(ctx->xmm);
+    for (i = 0; i < 16; i++) {
+        _copy_u128(saved[i], &_vymm(i)->u128[1]);
+        _load_ymm(i, (YMM*)st->ymm[i]);
+    }
+    asm __volatile__ ("ldmxcsr %0" :: "m" (st->mxcsr));
+
+    this_cpu_write(exec_ctxs, ctx);
+    for (n = 0; (n < max) && (off < code_len); n++) {
+        start = get_cycles();
+        bytes = rex_ins(&code[off], &regs);
+        if (!bytes)
+            bytes = vex_ins(&code[off], &regs);
+        end = get_cycles();
+
+        if (ctx->faulted) {
+            err = -EFAULT;
+            break;
+        }
+        if (!bytes) {
+            err = -EILSEQ;
+            break;
+        }
+        if (cycles)
+            cycles[n] = end - start;
+        regs.ip += bytes;
+        off += bytes;
+    }
+    this_cpu_write(exec_ctxs, NULL);
+    *count = n;
+
+    asm __volatile__ ("stmxcsr %0" : "=m" (st->mxcsr));
+    for (i = 0; i < 16; i++) {
+        _store_ymm(i, (YMM*)st->ymm[i]);
+        _copy_u128(&_vymm(i)->u128[1], saved[i]);
+    }
+    opemu_xfile_leave();
+    exec_regs_out(&st->regs, &regs);
+
+    return err;
+}
+
+/** One batch on kernel buffers, win holds len + EXEC_SLACK bytes. returns 0 or -errno. **/
+int opemu_exec_batch(struct opemu_exec_state *st, uint8_t *code, uint32_t code_len, uint32_t max,
+                     uint8_t *win, uint64_t base, uint32_t len, uint64_t *cycles, uint32_t *count, uint64_t *fault)
+{
+    struct exec_ctx *ctx;
+    int err;
+
+    ctx = kzalloc(sizeof(*ctx), GFP_KERNEL);
+    if (!ctx)
+        return -ENOMEM;
+    ctx->win = win;
+    ctx->base = base;
+    ctx->len = len;
+
+    mutex_lock(&exec_mutex);
+    static_branch_inc(&opemu_exec_key);
+    kernel_fpu_begin();
+    err = exec_run(ctx, st, code, code_len, max, cycles, count);
+    kernel_fpu_end();
+    static_branch_dec(&opemu_exec_key);
+    mutex_unlock(&exec_mutex);
+
+    *fault = ctx->fault;
+    kfree(ctx);
+    return err;
+}
+
+/** OPEMU_IOC_EXEC, CAP_SYS_ADMIN. returns 0 or -errno, the outputs are copied back either way. **/
+int opemu_exec(void __user *argp)
+{
+    struct opemu_exec_req req;
+    struct opemu_exec_state *st = NULL;
+    uint64_t *cycles = NULL;
+    uint8_t *code = NULL;
+    uint8_t *win = NULL;
+    uint32_t max;
+    int err;
+
+    if (!capable(CAP_SYS_ADMIN))
+        return -EPERM;
+    if (copy_from_user(&req, argp, sizeof(req)))
+        return -EFAULT;
+    if (!req.code_len || (req.code_len > OPEMU_EXEC_CODE) || (req.mem_len > OPEMU_EXEC_MEM))
+        return -EINVAL;
+    max = (req.count && (req.count < req.code_len)) ? req.count : req.code_len;
+
+    err = -ENOMEM;
+    //zero tail: the decoders look past the last instruction
+    code = kzalloc(req.code_len + 16, GFP_KERNEL);
+    st = kmalloc(sizeof(*st), GFP_KERNEL);
+    win = kvzalloc(req.mem_len + EXEC_SLACK, GFP_KERNEL);
+    if (!code || !st || !win)
+        goto out;
+    if (req.cycles) {
+        cycles = kvmalloc_array(max, sizeof(*cycles), GFP_KERNEL | __GFP_ZERO);
+        if (!cycles)
+            goto out;
+    }
+
+    err = -EFAULT;
+    if (copy_from_user(code, u64_to_user_ptr(req.code), req.code_len) ||
+        copy_from_user(st, u64_to_user_ptr(req.state), sizeof(*st)) ||
+        copy_from_user(win, u64_to_user_ptr(req.mem), req.mem_len))
+        goto out;
+
+    err = opemu_exec_batch(st, code, req.code_len, max, win, req.mem_base, req.mem_len,
+                           cycles, &req.count, &req.fault);
+
+    if (copy_to_user(u64_to_user_ptr(req.state), st, sizeof(*st)) ||
+        copy_to_user(u64_to_user_ptr(req.mem), win, req.mem_len) ||
+        (cycles && copy_to_user(u64_to_user_ptr(req.cycles), cycles, req.count * sizeof(*cycles))) ||
+        copy_to_user(argp, &req, sizeof(req)))
+        err = -EFAULT;
+
+out:
+    kvfree(cycles);
+    kvfree(win);
+    kfree(st);
+    kfree(code);
+    return err;
+}
@@ -0,0 +1,45 @@
+//
+//  exec.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef exec_h
+#define exec_h
+
+#include "opemu_ioctl.h"
+
+#ifdef __KERNEL__
+
+#include <linux/jump_label.h>
+
+//widest single access past the window end: a YMM operand
+#define EXEC_SLACK 64
+
+DECLARE_STATIC_KEY_FALSE(opemu_exec_key);
+
+uint64_t __opemu_exec_addr(uint64_t addr);
+int __opemu_exec_running(void);
+
+//memory operand address as the handlers dereference it, in the batch window while one runs
+#define opemu_exec_addr(addr) \
+    (static_branch_unlikely(&opemu_exec_key) ? __opemu_exec_addr(addr) : (addr))
+//1 while this CPU runs a batch for OPEMU_IOC_EXEC
+#define opemu_exec_running() \
+    (static_branch_unlikely(&opemu_exec_key) ? __opemu_exec_running() : 0)
+
+int opemu_exec_batch(struct opemu_exec_state *st, uint8_t *code, uint32_t code_len, uint32_t max,
+                     uint8_t *win, uint64_t base, uint32_t len, uint64_t *cycles, uint32_t *count, uint64_t *fault);
+int opemu_exec(void __user *argp);
+
+#else
+
+//userspace stub: addresses are used as they are
+#define opemu_exec_addr(addr)   (addr)
+#define opemu_exec_running()    0
+
+#endif
+
+#endif /* exec_h */
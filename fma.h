@@ -11,6 +11,7 @@
 
 #include "optrap.h"
 #include "fpins.h"
+#include "fpops.h"
 
 int fma_instruction(struct pt_regs *regs,
                     uint8_t vexreg,
@@ -34,231 +35,177 @@ int fma_instruction(struct pt_regs *regs,
 /************************** vfmadd pd/ps **************************/
 static inline void vfmadd132pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = src1.fa64[i] * src3.fa64[i] + src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i], src3.u64[i], src2.u64[i]);
     }
 }
 static inline void vfmadd132pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src1.fa64[i] * src3.fa64[i] + src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i], src3.u64[i], src2.u64[i]);
     }
 }
 
 static inline void vfmadd213pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src1.fa64[i] + src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src1.u64[i], src3.u64[i]);
     }
 }
 static inline void vfmadd213pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src1.fa64[i] + src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src1.u64[i], src3.u64[i]);
     }
 }
 
 static inline void vfmadd231pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src3.fa64[i] + src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src3.u64[i], src1.u64[i]);
     }
 }
 static inline void vfmadd231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src3.fa64[i] + src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src3.u64[i], src1.u64[i]);
     }
 }
 
 static inline void vfmadd132ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] + src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i]);
     }
 }
 static inline void vfmadd132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] + src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i]);
     }
 }
 
 static inline void vfmadd213ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] + src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i]);
     }
 }
 static inline void vfmadd213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] + src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i]);
     }
 }
 
 static inline void vfmadd231ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] + src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i]);
     }
 }
 static inline void vfmadd231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] + src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i]);
     }
 }
 
 /************************** vfmadd sd/ss **************************/
 static inline void vfmadd132sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = src1.fa64[0] * src3.fa64[0] + src2.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src1.u64[0], src3.u64[0], src2.u64[0]);
 }
 static inline void vfmadd213sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = src2.fa64[0] * src1.fa64[0] + src3.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src1.u64[0], src3.u64[0]);
 }
 static inline void vfmadd231sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = src2.fa64[0] * src3.fa64[0] + src1.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src3.u64[0], src1.u64[0]);
 }
 
 static inline void vfmadd132ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = src1.fa32[0] * src3.fa32[0] + src2.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src1.u32[0], src3.u32[0], src2.u32[0]);
 }
 static inline void vfmadd213ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = src2.fa32[0] * src1.fa32[0] + src3.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0], src1.u32[0], src3.u32[0]);
 }
 static inline void vfmadd231ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = src2.fa32[0] * src3.fa32[0] + src1.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0], src3.u32[0], src1.u32[0]);
 }
 
 /************************** vfmaddsub pd/ps **************************/
 static inline void vfmaddsub132pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     
-    TMP.fa64[0] = src1.fa64[0] * src3.fa64[0] - src2.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
-    TMP.fa64[1] = src1.fa64[1] * src3.fa64[1] + src2.fa64[1];
-    res->fa64[1] = round_fp64(TMP.fa64[1], rc);
+    res->u64[0] = fp64_fma(src1.u64[0], src3.u64[0], src2.u64[0] ^ SF_SIGN64);
+    res->u64[1] = fp64_fma(src1.u64[1], src3.u64[1], src2.u64[1]);
 }
 
 static inline void vfmaddsub132pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src1.fa64[i] * src3.fa64[i] - src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i], src3.u64[i], src2.u64[i] ^ SF_SIGN64);
         
-        TMP.fa64[i+1] = src1.fa64[i+1] * src3.fa64[i+1] + src2.fa64[i+1];
-        res->fa64[i+1] = round_fp64(TMP.fa64[i+1], rc);
+        res->u64[i+1] = fp64_fma(src1.u64[i+1], src3.u64[i+1], src2.u64[i+1]);
 
         i++;
     }
 }
 
 static inline void vfmaddsub213pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     
-    TMP.fa64[0] = src2.fa64[0] * src1.fa64[0] - src3.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
-    TMP.fa64[1] = src2.fa64[1] * src1.fa64[1] + src3.fa64[1];
-    res->fa64[1] = round_fp64(TMP.fa64[1], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src1.u64[0], src3.u64[0] ^ SF_SIGN64);
+    res->u64[1] = fp64_fma(src2.u64[1], src1.u64[1], src3.u64[1]);
 }
 
 static inline void vfmaddsub213pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src1.fa64[i] - src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src1.u64[i], src3.u64[i] ^ SF_SIGN64);
         
-        TMP.fa64[i+1] = src2.fa64[i+1] * src1.fa64[i+1] + src3.fa64[i+1];
-        res->fa64[i+1] = round_fp64(TMP.fa64[i+1], rc);
+        res->u64[i+1] = fp64_fma(src2.u64[i+1], src1.u64[i+1], src3.u64[i+1]);
         
         i++;
     }
 }
 
 static inline void vfmaddsub231pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     
-    TMP.fa64[0] = src2.fa64[0] * src3.fa64[0] - src1.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
-    TMP.fa64[1] = src2.fa64[1] * src3.fa64[1] + src1.fa64[1];
-    res->fa64[1] = round_fp64(TMP.fa64[1], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src3.u64[0], src1.u64[0] ^ SF_SIGN64);
+    res->u64[1] = fp64_fma(src2.u64[1], src3.u64[1], src1.u64[1]);
 }
 
 static inline void vfmaddsub231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src3.fa64[i] - src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src3.u64[i], src1.u64[i] ^ SF_SIGN64);
         
-        TMP.fa64[i+1] = src2.fa64[i+1] * src3.fa64[i+1] + src1.fa64[i+1];
-        res->fa64[i+1] = round_fp64(TMP.fa64[i+1], rc);
+        res->u64[i+1] = fp64_fma(src2.u64[i+1], src3.u64[i+1], src1.u64[i+1]);
         
         i++;
     }
@@ -266,28 +213,22 @@ static inline void vfmaddsub231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 
 static inline void vfmaddsub132ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] - src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i] ^ SF_SIGN32);
         
-        TMP.fa32[i+1] = src1.fa32[i+1] * src3.fa32[i+1] + src2.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src1.u32[i+1], src3.u32[i+1], src2.u32[i+1]);
         
         i++;
     }
 }
 static inline void vfmaddsub132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] - src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i] ^ SF_SIGN32);
         
-        TMP.fa32[i+1] = src1.fa32[i+1] * src3.fa32[i+1] + src2.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src1.u32[i+1], src3.u32[i+1], src2.u32[i+1]);
         
         i++;
     }
@@ -295,28 +236,22 @@ static inline void vfmaddsub132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 
 static inline void vfmaddsub213ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] - src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i] ^ SF_SIGN32);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src1.fa32[i+1] + src3.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src1.u32[i+1], src3.u32[i+1]);
         
         i++;
     }
 }
 static inline void vfmaddsub213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] - src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i] ^ SF_SIGN32);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src1.fa32[i+1] + src3.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src1.u32[i+1], src3.u32[i+1]);
         
         i++;
     }
@@ -324,28 +259,22 @@ static inline void vfmaddsub213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 
 static inline void vfmaddsub231ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] - src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i] ^ SF_SIGN32);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src3.fa32[i+1] + src1.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src3.u32[i+1], src1.u32[i+1]);
         
         i++;
     }
 }
 static inline void vfmaddsub231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] - src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i] ^ SF_SIGN32);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src3.fa32[i+1] + src1.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src3.u32[i+1], src1.u32[i+1]);
         
         i++;
     }
@@ -354,231 +283,177 @@ static inline void vfmaddsub231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 /************************** vfmsub pd/ps **************************/
 static inline void vfmsub132pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = src1.fa64[i] * src3.fa64[i] - src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i], src3.u64[i], src2.u64[i] ^ SF_SIGN64);
     }
 }
 static inline void vfmsub132pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src1.fa64[i] * src3.fa64[i] - src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i], src3.u64[i], src2.u64[i] ^ SF_SIGN64);
     }
 }
 
 static inline void vfmsub213pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src1.fa64[i] - src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src1.u64[i], src3.u64[i] ^ SF_SIGN64);
     }
 }
 static inline void vfmsub213pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src1.fa64[i] - src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src1.u64[i], src3.u64[i] ^ SF_SIGN64);
     }
 }
 
 static inline void vfmsub231pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src3.fa64[i] - src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src3.u64[i], src1.u64[i] ^ SF_SIGN64);
     }
 }
 static inline void vfmsub231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src3.fa64[i] - src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src3.u64[i], src1.u64[i] ^ SF_SIGN64);
     }
 }
 
 static inline void vfmsub132ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] - src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i] ^ SF_SIGN32);
     }
 }
 static inline void vfmsub132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] - src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i] ^ SF_SIGN32);
     }
 }
 
 static inline void vfmsub213ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] - src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i] ^ SF_SIGN32);
     }
 }
 static inline void vfmsub213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] - src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i] ^ SF_SIGN32);
     }
 }
 
 static inline void vfmsub231ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] - src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i] ^ SF_SIGN32);
     }
 }
 static inline void vfmsub231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] - src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i] ^ SF_SIGN32);
     }
 }
 
 /************************** vfmsub sd/ss **************************/
 static inline void vfmsub132sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = src1.fa64[0] * src3.fa64[0] - src2.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src1.u64[0], src3.u64[0], src2.u64[0] ^ SF_SIGN64);
 }
 static inline void vfmsub213sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = src2.fa64[0] * src1.fa64[0] - src3.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src1.u64[0], src3.u64[0] ^ SF_SIGN64);
 }
 static inline void vfmsub231sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = src2.fa64[0] * src3.fa64[0] - src1.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src3.u64[0], src1.u64[0] ^ SF_SIGN64);
 }
 
 static inline void vfmsub132ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = src1.fa32[0] * src3.fa32[0] - src2.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src1.u32[0], src3.u32[0], src2.u32[0] ^ SF_SIGN32);
 }
 static inline void vfmsub213ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = src2.fa32[0] * src1.fa32[0] - src3.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0], src1.u32[0], src3.u32[0] ^ SF_SIGN32);
 }
 static inline void vfmsub231ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = src2.fa32[0] * src3.fa32[0] - src1.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0], src3.u32[0], src1.u32[0] ^ SF_SIGN32);
 }
 
 /************************** vfmsubadd pd/ps **************************/
 static inline void vfmsubadd132pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     
-    TMP.fa64[0] = src1.fa64[0] * src3.fa64[0] + src2.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
-    TMP.fa64[1] = src1.fa64[1] * src3.fa64[1] - src2.fa64[1];
-    res->fa64[1] = round_fp64(TMP.fa64[1], rc);
+    res->u64[0] = fp64_fma(src1.u64[0], src3.u64[0], src2.u64[0]);
+    res->u64[1] = fp64_fma(src1.u64[1], src3.u64[1], src2.u64[1] ^ SF_SIGN64);
 }
 
 static inline void vfmsubadd132pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src1.fa64[i] * src3.fa64[i] + src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i], src3.u64[i], src2.u64[i]);
         
-        TMP.fa64[i+1] = src1.fa64[i+1] * src3.fa64[i+1] - src2.fa64[i+1];
-        res->fa64[i+1] = round_fp64(TMP.fa64[i+1], rc);
+        res->u64[i+1] = fp64_fma(src1.u64[i+1], src3.u64[i+1], src2.u64[i+1] ^ SF_SIGN64);
         
         i++;
     }
 }
 
 static inline void vfmsubadd213pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     
-    TMP.fa64[0] = src2.fa64[0] * src1.fa64[0] + src3.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
-    TMP.fa64[1] = src2.fa64[1] * src1.fa64[1] - src3.fa64[1];
-    res->fa64[1] = round_fp64(TMP.fa64[1], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src1.u64[0], src3.u64[0]);
+    res->u64[1] = fp64_fma(src2.u64[1], src1.u64[1], src3.u64[1] ^ SF_SIGN64);
 }
 
 static inline void vfmsubadd213pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src1.fa64[i] + src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src1.u64[i], src3.u64[i]);
         
-        TMP.fa64[i+1] = src2.fa64[i+1] * src1.fa64[i+1] - src3.fa64[i+1];
-        res->fa64[i+1] = round_fp64(TMP.fa64[i+1], rc);
+        res->u64[i+1] = fp64_fma(src2.u64[i+1], src1.u64[i+1], src3.u64[i+1] ^ SF_SIGN64);
         
         i++;
     }
 }
 
 static inline void vfmsubadd231pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     
-    TMP.fa64[0] = src2.fa64[0] * src3.fa64[0] + src1.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
-    TMP.fa64[1] = src2.fa64[1] * src3.fa64[1] - src1.fa64[1];
-    res->fa64[1] = round_fp64(TMP.fa64[1], rc);
+    res->u64[0] = fp64_fma(src2.u64[0], src3.u64[0], src1.u64[0]);
+    res->u64[1] = fp64_fma(src2.u64[1], src3.u64[1], src1.u64[1] ^ SF_SIGN64);
 }
 
 static inline void vfmsubadd231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = src2.fa64[i] * src3.fa64[i] + src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i], src3.u64[i], src1.u64[i]);
         
-        TMP.fa64[i+1] = src2.fa64[i+1] * src3.fa64[i+1] - src1.fa64[i+1];
-        res->fa64[i+1] = round_fp64(TMP.fa64[i+1], rc);
+        res->u64[i+1] = fp64_fma(src2.u64[i+1], src3.u64[i+1], src1.u64[i+1] ^ SF_SIGN64);
         
         i++;
     }
@@ -586,28 +461,22 @@ static inline void vfmsubadd231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 
 static inline void vfmsubadd132ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] + src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i]);
         
-        TMP.fa32[i+1] = src1.fa32[i+1] * src3.fa32[i+1] - src2.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src1.u32[i+1], src3.u32[i+1], src2.u32[i+1] ^ SF_SIGN32);
         
         i++;
     }
 }
 static inline void vfmsubadd132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src1.fa32[i] * src3.fa32[i] + src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i], src3.u32[i], src2.u32[i]);
         
-        TMP.fa32[i+1] = src1.fa32[i+1] * src3.fa32[i+1] - src2.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src1.u32[i+1], src3.u32[i+1], src2.u32[i+1] ^ SF_SIGN32);
         
         i++;
     }
@@ -615,28 +484,22 @@ static inline void vfmsubadd132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 
 static inline void vfmsubadd213ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] + src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i]);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src1.fa32[i+1] - src3.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src1.u32[i+1], src3.u32[i+1] ^ SF_SIGN32);
         
         i++;
     }
 }
 static inline void vfmsubadd213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src1.fa32[i] + src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src1.u32[i], src3.u32[i]);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src1.fa32[i+1] - src3.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src1.u32[i+1], src3.u32[i+1] ^ SF_SIGN32);
         
         i++;
     }
@@ -644,28 +507,22 @@ static inline void vfmsubadd213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 
 static inline void vfmsubadd231ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] + src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i]);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src3.fa32[i+1] - src1.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src3.u32[i+1], src1.u32[i+1] ^ SF_SIGN32);
         
         i++;
     }
 }
 static inline void vfmsubadd231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = src2.fa32[i] * src3.fa32[i] + src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i], src3.u32[i], src1.u32[i]);
         
-        TMP.fa32[i+1] = src2.fa32[i+1] * src3.fa32[i+1] - src1.fa32[i+1];
-        res->fa32[i+1] = round_fp32(TMP.fa32[i+1], rc);
+        res->u32[i+1] = fp32_fma(src2.u32[i+1], src3.u32[i+1], src1.u32[i+1] ^ SF_SIGN32);
         
         i++;
     }
@@ -674,321 +531,249 @@ static inline void vfmsubadd231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, in
 /************************** vfnmadd pd/ps **************************/
 static inline void vfnmadd132pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = -(src1.fa64[i] * src3.fa64[i]) + src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i] ^ SF_SIGN64, src3.u64[i], src2.u64[i]);
     }
 }
 static inline void vfnmadd132pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = -(src1.fa64[i] * src3.fa64[i]) + src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i] ^ SF_SIGN64, src3.u64[i], src2.u64[i]);
     }
 }
 
 static inline void vfnmadd213pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src1.fa64[i]) + src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src1.u64[i], src3.u64[i]);
     }
 }
 static inline void vfnmadd213pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src1.fa64[i]) + src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src1.u64[i], src3.u64[i]);
     }
 }
 
 static inline void vfnmadd231pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src3.fa64[i]) + src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src3.u64[i], src1.u64[i]);
     }
 }
 static inline void vfnmadd231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src3.fa64[i]) + src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src3.u64[i], src1.u64[i]);
     }
 }
 
 static inline void vfnmadd132ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = -(src1.fa32[i] * src3.fa32[i]) + src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i] ^ SF_SIGN32, src3.u32[i], src2.u32[i]);
     }
 }
 static inline void vfnmadd132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = -(src1.fa32[i] * src3.fa32[i]) + src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i] ^ SF_SIGN32, src3.u32[i], src2.u32[i]);
     }
 }
 
 static inline void vfnmadd213ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src1.fa32[i]) + src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src1.u32[i], src3.u32[i]);
     }
 }
 static inline void vfnmadd213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src1.fa32[i]) + src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src1.u32[i], src3.u32[i]);
     }
 }
 
 static inline void vfnmadd231ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src3.fa32[i]) + src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src3.u32[i], src1.u32[i]);
     }
 }
 static inline void vfnmadd231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src3.fa32[i]) + src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src3.u32[i], src1.u32[i]);
     }
 }
 
 /************************** vfnmadd sd/ss **************************/
 static inline void vfnmadd132sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = -(src1.fa64[0] * src3.fa64[0]) + src2.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src1.u64[0] ^ SF_SIGN64, src3.u64[0], src2.u64[0]);
 }
 static inline void vfnmadd213sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = -(src2.fa64[0] * src1.fa64[0]) + src3.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0] ^ SF_SIGN64, src1.u64[0], src3.u64[0]);
 }
 static inline void vfnmadd231sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = -(src2.fa64[0] * src3.fa64[0]) + src1.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0] ^ SF_SIGN64, src3.u64[0], src1.u64[0]);
 }
 
 static inline void vfnmadd132ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = -(src1.fa32[0] * src3.fa32[0]) + src2.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src1.u32[0] ^ SF_SIGN32, src3.u32[0], src2.u32[0]);
 }
 static inline void vfnmadd213ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = -(src2.fa32[0] * src1.fa32[0]) + src3.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0] ^ SF_SIGN32, src1.u32[0], src3.u32[0]);
 }
 static inline void vfnmadd231ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = -(src2.fa32[0] * src3.fa32[0]) + src1.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0] ^ SF_SIGN32, src3.u32[0], src1.u32[0]);
 }
 
 /************************** vfnmsub pd/ps **************************/
 static inline void vfnmsub132pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = -(src1.fa64[i] * src3.fa64[i]) - src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i] ^ SF_SIGN64, src3.u64[i], src2.u64[i] ^ SF_SIGN64);
     }
 }
 static inline void vfnmsub132pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = -(src1.fa64[i] * src3.fa64[i]) - src2.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src1.u64[i] ^ SF_SIGN64, src3.u64[i], src2.u64[i] ^ SF_SIGN64);
     }
 }
 
 static inline void vfnmsub213pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src1.fa64[i]) - src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src1.u64[i], src3.u64[i] ^ SF_SIGN64);
     }
 }
 static inline void vfnmsub213pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src1.fa64[i]) - src3.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src1.u64[i], src3.u64[i] ^ SF_SIGN64);
     }
 }
 
 static inline void vfnmsub231pd_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 2; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src3.fa64[i]) - src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src3.u64[i], src1.u64[i] ^ SF_SIGN64);
     }
 }
 static inline void vfnmsub231pd_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa64[i] = -(src2.fa64[i] * src3.fa64[i]) - src1.fa64[i];
-        res->fa64[i] = round_fp64(TMP.fa64[i], rc);
+        res->u64[i] = fp64_fma(src2.u64[i] ^ SF_SIGN64, src3.u64[i], src1.u64[i] ^ SF_SIGN64);
     }
 }
 
 static inline void vfnmsub132ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = -(src1.fa32[i] * src3.fa32[i]) - src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i] ^ SF_SIGN32, src3.u32[i], src2.u32[i] ^ SF_SIGN32);
     }
 }
 static inline void vfnmsub132ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = -(src1.fa32[i] * src3.fa32[i]) - src2.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src1.u32[i] ^ SF_SIGN32, src3.u32[i], src2.u32[i] ^ SF_SIGN32);
     }
 }
 
 static inline void vfnmsub213ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src1.fa32[i]) - src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src1.u32[i], src3.u32[i] ^ SF_SIGN32);
     }
 }
 static inline void vfnmsub213ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src1.fa32[i]) - src3.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src1.u32[i], src3.u32[i] ^ SF_SIGN32);
     }
 }
 
 static inline void vfnmsub231ps_128(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
     int i;
-    XMM TMP;
     
     for (i = 0; i < 4; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src3.fa32[i]) - src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src3.u32[i], src1.u32[i] ^ SF_SIGN32);
     }
 }
 static inline void vfnmsub231ps_256(YMM src3, YMM src2, YMM src1, YMM *res, int rc) {
     int i;
-    YMM TMP;
     
     for (i = 0; i < 8; ++i) {
-        TMP.fa32[i] = -(src2.fa32[i] * src3.fa32[i]) - src1.fa32[i];
-        res->fa32[i] = round_fp32(TMP.fa32[i], rc);
+        res->u32[i] = fp32_fma(src2.u32[i] ^ SF_SIGN32, src3.u32[i], src1.u32[i] ^ SF_SIGN32);
     }
 }
 
 /************************** vfnmsub sd/ss **************************/
 static inline void vfnmsub132sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = -(src1.fa64[0] * src3.fa64[0]) - src2.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src1.u64[0] ^ SF_SIGN64, src3.u64[0], src2.u64[0] ^ SF_SIGN64);
 }
 static inline void vfnmsub213sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = -(src2.fa64[0] * src1.fa64[0]) - src3.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0] ^ SF_SIGN64, src1.u64[0], src3.u64[0] ^ SF_SIGN64);
 }
 static inline void vfnmsub231sd(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa64[0] = -(src2.fa64[0] * src3.fa64[0]) - src1.fa64[0];
-    res->fa64[0] = round_fp64(TMP.fa64[0], rc);
+    res->u64[0] = fp64_fma(src2.u64[0] ^ SF_SIGN64, src3.u64[0], src1.u64[0] ^ SF_SIGN64);
 }
 
 static inline void vfnmsub132ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = -(src1.fa32[0] * src3.fa32[0]) - src2.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src1.u32[0] ^ SF_SIGN32, src3.u32[0], src2.u32[0] ^ SF_SIGN32);
 }
 static inline void vfnmsub213ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = -(src2.fa32[0] * src1.fa32[0]) - src3.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0] ^ SF_SIGN32, src1.u32[0], src3.u32[0] ^ SF_SIGN32);
 }
 static inline void vfnmsub231ss(XMM src3, XMM src2, XMM src1, XMM *res, int rc) {
-    XMM TMP;
     res->u128 = src1.u128;
     
-    TMP.fa32[0] = -(src2.fa32[0] * src3.fa32[0]) - src1.fa32[0];
-    res->fa32[0] = round_fp32(TMP.fa32[0], rc);
+    res->u32[0] = fp32_fma(src2.u32[0] ^ SF_SIGN32, src3.u32[0], src1.u32[0] ^ SF_SIGN32);
 }
 
 #endif /* fma_h */
@@ -0,0 +1,206 @@
+//
+//  fpcmp.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef fpcmp_h
+#define fpcmp_h
+
+#include "optrap.h"
+#include "softfloat.h"
+
+/*********************************************************
+ *** vcmpps/pd/ss/sd and (u)comiss/sd.                 ***
+ *** Each of the 32 AVX predicates is the native SSE   ***
+ *** predicate imm & 7 plus a fixup: OR or AND-NOT     ***
+ *** the unordered mask for 8-15, and for 16-31 the    ***
+ *** opposite QNaN signaling: an extra discarded       ***
+ *** signaling compare, or MXCSR put back around the   ***
+ *** signaling base with the quiet unordered compare   ***
+ *** raising the SNaN/denormal flags. Executed per     ***
+ *** 128-bit half with cmpps/cmppd, EFLAGS from native ***
+ *** (u)comis. soft_fp=1 maps the softfloat relation   ***
+ *** through the predicate's truth table instead.      ***
+ *********************************************************/
+
+#define FPCMP_OR     0x01   //| unordered
+#define FPCMP_ANDN   0x02   //& ~unordered
+#define FPCMP_SIGNAL 0x04   //IE on QNaN, base is quiet
+#define FPCMP_QUIET  0x08   //no IE on QNaN, base signals
+
+struct fpcmp_pred {
+    uint8_t base;       //cmpps imm8 0-7
+    uint8_t fix;
+    uint8_t truth;      //bit SF_LT/EQ/GT/UN set where true
+    uint8_t signaling;
+};
+
+static const struct fpcmp_pred fpcmp_preds[32] = {
+    { 0, 0,                          0x2, 0 },   //EQ_OQ
+    { 1, 0,                          0x1, 1 },   //LT_OS
+    { 2, 0,                          0x3, 1 },   //LE_OS
+    { 3, 0,                          0x8, 0 },   //UNORD_Q
+    { 4, 0,                          0xD, 0 },   //NEQ_UQ
+    { 5, 0,                          0xE, 1 },   //NLT_US
+    { 6, 0,                          0xC, 1 },   //NLE_US
+    { 7, 0,                          0x7, 0 },   //ORD_Q
+    { 0, FPCMP_OR,                   0xA, 0 },   //EQ_UQ
+    { 1, FPCMP_OR,                   0x9, 1 },   //NGE_US
+    { 2, FPCMP_OR,                   0xB, 1 },   //NGT_US
+    { 3, FPCMP_ANDN,                 0x0, 0 },   //FALSE_OQ
+    { 4, FPCMP_ANDN,                 0x5, 0 },   //NEQ_OQ
+    { 5, FPCMP_ANDN,                 0x6, 1 },   //GE_OS
+    { 6, FPCMP_ANDN,                 0x4, 1 },   //GT_OS
+    { 7, FPCMP_OR,                   0xF, 0 },   //TRUE_UQ
+    { 0, FPCMP_SIGNAL,               0x2, 1 },   //EQ_OS
+    { 1, FPCMP_QUIET,                0x1, 0 },   //LT_OQ
+    { 2, FPCMP_QUIET,                0x3, 0 },   //LE_OQ
+    { 3, FPCMP_SIGNAL,               0x8, 1 },   //UNORD_S
+    { 4, FPCMP_SIGNAL,               0xD, 1 },   //NEQ_US
+    { 5, FPCMP_QUIET,                0xE, 0 },   //NLT_UQ
+    { 6, FPCMP_QUIET,                0xC, 0 },   //NLE_UQ
+    { 7, FPCMP_SIGNAL,               0x7, 1 },   //ORD_S
+    { 0, FPCMP_OR | FPCMP_SIGNAL,    0xA, 1 },   //EQ_US
+    { 1, FPCMP_OR | FPCMP_QUIET,     0x9, 0 },   //NGE_UQ
+    { 2, FPCMP_OR | FPCMP_QUIET,     0xB, 0 },   //NGT_UQ
+    { 3, FPCMP_ANDN | FPCMP_SIGNAL,  0x0, 1 },   //FALSE_OS
+    { 4, FPCMP_ANDN | FPCMP_SIGNAL,  0x5, 1 },   //NEQ_OS
+    { 5, FPCMP_ANDN | FPCMP_QUIET,   0x6, 0 },   //GE_OQ
+    { 6, FPCMP_ANDN | FPCMP_QUIET,   0x4, 0 },   //GT_OQ
+    { 7, FPCMP_OR | FPCMP_SIGNAL,    0xF, 1 },   //TRUE_US
+};
+
+typedef uint32_t fpcmp_v4su __attribute__((vector_size(16)));
+
+//kind: 0 cmpps, 1 cmppd, 2 cmpss, 3 cmpsd
+#define FPCMP_ASM(ins, x, y, p) \
+    asm volatile (ins " $" #p ", %1, %0" : "+x" (x) : "xm" (y))
+
+#define FPCMP_CASES(ins, x, y, p) \
+    switch (p) { \
+        case 0: FPCMP_ASM(ins, x, y, 0); break; \
+        case 1: FPCMP_ASM(ins, x, y, 1); break; \
+        case 2: FPCMP_ASM(ins, x, y, 2); break; \
+        case 3: FPCMP_ASM(ins, x, y, 3); break; \
+        case 4: FPCMP_ASM(ins, x, y, 4); break; \
+        case 5: FPCMP_ASM(ins, x, y, 5); break; \
+        case 6: FPCMP_ASM(ins, x, y, 6); break; \
+        default: FPCMP_ASM(ins, x, y, 7); break; \
+    }
+
+static inline fpcmp_v4su fpcmp_native(fpcmp_v4su x, fpcmp_v4su y, int kind, int p) {
+    switch (kind) {
+        case 0:  FPCMP_CASES("cmpps", x, y, p); break;
+        case 1:  FPCMP_CASES("cmppd", x, y, p); break;
+        case 2:  FPCMP_CASES("cmpss", x, y, p); break;
+        default: FPCMP_CASES("cmpsd", x, y, p); break;
+    }
+    return x;
+}
+
+static inline fpcmp_v4su fpcmp_half(fpcmp_v4su x, fpcmp_v4su y, int kind, const struct fpcmp_pred *p) {
+    fpcmp_v4su m, u;
+    uint32_t mxcsr;
+
+    if (p->fix & FPCMP_QUIET)
+        asm volatile ("stmxcsr %0" : "=m" (mxcsr));
+    m = fpcmp_native(x, y, kind, p->base);
+    if (p->fix & FPCMP_QUIET)
+        asm volatile ("ldmxcsr %0" :: "m" (mxcsr));
+    if (p->fix & FPCMP_SIGNAL)
+        fpcmp_native(x, y, kind, 1);
+    if (p->fix & (FPCMP_OR | FPCMP_ANDN | FPCMP_QUIET)) {
+        u = fpcmp_native(x, y, kind, 3);
+        if (p->fix & FPCMP_OR)
+            m |= u;
+        if (p->fix & FPCMP_ANDN)
+            m &= ~u;
+    }
+    return m;
+}
+
+//one compare of a lane through the truth table
+static inline int fpcmp_soft(uint64_t a, uint64_t b, int width, const struct fpcmp_pred *p) {
+    return (p->truth >> opemu_sf_cmp(width, a, b, p->signaling)) & 1;
+}
+
+/** Packed: len 16 or 32 bytes of width-bit lanes. **/
+static inline void fpcmp_packed(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int width, uint8_t imm) {
+    const struct fpcmp_pred *p = &fpcmp_preds[imm & 31];
+    fpcmp_v4su x, y;
+    uint64_t u, v;
+    int i;
+
+    if (opemu_softfp()) {
+        for (i = 0; i < len; i += width / 8) {
+            u = v = 0;
+            memcpy(&u, &a[i], width / 8);
+            memcpy(&v, &b[i], width / 8);
+            memset(&res[i], fpcmp_soft(u, v, width, p) ? 0xFF : 0, width / 8);
+        }
+        return;
+    }
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        x = fpcmp_half(x, y, (width == 32) ? 0 : 1, p);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/** Scalar: lane 0 compared, the rest of a passed through. **/
+static inline void fpcmp_scalar(uint8_t *res, const uint8_t *a, const uint8_t *b, int width, uint8_t imm) {
+    const struct fpcmp_pred *p = &fpcmp_preds[imm & 31];
+    fpcmp_v4su x, y;
+    uint64_t u = 0, v = 0;
+
+    memcpy(res, a, 16);
+    if (opemu_softfp()) {
+        memcpy(&u, a, width / 8);
+        memcpy(&v, b, width / 8);
+        memset(res, fpcmp_soft(u, v, width, p) ? 0xFF : 0, width / 8);
+        return;
+    }
+    memcpy(&x, a, 16);
+    memcpy(&y, b, 16);
+    x = fpcmp_half(x, y, (width == 32) ? 2 : 3, p);
+    memcpy(res, &x, width / 8);
+}
+
+/** (u)comiss/sd: ZF, PF and CF of a compared to b. **/
+static inline unsigned long fpcmp_eflags(const uint8_t *a, const uint8_t *b, int width, int signaling) {
+    static const uint8_t rel_flags[4] = {
+        [SF_LT] = 0x01, [SF_EQ] = 0x40, [SF_GT] = 0x00, [SF_UN] = 0x45
+    };
+    fpcmp_v4su x, y;
+    uint64_t u = 0, v = 0;
+    uint8_t zf, pf, cf;
+
+    if (opemu_softfp()) {
+        memcpy(&u, a, width / 8);
+        memcpy(&v, b, width / 8);
+        return rel_flags[opemu_sf_cmp(width, u, v, signaling)];
+    }
+    memcpy(&x, a, 16);
+    memcpy(&y, b, 16);
+    switch ((width == 32) * 2 + signaling) {
+        case 0:
+            asm volatile ("ucomisd %4, %3" : "=@ccz" (zf), "=@ccp" (pf), "=@ccc" (cf) : "x" (x), "x" (y));
+            break;
+        case 1:
+            asm volatile ("comisd %4, %3" : "=@ccz" (zf), "=@ccp" (pf), "=@ccc" (cf) : "x" (x), "x" (y));
+            break;
+        case 2:
+            asm volatile ("ucomiss %4, %3" : "=@ccz" (zf), "=@ccp" (pf), "=@ccc" (cf) : "x" (x), "x" (y));
+            break;
+        default:
+            asm volatile ("comiss %4, %3" : "=@ccz" (zf), "=@ccp" (pf), "=@ccc" (cf) : "x" (x), "x" (y));
+            break;
+    }
+    return (zf ? 0x40 : 0) | (pf ? 0x04 : 0) | (cf ? 0x01 : 0);
+}
+
+#endif /* fpcmp_h */
@@ -7,6 +7,7 @@
 //  Made in Taiwan.
 
 #include "fpins.h"
+#include "fpops.h"
 
 /**********************************************/
 /**  IMM8 or MXCSR Rounding Control          **/
@@ -38,28 +39,80 @@ int getmxcsr(void) {
     return mxcsr_rc;
 }
 
-float round_fp32(float fp32, int rc)
+/** Round to integral on the bit pattern, mbits fraction and ebits exponent bits. **/
+static uint64_t round_int_bits(uint64_t x, int mbits, int ebits, int rc)
 {
-    switch(rc) {
-        case 0: fp32 = round_sf(fp32); break;
-        case 1: fp32 = floor_sf(fp32); break;
-        case 2: fp32 = ceil_sf(fp32); break;
-        case 3: fp32 = trunc_sf(fp32); break;
+    uint64_t sign = x & (1ULL << (mbits + ebits));
+    uint64_t mant = x & ((1ULL << mbits) - 1);
+    uint64_t one = (uint64_t)((1 << (ebits - 1)) - 1) << mbits;
+    int e = (int)((x >> mbits) & ((1 << ebits) - 1)) - ((1 << (ebits - 1)) - 1);
+    uint64_t frac;
+    int up;
+
+    //past 2^mbits every value is integral, NaNs come back quiet
+    if (e >= mbits) {
+        if ((e == (1 << (ebits - 1))) && mant)
+            x |= 1ULL << (mbits - 1);
+        return x;
     }
-    return fp32;
+    //|x| < 1: a signed zero or one
+    if (e < 0) {
+        if (!(x & ~sign))
+            return x;
+        switch (rc) {
+            case 0: up = (e == -1) && mant; break;
+            case 1: up = (sign != 0); break;
+            case 2: up = (sign == 0); break;
+            default: up = 0; break;
+        }
+        return sign | (up ? one : 0);
+    }
+    frac = (1ULL << (mbits - e)) - 1;
+    if (!(x & frac))
+        return x;
+    //a carry out of the fraction lands in the exponent, still exact
+    switch (rc) {
+        case 0: x += (frac >> 1) + ((x >> (mbits - e)) & 1); break;
+        case 1: if (sign) x += frac; break;
+        case 2: if (!sign) x += frac; break;
+    }
+    return x & ~frac;
 }
 
-double round_fp64(double fp64, int rc)
+/** round_int_bits under MXCSR: DAZ on the source, IE for an SNaN, PE when inexact unless suppressed. **/
+static uint64_t round_int(uint64_t x, int mbits, int ebits, int rc, int suppress)
 {
-    switch(rc) {
-        case 0: fp64 = round_df(fp64); break;
-        case 1: fp64 = floor_df(fp64); break;
-        case 2: fp64 = ceil_df(fp64); break;
-        case 3: fp64 = trunc_df(fp64); break;
+    uint64_t quiet = 1ULL << (mbits - 1);
+    uint64_t r;
+    uint32_t mxcsr, flags = 0;
+
+    asm volatile ("stmxcsr %0" : "=m" (mxcsr));
+    if ((mxcsr & 0x40) && !(x & (((1ULL << ebits) - 1) << mbits)))
+        x &= 1ULL << (mbits + ebits);
+    r = round_int_bits(x, mbits, ebits, rc);
+
+    if (((x >> mbits) & ((1ULL << ebits) - 1)) == ((1ULL << ebits) - 1)) {
+        if ((x & (quiet - 1)) && !(x & quiet))
+            flags = 0x01;
+    } else if ((r != x) && !suppress) {
+        flags = 0x20;
     }
-    return fp64;
+    if (flags) {
+        mxcsr |= flags;
+        asm volatile ("ldmxcsr %0" :: "m" (mxcsr));
+    }
+    return r;
+}
+
+float round_fp32(float fp32, int rc, int suppress)
+{
+    return fp32_val((uint32_t)round_int(fp32_bits(fp32), 23, 8, rc, suppress));
 }
 
+double round_fp64(double fp64, int rc, int suppress)
+{
+    return fp64_val(round_int(fp64_bits(fp64), 52, 11, rc, suppress));
+}
 
 float round_sf(float fp32) {
     if ( isValidNumber_f32(fp32) ) {
@@ -117,15 +170,14 @@ float trunc_sf(float fp32) {
     return fp32;
 }
 
+//the host SSE unit: fixed latency and correctly rounded, Newton steps were neither
 float sqrt_sf(float fp32) {
-    int i = 100;
-    float a = fp32;  //IN
-    float x = a / 2; //OUT
-    
-    while(i--) {
-        x = (x + a / x) / 2;
-    }
-    
+    float x;
+
+    if (opemu_softfp())
+        return fp32_val(opemu_sf32(SF_SQRT, fp32_bits(fp32), 0, 0));
+
+    asm __volatile__ ("sqrtss %1, %0" : "=x" (x) : "xm" (fp32));
     return x;
 }
 
@@ -186,14 +238,12 @@ double trunc_df(double fp64) {
 }
 
 double sqrt_df(double fp64) {
-    int i = 100;
-    double a = fp64;  //IN
-    double x = a / 2; //OUT
-    
-    while(i--) {
-        x = (x + a / x) / 2;
-    }
-    
+    double x;
+
+    if (opemu_softfp())
+        return fp64_val(opemu_sf64(SF_SQRT, fp64_bits(fp64), 0, 0));
+
+    asm __volatile__ ("sqrtsd %1, %0" : "=x" (x) : "xm" (fp64));
     return x;
 }
 
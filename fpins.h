@@ -13,8 +13,8 @@
 
 int getmxcsr(void);
 
-float round_fp32(float fp32, int rc);
-double round_fp64(double fp64, int rc);
+float round_fp32(float fp32, int rc, int suppress);
+double round_fp64(double fp64, int rc, int suppress);
 
 float round_sf(float fp32);
 float floor_sf(float fp32);
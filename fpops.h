@@ -0,0 +1,285 @@
+//
+//  fpops.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef fpops_h
+#define fpops_h
+
+#include "optrap.h"
+#include "fpins.h"
+#include "softfloat.h"
+
+/**********************************************/
+/**  FP lane arithmetic on bit patterns:     **/
+/**  host SSE, or softfloat with soft_fp=1   **/
+/**********************************************/
+
+static inline float fp32_val(uint32_t u) {
+    union { uint32_t u; float f; } v = { .u = u };
+    return v.f;
+}
+static inline uint32_t fp32_bits(float f) {
+    union { float f; uint32_t u; } v = { .f = f };
+    return v.u;
+}
+static inline double fp64_val(uint64_t u) {
+    union { uint64_t u; double f; } v = { .u = u };
+    return v.f;
+}
+static inline uint64_t fp64_bits(double f) {
+    union { double f; uint64_t u; } v = { .f = f };
+    return v.u;
+}
+
+static inline uint32_t fp32_add(uint32_t a, uint32_t b) {
+    if (opemu_softfp())
+        return opemu_sf32(SF_ADD, a, b, 0);
+    return fp32_bits(fp32_val(a) + fp32_val(b));
+}
+static inline uint32_t fp32_sub(uint32_t a, uint32_t b) {
+    if (opemu_softfp())
+        return opemu_sf32(SF_SUB, a, b, 0);
+    return fp32_bits(fp32_val(a) - fp32_val(b));
+}
+static inline uint32_t fp32_mul(uint32_t a, uint32_t b) {
+    if (opemu_softfp())
+        return opemu_sf32(SF_MUL, a, b, 0);
+    return fp32_bits(fp32_val(a) * fp32_val(b));
+}
+static inline uint32_t fp32_div(uint32_t a, uint32_t b) {
+    if (opemu_softfp())
+        return opemu_sf32(SF_DIV, a, b, 0);
+    return fp32_bits(fp32_val(a) / fp32_val(b));
+}
+//a * b + c, operands in the order of the SDM pseudo-code: it picks the NaN.
+//a*b is exact in double, a*b+c is rounded to odd in double so the conversion
+//to float rounds once (loop_fmaf); the odd trick needs round to nearest
+static inline uint32_t fp32_fma(uint32_t a, uint32_t b, uint32_t c) {
+    double p, s, bp, e;
+    uint64_t bits;
+
+    if (opemu_softfp() || getmxcsr())
+        return opemu_sf32(SF_FMA, a, b, c);
+    p = (double)fp32_val(a) * (double)fp32_val(b);
+    s = p + (double)fp32_val(c);
+    bp = s - p;
+    e = (p - (s - bp)) + ((double)fp32_val(c) - bp);
+    if ((e != 0) && (s - s == 0)) {
+        bits = fp64_bits(s);
+        if (!(bits & 1))
+            bits += ((e > 0) == (s > 0)) ? 1 : -1;
+        s = fp64_val(bits);
+    }
+    return fp32_bits((float)s);
+}
+
+static inline uint64_t fp64_add(uint64_t a, uint64_t b) {
+    if (opemu_softfp())
+        return opemu_sf64(SF_ADD, a, b, 0);
+    return fp64_bits(fp64_val(a) + fp64_val(b));
+}
+static inline uint64_t fp64_sub(uint64_t a, uint64_t b) {
+    if (opemu_softfp())
+        return opemu_sf64(SF_SUB, a, b, 0);
+    return fp64_bits(fp64_val(a) - fp64_val(b));
+}
+static inline uint64_t fp64_mul(uint64_t a, uint64_t b) {
+    if (opemu_softfp())
+        return opemu_sf64(SF_MUL, a, b, 0);
+    return fp64_bits(fp64_val(a) * fp64_val(b));
+}
+static inline uint64_t fp64_div(uint64_t a, uint64_t b) {
+    if (opemu_softfp())
+        return opemu_sf64(SF_DIV, a, b, 0);
+    return fp64_bits(fp64_val(a) / fp64_val(b));
+}
+//no wider host type holds a*b exactly: softfloat on either backend
+static inline uint64_t fp64_fma(uint64_t a, uint64_t b, uint64_t c) {
+    return opemu_sf64(SF_FMA, a, b, c);
+}
+
+/************************** conversions **************************/
+static inline uint64_t fp32_to_fp64(uint32_t a) {
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_F32_F64, a, -1);
+    return fp64_bits(fp32_val(a));
+}
+static inline uint32_t fp64_to_fp32(uint64_t a) {
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_F64_F32, a, -1);
+    return fp32_bits(fp64_val(a));
+}
+static inline uint32_t i32_to_fp32(int32_t a) {
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_I32_F32, (uint32_t)a, -1);
+    return fp32_bits(a);
+}
+static inline uint64_t i32_to_fp64(int32_t a) {
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_I32_F64, (uint32_t)a, -1);
+    return fp64_bits(a);
+}
+static inline uint32_t i64_to_fp32(int64_t a) {
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_I64_F32, a, -1);
+    return fp32_bits(a);
+}
+static inline uint64_t i64_to_fp64(int64_t a) {
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_I64_F64, a, -1);
+    return fp64_bits(a);
+}
+
+//rc 3 truncates (cvtt), anything else rounds by MXCSR.RC; out of range and
+//NaN give the integer indefinite 0x80000000(00000000) as the hardware does
+static inline int32_t fp32_to_i32(uint32_t a, int rc) {
+    int32_t r;
+
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_F32_I32, a, rc);
+    if (rc == 3)
+        asm volatile ("cvttss2si %1, %0" : "=r" (r) : "x" (fp32_val(a)));
+    else
+        asm volatile ("cvtss2si %1, %0" : "=r" (r) : "x" (fp32_val(a)));
+    return r;
+}
+static inline int64_t fp32_to_i64(uint32_t a, int rc) {
+    int64_t r;
+
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_F32_I64, a, rc);
+    if (rc == 3)
+        asm volatile ("cvttss2si %1, %0" : "=r" (r) : "x" (fp32_val(a)));
+    else
+        asm volatile ("cvtss2si %1, %0" : "=r" (r) : "x" (fp32_val(a)));
+    return r;
+}
+static inline int32_t fp64_to_i32(uint64_t a, int rc) {
+    int32_t r;
+
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_F64_I32, a, rc);
+    if (rc == 3)
+        asm volatile ("cvttsd2si %1, %0" : "=r" (r) : "x" (fp64_val(a)));
+    else
+        asm volatile ("cvtsd2si %1, %0" : "=r" (r) : "x" (fp64_val(a)));
+    return r;
+}
+static inline int64_t fp64_to_i64(uint64_t a, int rc) {
+    int64_t r;
+
+    if (opemu_softfp())
+        return opemu_sf_cvt(SF_F64_I64, a, rc);
+    if (rc == 3)
+        asm volatile ("cvttsd2si %1, %0" : "=r" (r) : "x" (fp64_val(a)));
+    else
+        asm volatile ("cvtsd2si %1, %0" : "=r" (r) : "x" (fp64_val(a)));
+    return r;
+}
+
+/********************** packed conversions ***********************/
+//one 128-bit half: narrowing kinds read 16 bytes and write 8,
+//widening kinds read 8 and write 16, the rest 16 to 16
+enum fpcvt_kind {
+    FPCVT_DQ2PS = 0,
+    FPCVT_PS2DQ,
+    FPCVT_DQ2PD,    //widening
+    FPCVT_PS2PD,    //widening
+    FPCVT_PD2DQ,    //narrowing
+    FPCVT_PD2PS,    //narrowing
+};
+
+typedef uint32_t fpops_v4su __attribute__((vector_size(16)));
+
+#define FPCVT_ASM(ins, d, s) asm volatile (ins " %1, %0" : "=x" (d) : "x" (s))
+
+static inline void fp_cvt_half(uint8_t *dst, const uint8_t *src, int kind, int rc) {
+    int in = (kind == FPCVT_DQ2PD || kind == FPCVT_PS2PD) ? 8 : 16;
+    int out = (kind >= FPCVT_PD2DQ) ? 8 : 16;
+    fpops_v4su s = { 0 }, d;
+    uint32_t a32[4], r32[4];
+    uint64_t a64[2], r64[2];
+    int i;
+
+    memcpy(&s, src, in);
+    if (opemu_softfp()) {
+        memcpy(a32, &s, 16);
+        memcpy(a64, &s, 16);
+        switch (kind) {
+            case FPCVT_DQ2PS:
+                for (i = 0; i < 4; ++i)
+                    r32[i] = i32_to_fp32(a32[i]);
+                memcpy(dst, r32, 16);
+                break;
+            case FPCVT_PS2DQ:
+                for (i = 0; i < 4; ++i)
+                    r32[i] = fp32_to_i32(a32[i], rc);
+                memcpy(dst, r32, 16);
+                break;
+            case FPCVT_DQ2PD:
+                for (i = 0; i < 2; ++i)
+                    r64[i] = i32_to_fp64(a32[i]);
+                memcpy(dst, r64, 16);
+                break;
+            case FPCVT_PS2PD:
+                for (i = 0; i < 2; ++i)
+                    r64[i] = fp32_to_fp64(a32[i]);
+                memcpy(dst, r64, 16);
+                break;
+            case FPCVT_PD2DQ:
+                for (i = 0; i < 2; ++i)
+                    r32[i] = fp64_to_i32(a64[i], rc);
+                memcpy(dst, r32, 8);
+                break;
+            default:
+                for (i = 0; i < 2; ++i)
+                    r32[i] = fp64_to_fp32(a64[i]);
+                memcpy(dst, r32, 8);
+                break;
+        }
+        return;
+    }
+    switch (kind) {
+        case FPCVT_DQ2PS:
+            FPCVT_ASM("cvtdq2ps", d, s);
+            break;
+        case FPCVT_PS2DQ:
+            if (rc == 3)
+                FPCVT_ASM("cvttps2dq", d, s);
+            else
+                FPCVT_ASM("cvtps2dq", d, s);
+            break;
+        case FPCVT_DQ2PD:
+            FPCVT_ASM("cvtdq2pd", d, s);
+            break;
+        case FPCVT_PS2PD:
+            FPCVT_ASM("cvtps2pd", d, s);
+            break;
+        case FPCVT_PD2DQ:
+            if (rc == 3)
+                FPCVT_ASM("cvttpd2dq", d, s);
+            else
+                FPCVT_ASM("cvtpd2dq", d, s);
+            break;
+        default:
+            FPCVT_ASM("cvtpd2ps", d, s);
+            break;
+    }
+    memcpy(dst, &d, out);
+}
+
+//len: bytes of the wider side, 16 or 32
+static inline void fp_cvt_packed(uint8_t *dst, const uint8_t *src, int len, int kind, int rc) {
+    int in = (kind == FPCVT_DQ2PD || kind == FPCVT_PS2PD) ? 8 : 16;
+    int out = (kind >= FPCVT_PD2DQ) ? 8 : 16;
+    int h;
+
+    for (h = 0; h < len / 16; ++h)
+        fp_cvt_half(dst + h * out, src + h * in, kind, rc);
+}
+
+#endif /* fpops_h */
@@ -0,0 +1,149 @@
+//
+//  fpred.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef fpred_h
+#define fpred_h
+
+#include "optrap.h"
+
+/*********************************************************
+ *** dpps/dppd, haddps/pd, hsubps/pd and addsubps/pd   ***
+ *** as SSE2 shufps/shufpd + mul + add sequences per   ***
+ *** 128-bit half, so a host without SSE3 or SSE4.1    ***
+ *** runs them natively. Operands are added in the     ***
+ *** order the hardware uses, so when both are NaN the ***
+ *** same one is returned. dpps sums every lane on its ***
+ *** own, it does not broadcast one sum.               ***
+ *** Unused lanes are masked to +0.0 before the arith- ***
+ *** metic and raise no flags. The imm8 nibbles index  ***
+ *** lane masks built at compile time. res, a and b    ***
+ *** hold len (16 or 32) bytes, a is the first source. ***
+ *********************************************************/
+
+typedef float    fpred_v4sf __attribute__((vector_size(16)));
+typedef double   fpred_v2df __attribute__((vector_size(16)));
+typedef uint32_t fpred_v4su __attribute__((vector_size(16)));
+typedef uint64_t fpred_v2du __attribute__((vector_size(16)));
+
+#define FPRED_B(n, i)   ((uint32_t)0 - (((n) >> (i)) & 1))
+#define FPRED_M4(n)     { FPRED_B(n, 0), FPRED_B(n, 1), FPRED_B(n, 2), FPRED_B(n, 3) }
+#define FPRED_M2(n)     { (uint64_t)0 - ((n) & 1), (uint64_t)0 - (((n) >> 1) & 1) }
+
+//lane i all-ones where bit i of the imm8 nibble is set
+static const fpred_v4su fpred_mask_ps[16] = {
+    FPRED_M4(0),  FPRED_M4(1),  FPRED_M4(2),  FPRED_M4(3),
+    FPRED_M4(4),  FPRED_M4(5),  FPRED_M4(6),  FPRED_M4(7),
+    FPRED_M4(8),  FPRED_M4(9),  FPRED_M4(10), FPRED_M4(11),
+    FPRED_M4(12), FPRED_M4(13), FPRED_M4(14), FPRED_M4(15),
+};
+static const fpred_v2du fpred_mask_pd[4] = {
+    FPRED_M2(0), FPRED_M2(1), FPRED_M2(2), FPRED_M2(3),
+};
+
+//x op y with x kept first: the compiler would commute + and *, and the
+//first operand's NaN is the one x86 returns
+#define FPRED_OP(ins, x, y) ({ typeof(x) _r = (x); asm (ins " %1, %0" : "+x" (_r) : "x" (y)); _r; })
+#define FPRED_ADDPS(x, y)   FPRED_OP("addps", x, y)
+#define FPRED_ADDPD(x, y)   FPRED_OP("addpd", x, y)
+#define FPRED_MULPS(x, y)   FPRED_OP("mulps", x, y)
+#define FPRED_MULPD(x, y)   FPRED_OP("mulpd", x, y)
+
+/************* Dot product *************/
+static inline void fpred_dpps(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, uint8_t imm) {
+    fpred_v4su in = fpred_mask_ps[imm >> 4], out = fpred_mask_ps[imm & 15];
+    fpred_v4su ua, ub;
+    fpred_v4sf x;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&ua, &a[i], 16);
+        memcpy(&ub, &b[i], 16);
+        x = FPRED_MULPS((fpred_v4sf)(ua & in), (fpred_v4sf)(ub & in));
+        //lane i: (t[i^1] + t[i]) + (t[i^3] + t[i^2])
+        x = FPRED_ADDPS(__builtin_ia32_shufps(x, x, 0xB1), x);
+        x = FPRED_ADDPS(x, __builtin_ia32_shufps(x, x, 0x4E));
+        ua = (fpred_v4su)x & out;
+        memcpy(&res[i], &ua, 16);
+    }
+}
+
+static inline void fpred_dppd(uint8_t *res, const uint8_t *a, const uint8_t *b, uint8_t imm) {
+    fpred_v2du in = fpred_mask_pd[(imm >> 4) & 3], out = fpred_mask_pd[imm & 3];
+    fpred_v2du ua, ub;
+    fpred_v2df x;
+
+    memcpy(&ua, a, 16);
+    memcpy(&ub, b, 16);
+    x = FPRED_MULPD((fpred_v2df)(ua & in), (fpred_v2df)(ub & in));
+    x = FPRED_ADDPD(x, __builtin_ia32_shufpd(x, x, 1));
+    ua = (fpred_v2du)x & out;
+    memcpy(res, &ua, 16);
+}
+
+/************* Horizontal add / sub *************/
+static inline void fpred_hps(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int sub) {
+    fpred_v4sf x, y, ev, od;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        ev = __builtin_ia32_shufps(x, y, 0x88);
+        od = __builtin_ia32_shufps(x, y, 0xDD);
+        x = sub ? ev - od : FPRED_ADDPS(ev, od);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+static inline void fpred_hpd(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int sub) {
+    fpred_v2df x, y, ev, od;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        ev = __builtin_ia32_shufpd(x, y, 0);
+        od = __builtin_ia32_shufpd(x, y, 3);
+        x = sub ? ev - od : FPRED_ADDPD(ev, od);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/************* Alternating sub / add *************/
+//even lanes a - b, odd lanes a + b; each side masked so the other lanes see 0 op 0
+static inline void fpred_addsubps(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    fpred_v4su ev = fpred_mask_ps[0x5], od = fpred_mask_ps[0xA];
+    fpred_v4su ua, ub, s, d;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&ua, &a[i], 16);
+        memcpy(&ub, &b[i], 16);
+        d = (fpred_v4su)((fpred_v4sf)(ua & ev) - (fpred_v4sf)(ub & ev));
+        s = (fpred_v4su)FPRED_ADDPS((fpred_v4sf)(ua & od), (fpred_v4sf)(ub & od));
+        d = (d & ev) | (s & od);
+        memcpy(&res[i], &d, 16);
+    }
+}
+
+static inline void fpred_addsubpd(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    fpred_v2du ev = fpred_mask_pd[1], od = fpred_mask_pd[2];
+    fpred_v2du ua, ub, s, d;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&ua, &a[i], 16);
+        memcpy(&ub, &b[i], 16);
+        d = (fpred_v2du)((fpred_v2df)(ua & ev) - (fpred_v2df)(ub & ev));
+        s = (fpred_v2du)FPRED_ADDPD((fpred_v2df)(ua & od), (fpred_v2df)(ub & od));
+        d = (d & ev) | (s & od);
+        memcpy(&res[i], &d, 16);
+    }
+}
+
+#endif /* fpred_h */
@@ -0,0 +1,403 @@
+//
+//  fuse.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/uaccess.h>
+
+#include "fuse.h"
+#include "budget.h"
+#include "aes.h"
+
+/*********************************************************
+ *** Straight-line sequence fusion.                    ***
+ *** AES-CTR/GCM code issues aesenc x9-13 + aesenclast ***
+ *** per block, interleaved over several blocks, with  ***
+ *** round key loads and pxor whitening in between.    ***
+ *** GHASH multiplies with 4x pclmulqdq followed by a  ***
+ *** pxor/pshufd/shift reduction.                      ***
+ *** Run the whole sequence on a snapshot of the XMM   ***
+ *** file in one trap instead of trapping per round.   ***
+ *********************************************************/
+
+static uint8_t fuse_lookup(struct fuse_ins *fi)
+{
+    if (fi->map == 1) {
+        switch (fi->opcode) {
+            case 0x10: //movups
+            case 0x28: //movaps
+                if (fi->pp == 0) return FUSE_MOVLOAD;
+                if (fi->pp == 1) return FUSE_MOVLOAD; //movupd/movapd
+                break;
+            case 0x6F: //movdqa/movdqu
+                if ((fi->pp == 1) || (fi->pp == 2)) return FUSE_MOVLOAD;
+                break;
+            case 0x57: //xorps
+                if (fi->pp == 0) return FUSE_PXOR;
+                break;
+            case 0xEF: //pxor
+                if (fi->pp == 1) return FUSE_PXOR;
+                break;
+            case 0x56: //orps
+                if (fi->pp == 0) return FUSE_POR;
+                break;
+            case 0xEB: //por
+                if (fi->pp == 1) return FUSE_POR;
+                break;
+            case 0x54: //andps
+                if (fi->pp == 0) return FUSE_PAND;
+                break;
+            case 0xDB: //pand
+                if (fi->pp == 1) return FUSE_PAND;
+                break;
+            case 0x70: //pshufd
+                if (fi->pp == 1) return FUSE_PSHUFD;
+                break;
+            case 0x72: //psrld/psrad/pslld
+                if (fi->pp == 1) return FUSE_PSHIFTD;
+                break;
+            case 0x73: //psrlq/psrldq/psllq/pslldq
+                if (fi->pp == 1) return FUSE_PSHIFTQ;
+                break;
+        }
+    }
+
+    if ((fi->map == 2) && (fi->pp == 1)) {
+        switch (fi->opcode) {
+            case 0x00: return FUSE_PSHUFB;
+            case 0xDC: return FUSE_AESENC;
+            case 0xDD: return FUSE_AESENCLAST;
+            case 0xDE: return FUSE_AESDEC;
+            case 0xDF: return FUSE_AESDECLAST;
+        }
+    }
+
+    if ((fi->map == 3) && (fi->pp == 1)) {
+        switch (fi->opcode) {
+            case 0x0F: return FUSE_PALIGNR;
+            case 0x44: return FUSE_PCLMULQDQ;
+        }
+    }
+
+    return FUSE_NONE;
+}
+
+/** Is this a trapping instruction the fused path may start from **/
+static int fuse_leader(struct fuse_ins *fi)
+{
+    switch (fi->kind) {
+        case FUSE_AESENC:
+        case FUSE_AESENCLAST:
+        case FUSE_AESDEC:
+        case FUSE_AESDECLAST:
+        case FUSE_PCLMULQDQ:
+            return 1;
+    }
+    return 0;
+}
+
+/** Could the bytes start a fused run: the leader test on the raw opcode, no decode. **/
+static int fuse_peek_leader(const uint8_t *bytep)
+{
+    uint8_t map, pp;
+
+    if (*bytep == 0xC4) {
+        //128-bit forms only
+        if (bytep[2] & 4)
+            return 0;
+        map = bytep[1] & 0x1F;
+        pp = bytep[2] & 3;
+        bytep += 3;
+    } else {
+        pp = 0;
+        if (*bytep == 0x66) {
+            pp = 1;
+            bytep++;
+        }
+        if ((*bytep & 0xF0) == 0x40)
+            bytep++;
+        if ((bytep[0] != 0x0F) || ((bytep[1] != 0x38) && (bytep[1] != 0x3A)))
+            return 0;
+        map = (bytep[1] == 0x38) ? 2 : 3;
+        bytep += 2;
+    }
+    if (pp != 1)
+        return 0;
+    if (map == 2)
+        return (*bytep >= 0xDC) && (*bytep <= 0xDF);
+    return (map == 3) && (*bytep == 0x44);
+}
+
+static int fuse_has_imm(struct fuse_ins *fi)
+{
+    if (fi->map == 3)
+        return 1;
+    if ((fi->map == 1) && (fi->opcode >= 0x70) && (fi->opcode <= 0x73))
+        return 1;
+    return 0;
+}
+
+static int fuse_aligned(struct fuse_ins *fi)
+{
+    if (fi->kind == FUSE_MOVLOAD)
+        return (fi->opcode == 0x28) || ((fi->opcode == 0x6F) && (fi->pp == 1));
+    return !fi->vex;
+}
+
+/** Decode one 64-bit mode instruction. returns its length, 0 if unsupported. **/
+static int fuse_decode(uint8_t *instruction, uint64_t ip, struct pt_regs *regs, struct fuse_ins *fi)
+{
+    uint8_t *bytep = instruction;
+    uint8_t *modrm;
+    uint8_t modbyte = 0;
+    uint8_t high_reg = 0;
+    uint8_t high_index = 0;
+    uint8_t high_base = 0;
+    int consumed;
+
+    *fi = (struct fuse_ins){ 0 };
+
+    if (*bytep == 0xC4) {
+        high_reg = !(bytep[1] >> 7);
+        high_index = !((bytep[1] >> 6) & 1);
+        high_base = !((bytep[1] >> 5) & 1);
+        fi->map = bytep[1] & 0x1F;
+        fi->W = bytep[2] >> 7;
+        fi->vvvv = (~bytep[2] >> 3) & 0xF;
+        fi->L = (bytep[2] >> 2) & 1;
+        fi->pp = bytep[2] & 3;
+        fi->vex = 1;
+        bytep += 3;
+    } else if (*bytep == 0xC5) {
+        high_reg = !(bytep[1] >> 7);
+        fi->map = 1;
+        fi->vvvv = (~bytep[1] >> 3) & 0xF;
+        fi->L = (bytep[1] >> 2) & 1;
+        fi->pp = bytep[1] & 3;
+        fi->vex = 1;
+        bytep += 2;
+    } else {
+        // Legacy Prefixes (SIMD prefix)
+        if (*bytep == 0x66) {
+            fi->pp = 1;
+            bytep++;
+        } else if (*bytep == 0xF3) {
+            fi->pp = 2;
+            bytep++;
+        } else if (*bytep == 0xF2) {
+            fi->pp = 3;
+            bytep++;
+        }
+        //REX Prefix
+        if ((*bytep & 0xF0) == 0x40) {
+            fi->W = (*bytep >> 3) & 1;
+            high_reg = (*bytep >> 2) & 1;
+            high_index = (*bytep >> 1) & 1;
+            high_base = *bytep & 1;
+            bytep++;
+        }
+        if (*bytep != 0x0F)
+            return 0;
+        bytep++;
+        if (*bytep == 0x38) {
+            fi->map = 2;
+            bytep++;
+        } else if (*bytep == 0x3A) {
+            fi->map = 3;
+            bytep++;
+        } else {
+            fi->map = 1;
+        }
+    }
+
+    fi->opcode = *bytep++;
+    fi->kind = fuse_lookup(fi);
+    if (fi->kind == FUSE_NONE)
+        return 0;
+
+    //128-bit forms only
+    if (fi->vex && fi->L)
+        return 0;
+
+    modbyte = bytep - instruction;
+    modrm = bytep;
+    fi->mod = *modrm >> 6;
+    fi->reg = ((*modrm >> 3) & 0x7) + (high_reg ? 8 : 0);
+    fi->rm = (*modrm & 0x7) + (high_base ? 8 : 0);
+
+    consumed = get_consumed(modrm);
+    fi->len = modbyte + consumed;
+    if (fuse_has_imm(fi)) {
+        fi->imm = bytep[consumed];
+        fi->len++;
+    }
+
+    if (fi->mod != 3) {
+        if ((fi->mod == 0) && ((*modrm & 0x7) == 5)) {
+            //[RIP + DISP32]
+            fi->maddr = ip + fi->len + *((int32_t*)&modrm[1]);
+        } else {
+            fi->maddr = addressing64(regs, modrm, fi->mod, fi->rm, high_index, high_base, modbyte, 0);
+        }
+    }
+
+    return fi->len;
+}
+
+/** Execute one decoded instruction on the XMM snapshot. returns 0 to stop the run. **/
+static int fuse_exec(struct fuse_ins *fi, XMM *xmm)
+{
+    XMM src, src1, res;
+    int i;
+
+    if (fi->mod == 3) {
+        src = xmm[fi->rm];
+    } else {
+        //Legacy m128 operands and movdqa/movaps fault on misaligned memory, let the hardware raise it
+        if ((fi->maddr & 15) && fuse_aligned(fi))
+            return 0;
+        if (copy_from_user(&src, (void __user *)fi->maddr, sizeof(src)))
+            return 0;
+    }
+
+    //legacy: dst = dst op src / vex: dst = vsrc op src
+    src1 = fi->vex ? xmm[fi->vvvv] : xmm[fi->reg];
+
+    switch (fi->kind) {
+        case FUSE_MOVLOAD:
+            xmm[fi->reg] = src;
+            break;
+        case FUSE_PXOR:
+            xmm[fi->reg].u128 = src1.u128 ^ src.u128;
+            break;
+        case FUSE_AESENC:
+            AESEncRound(&src1, src);
+            xmm[fi->reg] = src1;
+            break;
+        case FUSE_AESENCLAST:
+            AESEncLastRound(&src1, src);
+            xmm[fi->reg] = src1;
+            break;
+        case FUSE_AESDEC:
+            AESDecRound(&src1, src);
+            xmm[fi->reg] = src1;
+            break;
+        case FUSE_AESDECLAST:
+            AESDecLastRound(&src1, src);
+            xmm[fi->reg] = src1;
+            break;
+        case FUSE_PCLMULQDQ:
+            //SRC1 = mod.reg (dst) / vex.v (vsrc)
+            //SRC2 = mod.r/m (src)
+            pclmulqdq_128(src, src1, &xmm[fi->reg], fi->imm);
+            break;
+        case FUSE_POR:
+            xmm[fi->reg].u128 = src1.u128 | src.u128;
+            break;
+        case FUSE_PAND:
+            xmm[fi->reg].u128 = src1.u128 & src.u128;
+            break;
+        case FUSE_PSHUFD:
+            for (i = 0; i < 4; i++)
+                res.u32[i] = src.u32[(fi->imm >> (i * 2)) & 3];
+            xmm[fi->reg] = res;
+            break;
+        case FUSE_PSHUFB:
+            for (i = 0; i < 16; i++)
+                res.u8[i] = (src.u8[i] & 0x80) ? 0 : src1.u8[src.u8[i] & 0xF];
+            xmm[fi->reg] = res;
+            break;
+        case FUSE_PALIGNR:
+            //(src1:src) >> (imm * 8)
+            for (i = 0; i < 16; i++) {
+                int idx = i + fi->imm;
+                res.u8[i] = (idx < 16) ? src.u8[idx] : ((idx < 32) ? src1.u8[idx - 16] : 0);
+            }
+            xmm[fi->reg] = res;
+            break;
+        case FUSE_PSHIFTD:
+        case FUSE_PSHIFTQ:
+            //ModRM.reg is the opcode extension, legacy: dst = r/m / vex: dst = vex.v
+            if (fi->mod != 3)
+                return 0;
+            res = src;
+            switch (((fi->kind == FUSE_PSHIFTD) ? 0x20 : 0x30) | (fi->reg & 0x7)) {
+                case 0x22: //psrld
+                    for (i = 0; i < 4; i++)
+                        res.u32[i] = (fi->imm > 31) ? 0 : (src.u32[i] >> fi->imm);
+                    break;
+                case 0x24: //psrad
+                    for (i = 0; i < 4; i++)
+                        res.a32[i] = src.a32[i] >> ((fi->imm > 31) ? 31 : fi->imm);
+                    break;
+                case 0x26: //pslld
+                    for (i = 0; i < 4; i++)
+                        res.u32[i] = (fi->imm > 31) ? 0 : (src.u32[i] << fi->imm);
+                    break;
+                case 0x32: //psrlq
+                    for (i = 0; i < 2; i++)
+                        res.u64[i] = (fi->imm > 63) ? 0 : (src.u64[i] >> fi->imm);
+                    break;
+                case 0x33: //psrldq
+                    res.u128 = (fi->imm > 15) ? 0 : (src.u128 >> (fi->imm * 8));
+                    break;
+                case 0x36: //psllq
+                    for (i = 0; i < 2; i++)
+                        res.u64[i] = (fi->imm > 63) ? 0 : (src.u64[i] << fi->imm);
+                    break;
+                case 0x37: //pslldq
+                    res.u128 = (fi->imm > 15) ? 0 : (src.u128 << (fi->imm * 8));
+                    break;
+                default:
+                    return 0;
+            }
+            xmm[fi->vex ? fi->vvvv : fi->rm] = res;
+            break;
+        default:
+            return 0;
+    }
+
+    //VEX.128 clears the upper half of the destination
+    if (fi->vex)
+        _vymm(((fi->kind == FUSE_PSHIFTD) || (fi->kind == FUSE_PSHIFTQ)) ? fi->vvvv : fi->reg)->u128[1] = 0;
+
+    return 1;
+}
+
+/** Runs the fused emulator. returns the number of bytes consumed, 0 to fall back. **/
+int opemu_fuse(uint8_t *instruction, struct pt_regs *regs, uint64_t deadline)
+{
+    struct fuse_ins fi;
+    XMM xmm[16];
+    int bytes = 0;
+    int count = 0;
+    int i;
+
+    if (!is_saved_state64(regs) || !fuse_peek_leader(instruction))
+        return 0;
+
+    //Snapshot before any C code may touch the XMM file
+    for (i = 0; i < 16; i++)
+        _store_xmm(i, &xmm[i]);
+
+    //the first instruction always runs, it is the one that trapped
+    while ((count < FUSE_MAX_INS) && !(count && opemu_budget_expired(deadline))) {
+        if (!fuse_decode(instruction + bytes, regs->ip + bytes, regs, &fi))
+            break;
+        if ((count == 0) && !fuse_leader(&fi))
+            break;
+        if (!fuse_exec(&fi, xmm))
+            break;
+        bytes += fi.len;
+        count++;
+    }
+
+    //Write back the whole file, C code above may use XMM as scratch
+    for (i = 0; i < 16; i++)
+        _load_xmm(i, &xmm[i]);
+
+    return bytes;
+}
@@ -0,0 +1,54 @@
+//
+//  fuse.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef fuse_h
+#define fuse_h
+
+#include "optrap.h"
+
+//Upper bound of instructions emulated in one trap (8 blocks x 15 rounds)
+#define FUSE_MAX_INS 128
+
+enum fuse_kind {
+    FUSE_NONE = 0,
+    FUSE_MOVLOAD,    //movdqa/movdqu/movaps/movups xmm, xmm/m128
+    FUSE_PXOR,       //pxor/xorps
+    FUSE_AESENC,
+    FUSE_AESENCLAST,
+    FUSE_AESDEC,
+    FUSE_AESDECLAST,
+    FUSE_PCLMULQDQ,
+    FUSE_POR,        //por/orps
+    FUSE_PAND,       //pand/andps
+    FUSE_PSHUFD,
+    FUSE_PSHUFB,
+    FUSE_PALIGNR,
+    FUSE_PSHIFTD,    //psrld/psrad/pslld imm8
+    FUSE_PSHIFTQ,    //psrlq/psrldq/psllq/pslldq imm8
+};
+
+struct fuse_ins {
+    uint8_t len;
+    uint8_t kind;
+    uint8_t vex;
+    uint8_t map;     //1=0F 2=0F38 3=0F3A
+    uint8_t pp;      //0=NP 1=66 2=F3 3=F2
+    uint8_t opcode;
+    uint8_t W;
+    uint8_t L;
+    uint8_t mod;     //ModRM.mod
+    uint8_t reg;     //ModRM.reg (DEST)
+    uint8_t rm;      //ModRM.r/m (SRC) when mod == 3
+    uint8_t vvvv;    //VEX.vvvv (SRC1)
+    uint8_t imm;
+    uint64_t maddr;
+};
+
+int opemu_fuse(uint8_t *instruction, struct pt_regs *regs, uint64_t deadline);
+
+#endif /* fuse_h */
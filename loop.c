@@ -0,0 +1,893 @@
+//
+//  loop.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/sched.h>
+#include <linux/slab.h>
+#include <linux/uaccess.h>
+
+#include "loop.h"
+#include "budget.h"
+
+/*********************************************************
+ *** Hot loop emulation.                               ***
+ *** Inlined AVX2 memcpy/memset/strlen loops trap once ***
+ *** per 32 bytes. When the trapping RIP sits in a     ***
+ *** small loop closed by a backward branch, run the   ***
+ *** remaining iterations in this trap: GPR pointer /  ***
+ *** counter updates and flags are interpreted, user   ***
+ *** memory is read ahead and write-combined in        ***
+ *** LOOP_CHUNK blocks, compares use native SSE2.      ***
+ *** GEMM / dot-product micro-kernels (vbroadcastss,   ***
+ *** vfmadd231ps into fixed accumulators) run the same ***
+ *** way with a correctly rounded FMA per lane.        ***
+ *********************************************************/
+
+#define LOOP_CF 0x0001
+#define LOOP_PF 0x0004
+#define LOOP_AF 0x0010
+#define LOOP_ZF 0x0040
+#define LOOP_SF 0x0080
+#define LOOP_OF 0x0800
+
+//loop_step results
+#define LOOP_NEXT   0
+#define LOOP_EXIT   1   //left the loop or ran out of budget, regs.ip is set
+#define LOOP_FAULT  2   //stop before the current instruction
+#define LOOP_REWIND 3   //buffered stores failed, restart from the checkpoint
+
+typedef uint8_t  loop_v16u8 __attribute__((vector_size(16)));
+typedef uint16_t loop_v8u16 __attribute__((vector_size(16)));
+typedef uint32_t loop_v4u32 __attribute__((vector_size(16)));
+
+struct loop_state {
+    struct pt_regs regs;
+    YMM ymm[16];
+    int pc;
+    int iter;
+    int executed;
+};
+
+struct loop_ctx {
+    struct loop_body *body;
+    struct loop_state st;
+    //state before the first buffered store
+    struct loop_state ckpt;
+    uint64_t bytes;
+    uint64_t deadline;      //opemu_budget_begin of the trap
+    //read-ahead
+    uint64_t rbase;
+    uint32_t rlen;
+    uint8_t rbuf[LOOP_CHUNK];
+    //write-combine
+    uint64_t wbase;
+    uint32_t wlen;
+    uint8_t wbuf[LOOP_CHUNK];
+};
+
+/** Decode one 64-bit mode instruction. returns its length, 0 if unsupported. **/
+//the scan runs before the XMM snapshot, it and its helpers use general registers only
+#define LOOP_NO_XMM __attribute__((target("general-regs-only")))
+
+static LOOP_NO_XMM int loop_decode(uint8_t *instruction, uint64_t ip, struct loop_ins *li)
+{
+    uint8_t *bytep = instruction;
+    uint8_t high_reg = 0;
+    uint8_t map = 0;
+    uint8_t pp = 0;
+    uint8_t opcode;
+    uint8_t imm_size = 0;
+    int consumed;
+
+    *li = (struct loop_ins){ 0 };
+
+    if ((*bytep == 0xC4) || (*bytep == 0xC5)) {
+        if (*bytep == 0xC4) {
+            high_reg = !(bytep[1] >> 7);
+            li->high_index = !((bytep[1] >> 6) & 1);
+            li->high_base = !((bytep[1] >> 5) & 1);
+            map = bytep[1] & 0x1F;
+            li->W = bytep[2] >> 7;
+            li->vvvv = (~bytep[2] >> 3) & 0xF;
+            li->L = (bytep[2] >> 2) & 1;
+            pp = bytep[2] & 3;
+            bytep += 3;
+        } else {
+            high_reg = !(bytep[1] >> 7);
+            map = 1;
+            li->vvvv = (~bytep[1] >> 3) & 0xF;
+            li->L = (bytep[1] >> 2) & 1;
+            pp = bytep[1] & 3;
+            bytep += 2;
+        }
+        li->vex = 1;
+        if ((map != 1) && (map != 2))
+            return 0;
+
+        opcode = *bytep++;
+        if (map == 2) {
+            if ((pp == 1) && !li->W) {
+                if (opcode == 0x18) li->kind = LOOP_VBROADCASTSS;
+                if (opcode == 0xB8) li->kind = LOOP_VFMADD231PS;
+            }
+        } else switch (opcode) {
+            case 0x10: //vmovups/vmovupd
+            case 0x28: //vmovaps/vmovapd
+                if (pp <= 1) li->kind = LOOP_VLOAD;
+                li->aligned = (opcode == 0x28);
+                break;
+            case 0x11: //vmovups/vmovupd
+            case 0x29: //vmovaps/vmovapd
+                if (pp <= 1) li->kind = LOOP_VSTORE;
+                li->aligned = (opcode == 0x29);
+                break;
+            case 0x6F: //vmovdqa/vmovdqu
+                if ((pp == 1) || (pp == 2)) li->kind = LOOP_VLOAD;
+                li->aligned = (pp == 1);
+                break;
+            case 0x7F: //vmovdqa/vmovdqu
+                if ((pp == 1) || (pp == 2)) li->kind = LOOP_VSTORE;
+                li->aligned = (pp == 1);
+                break;
+            case 0x74: //vpcmpeqb
+            case 0x75: //vpcmpeqw
+            case 0x76: //vpcmpeqd
+                if (pp == 1) li->kind = LOOP_VPCMPEQ;
+                li->elem = 1 << (opcode - 0x74);
+                break;
+            case 0xD7: //vpmovmskb
+                if (pp == 1) li->kind = LOOP_VPMOVMSKB;
+                break;
+            case 0x58: //vaddps
+                if (pp == 0) li->kind = LOOP_VADDPS;
+                break;
+            case 0x59: //vmulps
+                if (pp == 0) li->kind = LOOP_VMULPS;
+                break;
+        }
+    } else {
+        //REX Prefix
+        if ((*bytep & 0xF0) == 0x40) {
+            li->W = (*bytep >> 3) & 1;
+            high_reg = (*bytep >> 2) & 1;
+            li->high_index = (*bytep >> 1) & 1;
+            li->high_base = *bytep & 1;
+            bytep++;
+        }
+
+        opcode = *bytep++;
+        if ((opcode >= 0x70) && (opcode <= 0x7F)) { //jcc rel8
+            li->kind = LOOP_JCC;
+            li->cc = opcode & 0xF;
+            li->len = bytep - instruction + 1;
+            li->target = ip + li->len + *((int8_t*)bytep);
+            return li->len;
+        }
+        if ((opcode == 0x0F) && (*bytep >= 0x80) && (*bytep <= 0x8F)) { //jcc rel32
+            li->kind = LOOP_JCC;
+            li->cc = *bytep & 0xF;
+            bytep++;
+            li->len = bytep - instruction + 4;
+            li->target = ip + li->len + *((int32_t*)bytep);
+            return li->len;
+        }
+        if ((opcode == 0xEB) || (opcode == 0xE9)) { //jmp rel8/rel32
+            li->kind = LOOP_JMP;
+            li->len = bytep - instruction + ((opcode == 0xEB) ? 1 : 4);
+            if (opcode == 0xEB)
+                li->target = ip + li->len + *((int8_t*)bytep);
+            else
+                li->target = ip + li->len + *((int32_t*)bytep);
+            return li->len;
+        }
+
+        switch (opcode) {
+            case 0x01: li->kind = LOOP_ADD; li->rm_dst = 1; break; //add r/m, r
+            case 0x03: li->kind = LOOP_ADD; break;                 //add r, r/m
+            case 0x29: li->kind = LOOP_SUB; li->rm_dst = 1; break; //sub r/m, r
+            case 0x2B: li->kind = LOOP_SUB; break;                 //sub r, r/m
+            case 0x39: li->kind = LOOP_CMP; li->rm_dst = 1; break; //cmp r/m, r
+            case 0x3B: li->kind = LOOP_CMP; break;                 //cmp r, r/m
+            case 0x85: li->kind = LOOP_TEST; li->rm_dst = 1; break;
+            case 0x8D: li->kind = LOOP_LEA; break;
+            case 0x81: //add/sub/cmp r/m, imm32
+            case 0x83: //add/sub/cmp r/m, imm8
+                switch ((*bytep >> 3) & 0x7) {
+                    case 0: li->kind = LOOP_ADD; break;
+                    case 5: li->kind = LOOP_SUB; break;
+                    case 7: li->kind = LOOP_CMP; break;
+                }
+                li->rm_dst = 1;
+                li->has_imm = 1;
+                imm_size = (opcode == 0x81) ? 4 : 1;
+                break;
+            case 0xFF: //inc/dec r/m
+                switch ((*bytep >> 3) & 0x7) {
+                    case 0: li->kind = LOOP_INC; break;
+                    case 1: li->kind = LOOP_DEC; break;
+                }
+                li->rm_dst = 1;
+                break;
+        }
+    }
+
+    if (li->kind == LOOP_NONE)
+        return 0;
+
+    li->modbyte = bytep - instruction;
+    li->modrm = bytep;
+    li->mod = *bytep >> 6;
+    li->reg = ((*bytep >> 3) & 0x7) + (high_reg ? 8 : 0);
+    li->rm = (*bytep & 0x7) + (li->high_base ? 8 : 0);
+
+    consumed = get_consumed(bytep);
+    li->len = li->modbyte + consumed + imm_size;
+    if (imm_size == 1)
+        li->imm = *((int8_t*)&bytep[consumed]);
+    else if (imm_size == 4)
+        li->imm = *((int32_t*)&bytep[consumed]);
+
+    switch (li->kind) {
+        case LOOP_VLOAD:
+        case LOOP_VSTORE:
+        case LOOP_LEA:
+            //memory forms only, no [RIP + DISP32]
+            if ((li->mod == 3) || ((li->mod == 0) && ((*bytep & 0x7) == 5)))
+                return 0;
+            break;
+        case LOOP_VPCMPEQ:
+        case LOOP_VBROADCASTSS:
+        case LOOP_VFMADD231PS:
+        case LOOP_VADDPS:
+        case LOOP_VMULPS:
+            if ((li->mod == 0) && ((*bytep & 0x7) == 5))
+                return 0;
+            break;
+        case LOOP_VPMOVMSKB:
+            if (li->mod != 3)
+                return 0;
+            break;
+        default:
+            //GPR forms are register only
+            if (li->mod != 3)
+                return 0;
+            break;
+    }
+
+    //never move the stack pointer
+    if (!li->vex && (li->kind != LOOP_CMP) && (li->kind != LOOP_TEST)) {
+        if ((li->rm_dst ? li->rm : li->reg) == 4)
+            return 0;
+    }
+    if ((li->kind == LOOP_VPMOVMSKB) && (li->reg == 4))
+        return 0;
+
+    return li->len;
+}
+
+/** Find the loop around the trapping RIP. returns 0 if there is none. **/
+static LOOP_NO_XMM int loop_scan(uint8_t *instruction, uint64_t rip, struct loop_body *lb)
+{
+    struct loop_ins *li;
+    uint64_t pos = 0;
+    uint64_t back;
+    int n = 0;
+    int m = 0;
+    int i, j;
+
+    //[RIP ... backward branch]
+    for (;;) {
+        if (n >= LOOP_MAX_BODY)
+            return 0;
+        li = &lb->ins[n];
+        if (!loop_decode(instruction + pos, rip + pos, li))
+            return 0;
+        li->off = pos;
+        pos += li->len;
+        n++;
+        if (((li->kind == LOOP_JCC) || (li->kind == LOOP_JMP)) && (li->target <= rip))
+            break;
+    }
+
+    lb->head = li->target;
+    lb->end = rip + pos;
+    back = rip - lb->head;
+    if (back > LOOP_MAX_BACK)
+        return 0;
+
+    //[loop head ... RIP), decoded forward, must land on RIP
+    if (back) {
+        struct loop_ins pre[LOOP_MAX_BODY];
+        pos = 0;
+        while (pos < back) {
+            if (n + m >= LOOP_MAX_BODY)
+                return 0;
+            if (!loop_decode(instruction - back + pos, lb->head + pos, &pre[m]))
+                return 0;
+            pre[m].off = pos;
+            pos += pre[m].len;
+            m++;
+        }
+        if (pos != back)
+            return 0;
+        for (i = n - 1; i >= 0; i--) {
+            lb->ins[i + m] = lb->ins[i];
+            lb->ins[i + m].off += back;
+        }
+        for (i = 0; i < m; i++)
+            lb->ins[i] = pre[i];
+    }
+
+    lb->count = n + m;
+    lb->entry = m;
+
+    //the trap has to come from something we emulate
+    switch (lb->ins[lb->entry].kind) {
+        case LOOP_VLOAD:
+        case LOOP_VSTORE:
+        case LOOP_VPCMPEQ:
+        case LOOP_VPMOVMSKB:
+        case LOOP_VBROADCASTSS:
+        case LOOP_VFMADD231PS:
+        case LOOP_VADDPS:
+        case LOOP_VMULPS:
+            break;
+        default:
+            return 0;
+    }
+
+    //branches inside the body must land on an instruction boundary
+    for (i = 0; i < lb->count; i++) {
+        li = &lb->ins[i];
+        if ((li->kind != LOOP_JCC) && (li->kind != LOOP_JMP))
+            continue;
+        if ((li->target < lb->head) || (li->target >= lb->end))
+            continue;
+        for (j = 0; j < lb->count; j++) {
+            if (lb->head + lb->ins[j].off == li->target)
+                break;
+        }
+        if (j == lb->count)
+            return 0;
+    }
+
+    return 1;
+}
+
+/**********************************************/
+/**  GPR and EFLAGS                          **/
+/**********************************************/
+static inline uint64_t loop_getreg(struct loop_state *st, uint8_t n)
+{
+    M64 val;
+    _store_m64(n, &val, &st->regs);
+    return val.u64;
+}
+
+static inline void loop_setreg(struct loop_state *st, uint8_t n, uint64_t value, uint8_t W)
+{
+    M64 val;
+    //32-bit destinations are zero extended
+    val.u64 = W ? value : (uint32_t)value;
+    _load_m64(n, &val, &st->regs);
+}
+
+static unsigned long loop_szp(uint64_t r, int bits, unsigned long flags)
+{
+    uint8_t p = (uint8_t)r;
+
+    flags &= ~(LOOP_ZF | LOOP_SF | LOOP_PF);
+    if (r == 0)
+        flags |= LOOP_ZF;
+    if ((r >> (bits - 1)) & 1)
+        flags |= LOOP_SF;
+    p ^= p >> 4;
+    p ^= p >> 2;
+    p ^= p >> 1;
+    if (!(p & 1))
+        flags |= LOOP_PF;
+    return flags;
+}
+
+static uint64_t loop_arith(struct loop_state *st, int sub, uint64_t a, uint64_t b, int bits, int keep_cf)
+{
+    uint64_t mask = (bits == 64) ? ~0ULL : 0xFFFFFFFFULL;
+    unsigned long flags = st->regs.flags;
+    uint64_t r;
+
+    a &= mask;
+    b &= mask;
+    r = (sub ? (a - b) : (a + b)) & mask;
+
+    flags &= ~(LOOP_OF | LOOP_AF);
+    if (!keep_cf) {
+        flags &= ~LOOP_CF;
+        if (sub ? (a < b) : (r < a))
+            flags |= LOOP_CF;
+    }
+    if (sub) {
+        if ((((a ^ b) & (a ^ r)) >> (bits - 1)) & 1)
+            flags |= LOOP_OF;
+    } else {
+        if ((((a ^ r) & (b ^ r)) >> (bits - 1)) & 1)
+            flags |= LOOP_OF;
+    }
+    if ((a ^ b ^ r) & 0x10)
+        flags |= LOOP_AF;
+
+    st->regs.flags = loop_szp(r, bits, flags);
+    return r;
+}
+
+static void loop_logic(struct loop_state *st, uint64_t r, int bits)
+{
+    uint64_t mask = (bits == 64) ? ~0ULL : 0xFFFFFFFFULL;
+    unsigned long flags = st->regs.flags;
+
+    flags &= ~(LOOP_CF | LOOP_OF | LOOP_AF);
+    st->regs.flags = loop_szp(r & mask, bits, flags);
+}
+
+static int loop_cond(unsigned long flags, uint8_t cc)
+{
+    int cf = !!(flags & LOOP_CF);
+    int zf = !!(flags & LOOP_ZF);
+    int sf = !!(flags & LOOP_SF);
+    int of = !!(flags & LOOP_OF);
+    int pf = !!(flags & LOOP_PF);
+    int r = 0;
+
+    switch (cc >> 1) {
+        case 0: r = of; break;                   //jo
+        case 1: r = cf; break;                   //jb
+        case 2: r = zf; break;                   //je
+        case 3: r = cf || zf; break;             //jbe
+        case 4: r = sf; break;                   //js
+        case 5: r = pf; break;                   //jp
+        case 6: r = (sf != of); break;           //jl
+        case 7: r = zf || (sf != of); break;     //jle
+    }
+    return (cc & 1) ? !r : r;
+}
+
+/**********************************************/
+/**  User memory                             **/
+/**********************************************/
+static inline int loop_overlap(uint64_t a, uint32_t alen, uint64_t b, uint32_t blen)
+{
+    return alen && blen && (a < b + blen) && (b < a + alen);
+}
+
+static int loop_flush(struct loop_ctx *ctx)
+{
+    if (ctx->wlen == 0)
+        return 1;
+    if (copy_to_user((void __user *)ctx->wbase, ctx->wbuf, ctx->wlen))
+        return 0;
+    ctx->wlen = 0;
+    return 1;
+}
+
+static int loop_read(struct loop_ctx *ctx, uint64_t addr, void *data, uint32_t size)
+{
+    uint32_t n;
+
+    //pending stores must be visible to the load
+    if (loop_overlap(ctx->wbase, ctx->wlen, addr, size)) {
+        if (!loop_flush(ctx))
+            return LOOP_REWIND;
+        //the read-ahead may predate those stores
+        ctx->rlen = 0;
+    }
+
+    if ((addr < ctx->rbase) || (addr + size > ctx->rbase + ctx->rlen)) {
+        //read ahead up to the end of the page, which is mapped if addr is
+        n = PAGE_SIZE - (addr & (PAGE_SIZE - 1));
+        if (n > LOOP_CHUNK)
+            n = LOOP_CHUNK;
+        if (n < size)
+            n = size;
+        ctx->rlen = 0;
+        if (copy_from_user(ctx->rbuf, (void __user *)addr, n))
+            return LOOP_FAULT;
+        ctx->rbase = addr;
+        ctx->rlen = n;
+    }
+
+    memcpy(data, &ctx->rbuf[addr - ctx->rbase], size);
+    ctx->bytes += size;
+    return LOOP_NEXT;
+}
+
+static int loop_write(struct loop_ctx *ctx, uint64_t addr, void *data, uint32_t size)
+{
+    if (loop_overlap(ctx->rbase, ctx->rlen, addr, size))
+        ctx->rlen = 0;
+
+    if (ctx->wlen && ((addr != ctx->wbase + ctx->wlen) || (ctx->wlen + size > LOOP_CHUNK))) {
+        if (!loop_flush(ctx))
+            return LOOP_REWIND;
+    }
+
+    if (ctx->wlen == 0) {
+        ctx->ckpt = ctx->st;
+        ctx->wbase = addr;
+    }
+
+    memcpy(&ctx->wbuf[ctx->wlen], data, size);
+    ctx->wlen += size;
+    ctx->bytes += size;
+    return LOOP_NEXT;
+}
+
+/**********************************************/
+/**  Native SSE2 compare / mask              **/
+/**********************************************/
+static inline void loop_pcmpeq(YMM *res, YMM *a, YMM *b, uint8_t elem, int halves)
+{
+    int i;
+
+    for (i = 0; i < halves; i++) {
+        if (elem == 1) {
+            loop_v16u8 va, vb, vr;
+            memcpy(&va, &a->u128[i], 16);
+            memcpy(&vb, &b->u128[i], 16);
+            vr = (loop_v16u8)(va == vb);
+            memcpy(&res->u128[i], &vr, 16);
+        } else if (elem == 2) {
+            loop_v8u16 va, vb, vr;
+            memcpy(&va, &a->u128[i], 16);
+            memcpy(&vb, &b->u128[i], 16);
+            vr = (loop_v8u16)(va == vb);
+            memcpy(&res->u128[i], &vr, 16);
+        } else {
+            loop_v4u32 va, vb, vr;
+            memcpy(&va, &a->u128[i], 16);
+            memcpy(&vb, &b->u128[i], 16);
+            vr = (loop_v4u32)(va == vb);
+            memcpy(&res->u128[i], &vr, 16);
+        }
+    }
+    if (halves == 1)
+        res->u128[1] = 0;
+}
+
+static inline uint32_t loop_pmovmskb(YMM *src, int halves)
+{
+    uint32_t mask = 0;
+    int i;
+
+    for (i = 0; i < halves; i++) {
+        loop_v16u8 v;
+        memcpy(&v, &src->u128[i], 16);
+        mask |= (uint32_t)__builtin_ia32_pmovmskb128((__attribute__((vector_size(16))) char)v) << (i * 16);
+    }
+    return mask;
+}
+
+/**********************************************/
+/**  Packed single FMA / add / mul           **/
+/**********************************************/
+//a*b is exact in double, a*b+c is rounded to odd in double so the
+//conversion to float rounds once: same result as a fused multiply-add
+static inline float loop_fmaf(float a, float b, float c)
+{
+    double p = (double)a * (double)b;
+    double s = p + (double)c;
+    double bp = s - p;
+    double e = (p - (s - bp)) + ((double)c - bp);
+    uint64_t bits;
+
+    if ((e != 0) && (s - s == 0)) {
+        memcpy(&bits, &s, sizeof(bits));
+        if (!(bits & 1)) {
+            if ((e > 0) == (s > 0))
+                bits++;
+            else
+                bits--;
+        }
+        memcpy(&s, &bits, sizeof(bits));
+    }
+    return (float)s;
+}
+
+static inline void loop_vfmadd231ps(YMM *dst, YMM *a, YMM *b, int lanes)
+{
+    int i;
+
+    for (i = 0; i < lanes; i++)
+        dst->fa32[i] = loop_fmaf(a->fa32[i], b->fa32[i], dst->fa32[i]);
+    if (lanes == 4)
+        dst->u128[1] = 0;
+}
+
+static inline void loop_vaddmulps(YMM *dst, YMM *a, YMM *b, int lanes, int mul)
+{
+    int i;
+
+    for (i = 0; i < lanes; i++)
+        dst->fa32[i] = mul ? (a->fa32[i] * b->fa32[i]) : (a->fa32[i] + b->fa32[i]);
+    if (lanes == 4)
+        dst->u128[1] = 0;
+}
+
+static LOOP_NO_XMM int loop_has_fp(struct loop_body *lb)
+{
+    int i;
+
+    for (i = 0; i < lb->count; i++) {
+        switch (lb->ins[i].kind) {
+            case LOOP_VFMADD231PS:
+            case LOOP_VADDPS:
+            case LOOP_VMULPS:
+                return 1;
+        }
+    }
+    return 0;
+}
+
+/**********************************************/
+/**  Interpreter                             **/
+/**********************************************/
+static inline uint64_t loop_ea(struct loop_state *st, struct loop_ins *li)
+{
+    return addressing64(&st->regs, li->modrm, li->mod, li->rm, li->high_index, li->high_base, li->modbyte, 0);
+}
+
+static int loop_goto(struct loop_ctx *ctx, uint64_t target)
+{
+    struct loop_body *lb = ctx->body;
+    struct loop_state *st = &ctx->st;
+    int i;
+
+    if (target == lb->head) {
+        st->pc = 0;
+        st->iter++;
+        //bound the work per trap, resume at the loop head next time
+        if ((st->iter >= LOOP_MAX_ITER) || (ctx->bytes >= LOOP_MAX_BYTES) || need_resched() ||
+            opemu_budget_expired(ctx->deadline)) {
+            st->regs.ip = target;
+            return LOOP_EXIT;
+        }
+        return LOOP_NEXT;
+    }
+
+    if ((target > lb->head) && (target < lb->end)) {
+        for (i = 0; i < lb->count; i++) {
+            if (lb->head + lb->ins[i].off == target) {
+                st->pc = i;
+                return LOOP_NEXT;
+            }
+        }
+    }
+
+    st->regs.ip = target;
+    return LOOP_EXIT;
+}
+
+static int loop_step(struct loop_ctx *ctx, struct loop_ins *li)
+{
+    struct loop_state *st = &ctx->st;
+    uint64_t addr, a, b, r;
+    uint32_t size = li->L ? 32 : 16;
+    int bits = li->W ? 64 : 32;
+    uint8_t d;
+    YMM tmp, res;
+    int ret;
+    int i;
+
+    switch (li->kind) {
+        case LOOP_VLOAD:
+            addr = loop_ea(st, li);
+            if (li->aligned && (addr & (size - 1)))
+                return LOOP_FAULT;
+            tmp.u128[1] = 0;
+            ret = loop_read(ctx, addr, &tmp, size);
+            if (ret != LOOP_NEXT)
+                return ret;
+            st->ymm[li->reg] = tmp;
+            break;
+
+        case LOOP_VSTORE:
+            addr = loop_ea(st, li);
+            if (li->aligned && (addr & (size - 1)))
+                return LOOP_FAULT;
+            ret = loop_write(ctx, addr, &st->ymm[li->reg], size);
+            if (ret != LOOP_NEXT)
+                return ret;
+            break;
+
+        case LOOP_VPCMPEQ:
+            if (li->mod == 3) {
+                tmp = st->ymm[li->rm];
+            } else {
+                ret = loop_read(ctx, loop_ea(st, li), &tmp, size);
+                if (ret != LOOP_NEXT)
+                    return ret;
+            }
+            loop_pcmpeq(&res, &st->ymm[li->vvvv], &tmp, li->elem, li->L ? 2 : 1);
+            st->ymm[li->reg] = res;
+            break;
+
+        case LOOP_VPMOVMSKB:
+            loop_setreg(st, li->reg, loop_pmovmskb(&st->ymm[li->rm], li->L ? 2 : 1), 1);
+            break;
+
+        case LOOP_VBROADCASTSS:
+            if (li->mod == 3) {
+                tmp = st->ymm[li->rm];
+            } else {
+                ret = loop_read(ctx, loop_ea(st, li), &tmp, 4);
+                if (ret != LOOP_NEXT)
+                    return ret;
+            }
+            for (i = 1; i < 8; i++)
+                tmp.a32[i] = tmp.a32[0];
+            if (!li->L)
+                tmp.u128[1] = 0;
+            st->ymm[li->reg] = tmp;
+            break;
+
+        case LOOP_VFMADD231PS:
+        case LOOP_VADDPS:
+        case LOOP_VMULPS:
+            if (li->mod == 3) {
+                tmp = st->ymm[li->rm];
+            } else {
+                ret = loop_read(ctx, loop_ea(st, li), &tmp, size);
+                if (ret != LOOP_NEXT)
+                    return ret;
+            }
+            if (li->kind == LOOP_VFMADD231PS) {
+                loop_vfmadd231ps(&st->ymm[li->reg], &st->ymm[li->vvvv], &tmp, li->L ? 8 : 4);
+            } else {
+                loop_vaddmulps(&res, &st->ymm[li->vvvv], &tmp, li->L ? 8 : 4, li->kind == LOOP_VMULPS);
+                st->ymm[li->reg] = res;
+            }
+            break;
+
+        case LOOP_ADD:
+        case LOOP_SUB:
+        case LOOP_CMP:
+            d = li->rm_dst ? li->rm : li->reg;
+            a = loop_getreg(st, d);
+            if (li->has_imm)
+                b = li->imm;
+            else
+                b = loop_getreg(st, li->rm_dst ? li->reg : li->rm);
+            r = loop_arith(st, li->kind != LOOP_ADD, a, b, bits, 0);
+            if (li->kind != LOOP_CMP)
+                loop_setreg(st, d, r, li->W);
+            break;
+
+        case LOOP_TEST:
+            loop_logic(st, loop_getreg(st, li->rm) & loop_getreg(st, li->reg), bits);
+            break;
+
+        case LOOP_INC:
+        case LOOP_DEC:
+            r = loop_arith(st, li->kind == LOOP_DEC, loop_getreg(st, li->rm), 1, bits, 1);
+            loop_setreg(st, li->rm, r, li->W);
+            break;
+
+        case LOOP_LEA:
+            loop_setreg(st, li->reg, loop_ea(st, li), li->W);
+            break;
+
+        case LOOP_JCC:
+            if (!loop_cond(st->regs.flags, li->cc))
+                break;
+            st->executed++;
+            return loop_goto(ctx, li->target);
+
+        case LOOP_JMP:
+            st->executed++;
+            return loop_goto(ctx, li->target);
+
+        default:
+            return LOOP_FAULT;
+    }
+
+    st->executed++;
+    return loop_goto(ctx, ctx->body->head + li->off + li->len);
+}
+
+/**********************************************/
+/**  YMM snapshot                            **/
+/**********************************************/
+static YMM *const loop_vymm[16] = {
+    &VYMM0, &VYMM1, &VYMM2,  &VYMM3,  &VYMM4,  &VYMM5,  &VYMM6,  &VYMM7,
+    &VYMM8, &VYMM9, &VYMM10, &VYMM11, &VYMM12, &VYMM13, &VYMM14, &VYMM15,
+};
+
+//all XMM first: copying a VYMM upper half may use any XMM as a temporary
+static void loop_save_ymm(YMM *ymm)
+{
+    int i;
+
+    for (i = 0; i < 16; i++)
+        _store_xmm(i, (XMM*)&ymm[i]);
+    for (i = 0; i < 16; i++)
+        ymm[i].u128[1] = loop_vymm[i]->u128[1];
+}
+
+static void loop_restore_ymm(YMM *ymm)
+{
+    int i;
+
+    for (i = 0; i < 16; i++)
+        *loop_vymm[i] = ymm[i];
+    for (i = 0; i < 16; i++)
+        _load_xmm(i, (XMM*)&ymm[i]);
+}
+
+/** Runs the loop emulator. returns the instructions executed, 0 if regs are untouched. **/
+int opemu_loop(uint8_t *instruction, struct pt_regs *regs, uint64_t deadline)
+{
+    struct loop_body body;
+    struct loop_ctx *ctx;
+    YMM ymm[16];
+    uint32_t mxcsr;
+    int ret;
+    int i;
+
+    //only VEX encoded instructions start a loop
+    if ((instruction[0] != 0xC4) && (instruction[0] != 0xC5))
+        return 0;
+    if (!is_saved_state64(regs))
+        return 0;
+
+    //decided on general registers: a trap that is no loop never pays for the snapshot
+    if (!loop_scan(instruction, regs->ip, &body))
+        return 0;
+    //packed FP runs on the host SSE unit under the user MXCSR, the FMA
+    //rounding trick needs round to nearest, no FTZ/DAZ and every exception masked
+    asm volatile("stmxcsr %0" : "=m" (mxcsr));
+    if (loop_has_fp(&body) && ((mxcsr & 0xFFC0) != 0x1F80))
+        return 0;
+    //no sleeping in the trap path, the single instruction handlers take over if this fails
+    ctx = kmalloc(sizeof(*ctx), GFP_NOWAIT | __GFP_NOWARN);
+    if (!ctx)
+        return 0;
+
+    loop_save_ymm(ymm);
+    ctx->body = &body;
+    ctx->deadline = deadline;
+    ctx->st.regs = *regs;
+    memcpy(ctx->st.ymm, ymm, sizeof(ymm));
+    ctx->st.pc = body.entry;
+    ctx->st.iter = 0;
+    ctx->st.executed = 0;
+    ctx->bytes = 0;
+    ctx->rlen = 0;
+    ctx->wlen = 0;
+
+    do {
+        ret = loop_step(ctx, &body.ins[ctx->st.pc]);
+    } while (ret == LOOP_NEXT);
+
+    if ((ret != LOOP_REWIND) && !loop_flush(ctx))
+        ret = LOOP_REWIND;
+    if (ret == LOOP_REWIND)
+        ctx->st = ctx->ckpt;
+    if (ret != LOOP_EXIT)
+        ctx->st.regs.ip = body.head + body.ins[ctx->st.pc].off;
+
+    //nothing done, let the single instruction handlers deal with it
+    if (ctx->st.executed) {
+        *regs = ctx->st.regs;
+        memcpy(ymm, ctx->st.ymm, sizeof(ymm));
+        ret = ctx->st.executed;
+    } else {
+        ret = 0;
+    }
+    kfree(ctx);
+
+    loop_restore_ymm(ymm);
+
+    return ret;
+}
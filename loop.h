@@ -0,0 +1,75 @@
+//
+//  loop.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef loop_h
+#define loop_h
+
+#include "optrap.h"
+
+#define LOOP_MAX_BODY  16            //instructions in a recognised loop body
+#define LOOP_MAX_BACK  64            //bytes between loop head and trapping RIP
+#define LOOP_MAX_ITER  4096          //iterations per trap
+#define LOOP_MAX_BYTES (64 * 1024)   //user memory moved per trap
+#define LOOP_CHUNK     256           //bulk read-ahead / write-combine unit
+
+enum loop_kind {
+    LOOP_NONE = 0,
+    LOOP_VLOAD,      //vmovdqu/vmovdqa/vmovups/vmovaps ymm/xmm, m
+    LOOP_VSTORE,     //vmovdqu/vmovdqa/vmovups/vmovaps m, ymm/xmm
+    LOOP_VPCMPEQ,    //vpcmpeqb/w/d
+    LOOP_VPMOVMSKB,
+    LOOP_VBROADCASTSS,
+    LOOP_VFMADD231PS,
+    LOOP_VADDPS,
+    LOOP_VMULPS,
+    LOOP_ADD,
+    LOOP_SUB,
+    LOOP_CMP,
+    LOOP_TEST,
+    LOOP_INC,
+    LOOP_DEC,
+    LOOP_LEA,
+    LOOP_JCC,
+    LOOP_JMP,
+};
+
+struct loop_ins {
+    uint8_t *modrm;
+    uint64_t off;        //offset from the loop head
+    uint64_t target;     //branch target
+    int64_t imm;
+    uint8_t len;
+    uint8_t kind;
+    uint8_t vex;
+    uint8_t L;
+    uint8_t W;           //64-bit GPR operand size
+    uint8_t mod;         //ModRM.mod
+    uint8_t reg;         //ModRM.reg
+    uint8_t rm;          //ModRM.r/m
+    uint8_t vvvv;        //VEX.vvvv
+    uint8_t modbyte;
+    uint8_t high_index;
+    uint8_t high_base;
+    uint8_t has_imm;     //GPR op source is imm, not ModRM.reg
+    uint8_t rm_dst;      //GPR op destination is ModRM.r/m
+    uint8_t cc;          //Jcc condition
+    uint8_t elem;        //vpcmpeq element size
+    uint8_t aligned;     //vmovdqa/vmovaps
+};
+
+struct loop_body {
+    struct loop_ins ins[LOOP_MAX_BODY];
+    uint64_t head;       //backward branch target
+    uint64_t end;        //first byte after the backward branch
+    int count;
+    int entry;           //index of the trapping instruction
+};
+
+int opemu_loop(uint8_t *instruction, struct pt_regs *regs, uint64_t deadline);
+
+#endif /* loop_h */
@@ -0,0 +1,97 @@
+//
+//  opdev.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/debugfs.h>
+#include <linux/fs.h>
+#include <linux/miscdevice.h>
+#include <linux/module.h>
+#include <linux/uaccess.h>
+
+#include "opdev.h"
+#include "opemu_ioctl.h"
+#include "upcall.h"
+#include "pressure.h"
+#include "stats.h"
+#include "decode.h"
+#include "exec.h"
+
+/*********************************************************
+ *** /dev/opemu: per-process control of the emulator.  ***
+ *** mmap gives the read-only stats page (stats.c).    ***
+ *** Diagnostics go under /sys/kernel/debug/opemu/.    ***
+ *********************************************************/
+
+struct dentry *opemu_debugfs;
+
+static long opdev_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
+{
+    void __user *argp = (void __user *)arg;
+
+    switch (cmd) {
+        case OPEMU_IOC_SET_MODE:
+            return opemu_upcall_set(file, argp);
+        case OPEMU_IOC_SET_PRESSURE:
+            return opemu_pressure_set(file, argp);
+        case OPEMU_IOC_GET_PRESSURE:
+            return opemu_pressure_get(file, argp);
+        case OPEMU_IOC_GET_PROFILE:
+            return opemu_decode_get_profile(argp);
+        case OPEMU_IOC_LOAD_PROFILE:
+            return opemu_decode_load_profile(argp);
+        case OPEMU_IOC_EXEC:
+            return opemu_exec(argp);
+    }
+
+    return -ENOTTY;
+}
+
+static int opdev_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    return opemu_stats_mmap(file, vma);
+}
+
+static int opdev_release(struct inode *inode, struct file *file)
+{
+    opemu_upcall_release(file);
+    opemu_pressure_release(file);
+    return 0;
+}
+
+static const struct file_operations opdev_fops = {
+    .owner          = THIS_MODULE,
+    .unlocked_ioctl = opdev_ioctl,
+    .compat_ioctl   = opdev_ioctl,
+    .mmap           = opdev_mmap,
+    .release        = opdev_release,
+};
+
+static struct miscdevice opdev_misc = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name  = "opemu",
+    .fops  = &opdev_fops,
+    .mode  = 0666,
+};
+
+int opdev_init(void)
+{
+    int err;
+
+    err = misc_register(&opdev_misc);
+    if (err)
+        return err;
+
+    //debugfs is optional, its calls accept an error pointer
+    opemu_debugfs = debugfs_create_dir("opemu", NULL);
+    return 0;
+}
+
+void opdev_exit(void)
+{
+    debugfs_remove_recursive(opemu_debugfs);
+    misc_deregister(&opdev_misc);
+}
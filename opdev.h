@@ -0,0 +1,20 @@
+//
+//  opdev.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef opdev_h
+#define opdev_h
+
+struct dentry;
+
+//debugfs directory, opemu/
+extern struct dentry *opemu_debugfs;
+
+int opdev_init(void);
+void opdev_exit(void);
+
+#endif /* opdev_h */
@@ -0,0 +1,623 @@
+//
+//  opemu-bench.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Cost of one emulated instruction in each mode:
+//    kernel - emulated in the #UD handler, with the shared decode cache's
+//             hits on this binary's text when decode_stat is readable
+//    signal - SIGILL delivered, emulated by a signal handler
+//    upcall - RIP redirected to the userspace stub
+//    exec   - the kernel handlers alone, OPEMU_IOC_EXEC batches (root)
+//  then, without the module, the two halves of the mode difference: the
+//  upcall stub entered directly and a bare ud2 taken as SIGILL; and the
+//  FP backends on the userspace handlers, in cycles: host SSE,
+//  host SSE plus a full XSAVE/XRSTOR for scale, and
+//  softfloat/SWAR (soft_fp=1), then the SSE2 sequences for the SSSE3/SSE4.1
+//  integer operations against their C loops (soft_fp=1), in cycles per
+//  256-bit operation, a motion search on the video kernels in 16x16
+//  SADs per second, and a GHASH block unfused, fused and as one table
+//  multiply, in cycles per 16 bytes
+//
+//  usage: opemu-bench [iterations]
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <x86intrin.h>
+
+#include "opemu_ioctl.h"
+#include "optrap.h"
+#include "fuse.h"
+#include "softfloat.h"
+#include "ustub.h"
+#include "vsse2.h"
+#include "vssse3.h"
+#include "vsse41.h"
+
+static const char *bench_names[] = { "kernel", "signal", "upcall" };
+
+static uint64_t bench_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double bench_run(long iterations)
+{
+    uint64_t start, end;
+    long i;
+
+    start = bench_ns();
+    for (i = 0; i < iterations; i++) {
+        //one AVX2 instruction per trap, the nop keeps it out of the loop emulator
+        asm volatile ("vpaddd %%ymm1, %%ymm2, %%ymm0\n\t"
+                      "nop" ::: "xmm0");
+    }
+    end = bench_ns();
+
+    return (double)(end - start) / iterations;
+}
+
+//hits, misses, stale and uncached from decode_stat, 0 if it cannot be read (root)
+static int bench_decode_stat(uint64_t *v)
+{
+    static const char *keys[4] = { "hits", "misses", "stale", "uncached" };
+    char key[32];
+    unsigned long long n;
+    FILE *f;
+    int i, found = 0;
+
+    f = fopen("/sys/kernel/debug/opemu/decode_stat", "r");
+    if (!f)
+        return 0;
+    while (fscanf(f, "%31s %llu", key, &n) == 2) {
+        for (i = 0; i < 4; i++) {
+            if (!strcmp(key, keys[i])) {
+                v[i] = n;
+                found++;
+            }
+        }
+    }
+    fclose(f);
+    return found == 4;
+}
+
+//the upcall path without the trap: RIP below the red zone as the kernel leaves it, then the stub
+static double bench_stub(long iterations)
+{
+    uint64_t start, end;
+    long i;
+
+    start = bench_ns();
+    for (i = 0; i < iterations; i++) {
+        asm volatile ("sub $128, %%rsp\n\t"
+                      "lea -136(%%rsp), %%rsp\n\t"
+                      "lea 1f(%%rip), %%rax\n\t"
+                      "mov %%rax, (%%rsp)\n\t"
+                      "jmp opemu_stub_entry\n"
+                      "1:\n\t"
+                      "vpaddd %%ymm1, %%ymm2, %%ymm0\n\t"
+                      "add $128, %%rsp"
+                      ::: "rax", "cc", "memory", "xmm0");
+    }
+    end = bench_ns();
+
+    return (double)(end - start) / iterations;
+}
+
+static void bench_sigill_skip(int sig, siginfo_t *info, void *context)
+{
+    ((ucontext_t *)context)->uc_mcontext.gregs[REG_RIP] += 2;
+}
+
+//what signal mode pays before any emulation: #UD, the signal frame and sigreturn
+static double bench_sigill(long iterations)
+{
+    struct sigaction sa, old;
+    uint64_t start, end;
+    long i;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = bench_sigill_skip;
+    sa.sa_flags = SA_SIGINFO;
+    sigaction(SIGILL, &sa, &old);
+
+    start = bench_ns();
+    for (i = 0; i < iterations; i++)
+        asm volatile ("ud2");
+    end = bench_ns();
+
+    sigaction(SIGILL, &old, NULL);
+    return (double)(end - start) / iterations;
+}
+
+//vpaddd %ymm1, %ymm2, %ymm0 back to back, no trap entry or exit
+static int bench_exec(long iterations, double *cycles_per)
+{
+    static const uint8_t vpaddd[4] = { 0xC5, 0xED, 0xFE, 0xC1 };
+    static uint8_t code[OPEMU_EXEC_CODE];
+    static uint64_t cycles[OPEMU_EXEC_CODE / sizeof(vpaddd)];
+    struct opemu_exec_state state;
+    struct opemu_exec_req req;
+    uint64_t total = 0, n = 0;
+    uint32_t i;
+    int fd;
+
+    for (i = 0; i < sizeof(code); i += sizeof(vpaddd))
+        memcpy(&code[i], vpaddd, sizeof(vpaddd));
+
+    fd = open(OPEMU_DEVICE, O_RDWR | O_CLOEXEC);
+    if (fd < 0)
+        return -1;
+
+    while ((long)n < iterations) {
+        memset(&state, 0, sizeof(state));
+        state.mxcsr = 0x1F80;
+        memset(&req, 0, sizeof(req));
+        req.code = (uint64_t)code;
+        req.code_len = sizeof(code);
+        req.state = (uint64_t)&state;
+        req.cycles = (uint64_t)cycles;
+        if (ioctl(fd, OPEMU_IOC_EXEC, &req) < 0) {
+            close(fd);
+            return -1;
+        }
+        for (i = 0; i < req.count; i++)
+            total += cycles[i];
+        n += req.count;
+    }
+    close(fd);
+
+    *cycles_per = (double)total / n;
+    return 0;
+}
+
+static const struct {
+    const char *name;
+    uint8_t bytes[8];
+    int len;
+} bench_fp[] = {
+    { "vaddps",      { 0xC5, 0xEC, 0x58, 0xC1 }, 4 },
+    { "vmulpd",      { 0xC5, 0xED, 0x59, 0xC1 }, 4 },
+    { "vdivps",      { 0xC5, 0xEC, 0x5E, 0xC1 }, 4 },
+    { "vsqrtpd",     { 0xC5, 0xFD, 0x51, 0xC1 }, 4 },
+    { "vfmadd231ps", { 0xC4, 0xE2, 0x6D, 0xB8, 0xC1 }, 5 },
+    { "vcvtps2pd",   { 0xC5, 0xFC, 0x5A, 0xC1 }, 4 },
+    { "vpaddb",      { 0xC5, 0xED, 0xFC, 0xC1 }, 4 },
+};
+
+static double bench_backend(const uint8_t *bytes, long iterations, int soft)
+{
+    struct pt_regs regs;
+    uint64_t start, end;
+    long i;
+
+    memset(&regs, 0, sizeof(regs));
+    regs.cs = 0x33;
+    opemu_softfp_user = soft;
+
+    start = __rdtsc();
+    for (i = 0; i < iterations; i++)
+        vex_ins((uint8_t *)bytes, &regs);
+    end = __rdtsc();
+
+    opemu_softfp_user = 0;
+    return (double)(end - start) / iterations;
+}
+
+//handler alone on the 256-bit form, a is the first source
+#define BENCH_BIN(op) \
+    static void bench_##op(YMM *r, YMM *a, YMM *b) { op##_256(*b, *a, r); }
+#define BENCH_UN(op) \
+    static void bench_##op(YMM *r, YMM *a, YMM *b) { op##_256(*a, r); }
+
+BENCH_BIN(vpmulld)
+BENCH_BIN(vpminsd)
+BENCH_BIN(vpmaxud)
+BENCH_BIN(vpminuw)
+BENCH_BIN(vpmaxsb)
+BENCH_BIN(vpcmpeqq)
+BENCH_UN(vpabsb)
+BENCH_UN(vpabsd)
+BENCH_BIN(vpsignw)
+BENCH_BIN(vpackusdw)
+BENCH_UN(vpmovsxbw)
+BENCH_UN(vpmovzxwd)
+BENCH_BIN(vphaddw)
+BENCH_BIN(vphaddd)
+BENCH_BIN(vpmaddubsw)
+BENCH_BIN(vpmulhrsw)
+
+static void bench_vpblendvb(YMM *r, YMM *a, YMM *b)
+{
+    vpblendvb_256(*b, *a, r, *b);
+}
+
+static const struct {
+    const char *name;
+    void (*fn)(YMM *r, YMM *a, YMM *b);
+} bench_int[] = {
+    { "vpmulld",    bench_vpmulld },
+    { "vpminsd",    bench_vpminsd },
+    { "vpmaxud",    bench_vpmaxud },
+    { "vpminuw",    bench_vpminuw },
+    { "vpmaxsb",    bench_vpmaxsb },
+    { "vpcmpeqq",   bench_vpcmpeqq },
+    { "vpabsb",     bench_vpabsb },
+    { "vpabsd",     bench_vpabsd },
+    { "vpsignw",    bench_vpsignw },
+    { "vpblendvb",  bench_vpblendvb },
+    { "vpackusdw",  bench_vpackusdw },
+    { "vpmovsxbw",  bench_vpmovsxbw },
+    { "vpmovzxwd",  bench_vpmovzxwd },
+    { "vphaddw",    bench_vphaddw },
+    { "vphaddd",    bench_vphaddd },
+    { "vpmaddubsw", bench_vpmaddubsw },
+    { "vpmulhrsw",  bench_vpmulhrsw },
+};
+
+static double bench_int_op(void (*fn)(YMM *r, YMM *a, YMM *b), long iterations, int soft)
+{
+    YMM a, b, r;
+    uint64_t start, end;
+    long i;
+
+    for (i = 0; i < 32; i++) {
+        a.u8[i] = rand();
+        b.u8[i] = rand();
+    }
+    opemu_softfp_user = soft;
+
+    start = __rdtsc();
+    for (i = 0; i < iterations; i++) {
+        fn(&r, &a, &b);
+        asm volatile ("" : : "r" (&r), "r" (&a), "r" (&b) : "memory");
+    }
+    end = __rdtsc();
+
+    opemu_softfp_user = 0;
+    return (double)(end - start) / iterations;
+}
+
+//motion search the way an encoder does it on the handlers: a 16x16 block
+//against 8 x 8 full-pel candidates, vmpsadbw for 8 horizontal offsets of
+//four 4-byte columns per row, vphminposuw for the best; then the 8 half-pel
+//neighbours of the winner, vpavgb to interpolate and vpsadbw to score
+#define BENCH_STRIDE 48
+
+static double bench_motion(long iterations, int soft)
+{
+    static uint8_t ref[BENCH_STRIDE * BENCH_STRIDE], cur[16 * 16];
+    static const int8_t half[8][2] = {
+        { -1, -1 }, { 0, -1 }, { 1, -1 }, { -1, 0 }, { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 }
+    };
+    YMM a, b, r, p, q;
+    XMM cost, best, rows;
+    uint16_t sad[8], col[8];
+    uint64_t start, end;
+    const uint8_t *o, *h;
+    long it, sads = 0;
+    int i, k, y, dx, dy;
+
+    for (i = 0; i < (int)sizeof(ref); i++)
+        ref[i] = rand();
+    for (i = 0; i < (int)sizeof(cur); i++)
+        cur[i] = rand();
+    opemu_softfp_user = soft;
+
+    start = bench_ns();
+    for (it = 0; it < iterations; it++) {
+        //full pel: row dy, offsets dx 0-7
+        for (dy = 0; dy < 8; dy++) {
+            memset(sad, 0, sizeof(sad));
+            for (y = 0; y < 16; y++) {
+                o = &ref[(4 + dy + y) * BENCH_STRIDE + 4];
+                memcpy(&a.u8[0], o, 16);
+                memcpy(&a.u8[16], o + 8, 16);
+                memcpy(&b.u8[0], &cur[y * 16], 16);
+                memcpy(&b.u8[16], &cur[y * 16], 16);
+                //columns 0 and 2, then 1 and 3
+                vmpsadbw_256(b, a, &r, 0x10);
+                for (k = 0; k < 8; k++)
+                    sad[k] += r.u16[k] + r.u16[k + 8];
+                vmpsadbw_256(b, a, &r, 0x3D);
+                for (k = 0; k < 8; k++)
+                    sad[k] += r.u16[k] + r.u16[k + 8];
+            }
+            memcpy(&cost, sad, 16);
+            vphminposuw(cost, &best);
+            rows.u16[dy] = best.u16[0];
+            col[dy] = best.u16[1];
+            sads += 8;
+        }
+        vphminposuw(rows, &best);
+        dy = best.u16[1];
+        dx = col[dy];
+
+        //half pel around (dx, dy), two rows per operation
+        o = &ref[(4 + dy) * BENCH_STRIDE + 4 + dx];
+        for (i = 0; i < 8; i++) {
+            h = o + half[i][1] * BENCH_STRIDE + half[i][0];
+            sad[i] = 0;
+            for (y = 0; y < 16; y += 2) {
+                memcpy(&p.u8[0], o + y * BENCH_STRIDE, 16);
+                memcpy(&p.u8[16], o + (y + 1) * BENCH_STRIDE, 16);
+                memcpy(&q.u8[0], h + y * BENCH_STRIDE, 16);
+                memcpy(&q.u8[16], h + (y + 1) * BENCH_STRIDE, 16);
+                vpavgb_256(q, p, &a);
+                memcpy(&b, &cur[y * 16], 32);
+                vpsadbw_256(b, a, &r);
+                sad[i] += r.u16[0] + r.u16[4] + r.u16[8] + r.u16[12];
+            }
+            sads++;
+        }
+        memcpy(&cost, sad, 16);
+        vphminposuw(cost, &best);
+        asm volatile ("" : : "r" (&best) : "memory");
+    }
+    end = bench_ns();
+
+    opemu_softfp_user = 0;
+    return sads * 1e9 / (end - start);
+}
+
+//one GHASH block the way the CLMUL whitepaper writes it in VEX form, every
+//instruction a trap: 4 vpclmulqdq for the 256-bit product of xmm0 and
+//xmm1, then the shift/xor reduction, X in xmm6
+asm (".pushsection .rodata\n"
+     "bench_ghash:\n\t"
+     "vpclmulqdq $0x00, %xmm1, %xmm0, %xmm3\n\t"  "vpclmulqdq $0x10, %xmm1, %xmm0, %xmm4\n\t"
+     "vpclmulqdq $0x01, %xmm1, %xmm0, %xmm5\n\t"  "vpclmulqdq $0x11, %xmm1, %xmm0, %xmm6\n\t"
+     "vpxor %xmm5, %xmm4, %xmm4\n\t"  "vpslldq $8, %xmm4, %xmm5\n\t"
+     "vpsrldq $8, %xmm4, %xmm4\n\t"  "vpxor %xmm5, %xmm3, %xmm3\n\t"
+     "vpxor %xmm4, %xmm6, %xmm6\n\t"  "vpsrld $31, %xmm3, %xmm7\n\t"
+     "vpsrld $31, %xmm6, %xmm8\n\t"  "vpslld $1, %xmm3, %xmm3\n\t"
+     "vpslld $1, %xmm6, %xmm6\n\t"  "vpsrldq $12, %xmm7, %xmm9\n\t"
+     "vpslldq $4, %xmm8, %xmm8\n\t"  "vpslldq $4, %xmm7, %xmm7\n\t"
+     "vpor %xmm7, %xmm3, %xmm3\n\t"  "vpor %xmm8, %xmm6, %xmm6\n\t"
+     "vpor %xmm9, %xmm6, %xmm6\n\t"  "vpslld $31, %xmm3, %xmm7\n\t"
+     "vpslld $30, %xmm3, %xmm8\n\t"  "vpslld $25, %xmm3, %xmm9\n\t"
+     "vpxor %xmm8, %xmm7, %xmm7\n\t"  "vpxor %xmm9, %xmm7, %xmm7\n\t"
+     "vpsrldq $4, %xmm7, %xmm8\n\t"  "vpslldq $12, %xmm7, %xmm7\n\t"
+     "vpxor %xmm7, %xmm3, %xmm3\n\t"  "vpsrld $1, %xmm3, %xmm2\n\t"
+     "vpsrld $2, %xmm3, %xmm4\n\t"  "vpsrld $7, %xmm3, %xmm5\n\t"
+     "vpxor %xmm4, %xmm2, %xmm2\n\t"  "vpxor %xmm5, %xmm2, %xmm2\n\t"
+     "vpxor %xmm8, %xmm2, %xmm2\n\t"  "vpxor %xmm2, %xmm3, %xmm3\n\t"
+     "vpxor %xmm3, %xmm6, %xmm6\n"
+     "bench_ghash_end:\n\t"
+     ".popsection");
+extern uint8_t bench_ghash[], bench_ghash_end[];
+
+//Shoup's 4-bit method: 16 multiples of H, then one nibble of X per step
+//with the bits shifted out folded back through an 8-bit reduction table
+struct bench_gf {
+    uint64_t hi, lo;
+};
+
+static const uint64_t bench_rem4[16] = {
+    0x0000ULL << 48, 0x1C20ULL << 48, 0x3840ULL << 48, 0x2460ULL << 48,
+    0x7080ULL << 48, 0x6CA0ULL << 48, 0x48C0ULL << 48, 0x54E0ULL << 48,
+    0xE100ULL << 48, 0xFD20ULL << 48, 0xD940ULL << 48, 0xC560ULL << 48,
+    0x9180ULL << 48, 0x8DA0ULL << 48, 0xA9C0ULL << 48, 0xB5E0ULL << 48,
+};
+
+static void bench_gf_init(struct bench_gf t[16], uint64_t hi, uint64_t lo)
+{
+    struct bench_gf v = { hi, lo };
+    uint64_t r;
+    int i, j;
+
+    t[0] = (struct bench_gf){ 0, 0 };
+    t[8] = v;
+    for (i = 4; i > 0; i >>= 1) {
+        r = 0xE100000000000000ULL & (0 - (v.lo & 1));
+        v.lo = (v.hi << 63) | (v.lo >> 1);
+        v.hi = (v.hi >> 1) ^ r;
+        t[i] = v;
+    }
+    for (i = 2; i < 16; i <<= 1) {
+        for (j = 1; j < i; j++) {
+            t[i + j].hi = t[i].hi ^ t[j].hi;
+            t[i + j].lo = t[i].lo ^ t[j].lo;
+        }
+    }
+}
+
+static void bench_gf_mul(uint8_t x[16], const struct bench_gf t[16])
+{
+    struct bench_gf z;
+    uint64_t rem;
+    uint8_t nlo = x[15] & 0xF, nhi = x[15] >> 4;
+    int n = 15;
+
+    z = t[nlo];
+    for (;;) {
+        rem = z.lo & 0xF;
+        z.lo = (z.hi << 60) | (z.lo >> 4);
+        z.hi = (z.hi >> 4) ^ bench_rem4[rem];
+        z.hi ^= t[nhi].hi;
+        z.lo ^= t[nhi].lo;
+        if (--n < 0)
+            break;
+        nlo = x[n] & 0xF;
+        nhi = x[n] >> 4;
+        rem = z.lo & 0xF;
+        z.lo = (z.hi << 60) | (z.lo >> 4);
+        z.hi = (z.hi >> 4) ^ bench_rem4[rem];
+        z.hi ^= t[nlo].hi;
+        z.lo ^= t[nlo].lo;
+    }
+    for (n = 0; n < 8; n++) {
+        x[n] = z.hi >> (56 - n * 8);
+        x[n + 8] = z.lo >> (56 - n * 8);
+    }
+}
+
+//GHASH cycles per 16-byte block: the sequence one handler call per
+//instruction (each one a trap), fused in one call, and one table multiply
+//with the 16 multiples of H kept across blocks or rebuilt every block
+static void bench_gcm(long iterations)
+{
+    struct bench_gf t[16];
+    struct pt_regs regs;
+    XMM x[2];
+    uint8_t *p;
+    uint64_t start, end, cycles;
+    long i;
+    int traps = 0, bytes;
+
+    memset(&regs, 0, sizeof(regs));
+    regs.cs = 0x33;
+    for (i = 0; i < 32; i++)
+        ((uint8_t *)x)[i] = rand();
+    for (p = bench_ghash; p < bench_ghash_end; p += bytes, traps++) {
+        bytes = vex_ins(p, &regs);
+        if (!bytes)
+            return;
+    }
+
+    printf("\n%-12s %10s %10s  cycles/16 bytes\n", "gcm", "cycles", "traps");
+
+    cycles = 0;
+    for (i = 0; i < iterations; i++) {
+        start = __rdtsc();
+        for (p = bench_ghash; p < bench_ghash_end; p += vex_ins(p, &regs))
+            ;
+        end = __rdtsc();
+        cycles += end - start;
+    }
+    printf("%-12s %10.1f %10d\n", "unfused", (double)cycles / iterations, traps);
+
+    regs.ip = (uint64_t)bench_ghash;
+    if (opemu_fuse(bench_ghash, &regs, 0) == bench_ghash_end - bench_ghash) {
+        start = __rdtsc();
+        for (i = 0; i < iterations; i++)
+            opemu_fuse(bench_ghash, &regs, 0);
+        end = __rdtsc();
+        printf("%-12s %10.1f %10d\n", "fused", (double)(end - start) / iterations, 1);
+    }
+
+    bench_gf_init(t, x[1].u64[1], x[1].u64[0]);
+    start = __rdtsc();
+    for (i = 0; i < iterations; i++) {
+        bench_gf_mul(x[0].u8, t);
+        asm volatile ("" : : "r" (x) : "memory");
+    }
+    end = __rdtsc();
+    printf("%-12s %10.1f %10d\n", "table 4-bit", (double)(end - start) / iterations, 1);
+
+    start = __rdtsc();
+    for (i = 0; i < iterations; i++) {
+        bench_gf_init(t, x[1].u64[1], x[1].u64[0]);
+        bench_gf_mul(x[0].u8, t);
+        asm volatile ("" : : "r" (x), "r" (t) : "memory");
+    }
+    end = __rdtsc();
+    printf("%-12s %10.1f %10d\n", "table+init", (double)(end - start) / iterations, 1);
+}
+
+//a full save and restore of the task's state, what kernel_fpu_begin/end would add
+static double bench_fpu_save(long iterations)
+{
+    static uint8_t area[16384] __attribute__((aligned(64)));
+    uint32_t lo, hi;
+    uint64_t start, end;
+    long i;
+
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("avx"))
+        return 0;
+    asm volatile ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+    memset(area, 0, sizeof(area));
+
+    start = __rdtsc();
+    for (i = 0; i < iterations; i++) {
+        asm volatile ("xsave64 %0" : "+m" (area) : "a" (lo), "d" (hi));
+        asm volatile ("xrstor64 %0" :: "m" (area), "a" (lo), "d" (hi));
+    }
+    end = __rdtsc();
+
+    return (double)(end - start) / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = (argc > 1) ? atol(argv[1]) : 100000;
+    uint64_t before[4], after[4];
+    double cycles, save, sse, soft;
+    unsigned int i;
+    int mode, err, decode = 0;
+
+    if (iterations <= 0)
+        iterations = 100000;
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        printf("note: this CPU has AVX2, nothing traps\n");
+
+    for (mode = OPEMU_MODE_KERNEL; mode <= OPEMU_MODE_UPCALL; mode++) {
+        err = opemu_stub_register(mode);
+        if (err) {
+            printf("%-8s unavailable (%d)\n", bench_names[mode], err);
+            continue;
+        }
+        if ((mode == OPEMU_MODE_KERNEL) && bench_decode_stat(before))
+            decode = 1;
+        bench_run(iterations / 10);
+        printf("%-8s %10.1f ns/instruction\n", bench_names[mode], bench_run(iterations));
+        //this binary is dynamically linked, its text a MAP_PRIVATE file mapping
+        if (decode && bench_decode_stat(after)) {
+            printf("%-8s hits %llu misses %llu stale %llu uncached %llu\n", "decode",
+                   (unsigned long long)(after[0] - before[0]), (unsigned long long)(after[1] - before[1]),
+                   (unsigned long long)(after[2] - before[2]), (unsigned long long)(after[3] - before[3]));
+            decode = 0;
+        }
+    }
+
+    opemu_stub_register(OPEMU_MODE_KERNEL);
+
+    bench_stub(iterations / 10);
+    printf("%-8s %10.1f ns/instruction\n", "stub", bench_stub(iterations));
+    printf("%-8s %10.1f ns/trap\n", "sigill", bench_sigill(iterations));
+
+    if (bench_exec(iterations, &cycles))
+        printf("%-8s unavailable\n", "exec");
+    else
+        printf("%-8s %10.1f cycles/instruction\n", "exec", cycles);
+
+    save = bench_fpu_save(iterations / 10);
+    printf("\n%-12s %10s %10s %10s  cycles/instruction\n", "backend", "sse", "sse+save", "soft");
+    for (i = 0; i < sizeof(bench_fp) / sizeof(bench_fp[0]); i++) {
+        sse = bench_backend(bench_fp[i].bytes, iterations, 0);
+        soft = bench_backend(bench_fp[i].bytes, iterations, 1);
+        printf("%-12s %10.1f %10.1f %10.1f\n", bench_fp[i].name, sse, sse + save, soft);
+    }
+
+    printf("\n%-12s %10s %10s  cycles/operation\n", "integer", "sse2", "soft");
+    for (i = 0; i < sizeof(bench_int) / sizeof(bench_int[0]); i++) {
+        sse = bench_int_op(bench_int[i].fn, iterations, 0);
+        soft = bench_int_op(bench_int[i].fn, iterations, 1);
+        printf("%-12s %10.1f %10.1f\n", bench_int[i].name, sse, soft);
+    }
+
+    printf("\n%-12s %10s %10s  16x16 SADs/second\n", "video", "sse2", "soft");
+    sse = bench_motion(iterations / 100 + 1, 0);
+    soft = bench_motion(iterations / 100 + 1, 1);
+    printf("%-12s %10.3g %10.3g\n", "motion", sse, soft);
+
+    bench_gcm(iterations);
+    return 0;
+}
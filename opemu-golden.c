@@ -0,0 +1,346 @@
+//
+//  opemu-golden.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Golden vectors for the selftest=1 module parameter. Run on a host
+//  that has AVX2, FMA, F16C, BMI1/2 and AES: every register-form VEX
+//  encoding and legacy 0F38/0F3A encoding the handlers accept, and the
+//  gathers in VSIB form, is run on the hardware and through the
+//  handlers with both backends from the selftest image. An encoding
+//  goes in selftest_vecs when all three agree on ymm0, ymm2, rax, rcx,
+//  rdx and the EFLAGS bits the instruction defines, and both backends
+//  leave whole the registers the hardware did not touch. The others go
+//  in selftest_known with the hardware's digest and the backends that
+//  differ, and are listed on stderr. The tables are written to stdout.
+//
+//  usage: opemu-golden > selftest_vec.h
+
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "optrap.h"
+#include "softfloat.h"
+#include "selftest.h"
+
+struct golden_state {
+    uint8_t ymm[16][32];
+    uint64_t ax, cx, dx, flags;
+};
+
+static struct selftest_image golden_image;
+static XMM golden_xfile[16] __attribute__((aligned(16)));
+static uint8_t *golden_page;
+static int golden_nvecs, golden_nknown;
+//selftest_known entries, printed after selftest_vecs
+static FILE *golden_known;
+static char *golden_known_buf;
+static size_t golden_known_size;
+static sigjmp_buf golden_fault;
+
+//undefined bits the hardware may set differently: all, then without AF/PF, then without SF
+static const uint16_t golden_masks[3] = { 0x8D5, 0x8C1, 0x841 };
+
+static void golden_segv(int sig)
+{
+    siglongjmp(golden_fault, 1);
+}
+
+static void golden_start(struct golden_state *s)
+{
+    memcpy(s->ymm, golden_image.ymm, sizeof(s->ymm));
+    s->ax = golden_image.ax;
+    s->cx = golden_image.cx;
+    s->dx = golden_image.dx;
+    s->flags = SELFTEST_FLAGS;
+}
+
+/** The instruction itself. returns 0 if it faulted (not on this host). **/
+static int golden_hw(const uint8_t *b, int len, struct golden_state *s)
+{
+    uint64_t ax = s->ax, cx = s->cx, dx = s->dx, flags = s->flags;
+    uint32_t mxcsr = SELFTEST_MXCSR;
+
+    memcpy(golden_page, b, len);
+    golden_page[len] = 0xC3;
+    if (sigsetjmp(golden_fault, 1))
+        return 0;
+    //the red zone is below rsp, the pushes and the call go under it
+    asm volatile ("ldmxcsr %5\n\t"
+                  "sub $128, %%rsp\n\t"
+                  "vmovdqu 0(%4), %%ymm0\n\t"   "vmovdqu 32(%4), %%ymm1\n\t"
+                  "vmovdqu 64(%4), %%ymm2\n\t"  "vmovdqu 96(%4), %%ymm3\n\t"
+                  "vmovdqu 128(%4), %%ymm4\n\t" "vmovdqu 160(%4), %%ymm5\n\t"
+                  "vmovdqu 192(%4), %%ymm6\n\t" "vmovdqu 224(%4), %%ymm7\n\t"
+                  "vmovdqu 256(%4), %%ymm8\n\t" "vmovdqu 288(%4), %%ymm9\n\t"
+                  "vmovdqu 320(%4), %%ymm10\n\t" "vmovdqu 352(%4), %%ymm11\n\t"
+                  "vmovdqu 384(%4), %%ymm12\n\t" "vmovdqu 416(%4), %%ymm13\n\t"
+                  "vmovdqu 448(%4), %%ymm14\n\t" "vmovdqu 480(%4), %%ymm15\n\t"
+                  "push %4\n\t"
+                  "push %3\n\t"
+                  "popfq\n\t"
+                  "call *%6\n\t"
+                  "pushfq\n\t"
+                  "pop %3\n\t"
+                  "pop %4\n\t"
+                  "add $128, %%rsp\n\t"
+                  "vmovdqu %%ymm0, 0(%4)\n\t"   "vmovdqu %%ymm1, 32(%4)\n\t"
+                  "vmovdqu %%ymm2, 64(%4)\n\t"  "vmovdqu %%ymm3, 96(%4)\n\t"
+                  "vmovdqu %%ymm4, 128(%4)\n\t" "vmovdqu %%ymm5, 160(%4)\n\t"
+                  "vmovdqu %%ymm6, 192(%4)\n\t" "vmovdqu %%ymm7, 224(%4)\n\t"
+                  "vmovdqu %%ymm8, 256(%4)\n\t" "vmovdqu %%ymm9, 288(%4)\n\t"
+                  "vmovdqu %%ymm10, 320(%4)\n\t" "vmovdqu %%ymm11, 352(%4)\n\t"
+                  "vmovdqu %%ymm12, 384(%4)\n\t" "vmovdqu %%ymm13, 416(%4)\n\t"
+                  "vmovdqu %%ymm14, 448(%4)\n\t" "vmovdqu %%ymm15, 480(%4)\n\t"
+                  "vzeroupper"
+                  : "+a" (ax), "+c" (cx), "+d" (dx), "+r" (flags)
+                  : "b" (s->ymm), "m" (mxcsr), "D" (golden_page), "S" (&golden_image.mem[SELFTEST_MEM / 2])
+                  : "memory", "cc", "r8", "r9", "r10", "r11",
+                    "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+                    "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15");
+    s->ax = ax;
+    s->cx = cx;
+    s->dx = dx;
+    s->flags = flags;
+    return 1;
+}
+
+/** Through the handlers. returns 0 unless they took exactly len bytes. **/
+static int golden_emu(uint8_t *b, int len, int vex, struct golden_state *s)
+{
+    struct pt_regs regs;
+    int n, bytes;
+
+    memset(&regs, 0, sizeof(regs));
+    regs.ax = s->ax;
+    regs.cx = s->cx;
+    regs.dx = s->dx;
+    regs.si = (uint64_t)&golden_image.mem[SELFTEST_MEM / 2];
+    regs.ip = (uint64_t)b;
+    regs.cs = 0x33;
+    regs.ss = 0x2b;
+    regs.flags = s->flags;
+    if (sigsetjmp(golden_fault, 1))
+        return 0;
+
+    //regs is built with SSE stores, they must not sink below the loads
+    asm volatile ("ldmxcsr %0" :: "m" ((uint32_t){ SELFTEST_MXCSR }) : "memory");
+    //on a saved XMM file like the stub, compiled temporaries stay off the operands
+    for (n = 0; n < 16; n++) {
+        _copy_u128(&_vymm(n)->u128[1], &s->ymm[n][16]);
+        _copy_u128(&golden_xfile[n], &s->ymm[n][0]);
+    }
+    opemu_xfile = golden_xfile;
+    bytes = vex ? vex_ins(b, &regs) : rex_ins(b, &regs);
+    opemu_xfile = NULL;
+    for (n = 0; n < 16; n++) {
+        _copy_u128(&s->ymm[n][0], &golden_xfile[n]);
+        _copy_u128(&s->ymm[n][16], &_vymm(n)->u128[1]);
+    }
+    s->ax = regs.ax;
+    s->cx = regs.cx;
+    s->dx = regs.dx;
+    s->flags = regs.flags;
+    return bytes == len;
+}
+
+static uint64_t golden_sum(const struct golden_state *s, int width, uint16_t mask)
+{
+    return selftest_sum(s->ymm[0], s->ymm[2], width, s->ax, s->cx, s->dx, s->flags & mask);
+}
+
+/** Registers the hardware left whole: the instruction does not name them. **/
+static uint16_t golden_keep(const struct golden_state *in, const struct golden_state *hw)
+{
+    uint16_t keep = 0;
+    int n;
+
+    for (n = 0; n < 16; n++) {
+        if (!memcmp(in->ymm[n], hw->ymm[n], 32))
+            keep |= 1 << n;
+    }
+    return keep;
+}
+
+/** 1 when s has the hardware's digest under mask and every kept register whole. **/
+static int golden_match(const struct golden_state *s, const struct golden_state *in, uint16_t keep,
+                        int width, uint16_t mask, uint64_t sum)
+{
+    int n;
+
+    if (golden_sum(s, width, mask) != sum)
+        return 0;
+    for (n = 0; n < 16; n++) {
+        if (((keep >> n) & 1) && memcmp(s->ymm[n], in->ymm[n], 32))
+            return 0;
+    }
+    return 1;
+}
+
+static void golden_print(FILE *f, const uint8_t *b, int len, int vex, int width, uint16_t mask,
+                         uint16_t keep, uint64_t sum)
+{
+    int i;
+
+    fprintf(f, "{ {");
+    for (i = 0; i < SELFTEST_CODE; i++)
+        fprintf(f, " 0x%02X,", (i < len) ? b[i] : 0);
+    fprintf(f, " }, %d, %d, %d, 0x%03X, 0x%04X, 0x%016llXULL }", len, vex, width, mask, keep,
+            (unsigned long long)sum);
+}
+
+static void golden_add(const uint8_t *bytes, int len, int vex, int width)
+{
+    struct golden_state in, hw, native, soft;
+    uint8_t b[SELFTEST_CODE + 16] = { 0 };
+    uint16_t keep;
+    uint64_t sum = 0;
+    char name[64];
+    int m, ok, backends;
+
+    memcpy(b, bytes, len);
+    golden_start(&in);
+
+    //what the handlers take as exactly this instruction
+    native = in;
+    opemu_softfp_user = 0;
+    if (!golden_emu(b, len, vex, &native))
+        return;
+    hw = in;
+    if (!golden_hw(b, len, &hw))
+        return;
+    soft = in;
+    opemu_softfp_user = 1;
+    ok = golden_emu(b, len, vex, &soft);
+    keep = golden_keep(&in, &hw);
+
+    //undefined flag bits dropped one set at a time, the last mask is the loosest
+    for (m = 0; m < 3; m++) {
+        sum = golden_sum(&hw, width, golden_masks[m]);
+        if (ok && golden_match(&native, &in, keep, width, golden_masks[m], sum) &&
+            golden_match(&soft, &in, keep, width, golden_masks[m], sum)) {
+            printf("    ");
+            golden_print(stdout, b, len, vex, width, golden_masks[m], keep, sum);
+            printf(",\n");
+            golden_nvecs++;
+            return;
+        }
+    }
+
+    backends = 0;
+    if (!golden_match(&native, &in, keep, width, golden_masks[2], sum))
+        backends |= SELFTEST_NATIVE;
+    if (!ok || !golden_match(&soft, &in, keep, width, golden_masks[2], sum))
+        backends |= SELFTEST_SOFT;
+    selftest_name(b, len, vex, name, sizeof(name));
+    fprintf(golden_known, "    { ");
+    golden_print(golden_known, b, len, vex, width, golden_masks[2], keep, sum);
+    fprintf(golden_known, ", %d },   //%s\n", backends, name);
+    fprintf(stderr, "differs from hardware: %s%s%s\n", name,
+            (backends & SELFTEST_NATIVE) ? " native" : "", (backends & SELFTEST_SOFT) ? " soft" : "");
+    golden_nknown++;
+}
+
+static void golden_enumerate(void)
+{
+    static const uint8_t imms[4] = { 0x00, 0x1B, 0x7F, 0xE4 };
+    static const uint8_t legacy_pp[4] = { 0x00, 0x66, 0xF3, 0xF2 };
+    uint8_t b[SELFTEST_CODE];
+    int map, op, pp, L, W, vsib, i, n, imm;
+
+    for (map = 1; map <= 3; map++)
+    for (op = 0; op < 256; op++)
+    for (pp = 0; pp < 4; pp++)
+    for (L = 0; L < 2; L++)
+    for (W = 0; W < 2; W++) {
+        //vmaskmovdqu stores to [rdi]
+        if ((map == 1) && (op == 0xF7))
+            continue;
+        vsib = (map == 2) && (op >= 0x90) && (op <= 0x93);
+        imm = (map == 3) || ((map == 1) && (((op >= 0x70) && (op <= 0x73)) || (op == 0xC2) ||
+                                            ((op >= 0xC4) && (op <= 0xC6))));
+        for (i = 0; i < (imm ? 4 : 1); i++) {
+            //vvvv = 2, ModRM.reg = 0, r/m = 1 or VSIB [rsi + ymm3 * 8]
+            b[0] = 0xC4;
+            b[1] = 0xE0 | map;
+            b[2] = (W << 7) | (0xD << 3) | (L << 2) | pp;
+            b[3] = op;
+            if (vsib) {
+                b[4] = 0x04;
+                b[5] = 0xDE;
+                n = 6;
+            } else {
+                b[4] = 0xC1;
+                n = 5;
+            }
+            if (imm)
+                b[n++] = imms[i];
+            golden_add(b, n, 1, L ? 32 : 16);
+        }
+    }
+
+    for (pp = 0; pp < 4; pp++)
+    for (map = 2; map <= 3; map++)
+    for (op = 0; op < 256; op++) {
+        for (i = 0; i < ((map == 3) ? 4 : 1); i++) {
+            n = 0;
+            if (legacy_pp[pp])
+                b[n++] = legacy_pp[pp];
+            b[n++] = 0x0F;
+            b[n++] = (map == 2) ? 0x38 : 0x3A;
+            b[n++] = op;
+            b[n++] = 0xC1;
+            if (map == 3)
+                b[n++] = imms[i];
+            golden_add(b, n, 0, 16);
+        }
+    }
+}
+
+int main(void)
+{
+    char model[49] = { 0 };
+    unsigned int r[4];
+    int i;
+
+    golden_page = mmap(NULL, 4096, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (golden_page == MAP_FAILED)
+        return 1;
+    signal(SIGILL, golden_segv);
+    signal(SIGSEGV, golden_segv);
+    signal(SIGBUS, golden_segv);
+    signal(SIGFPE, golden_segv);
+    selftest_fill(&golden_image);
+    golden_known = open_memstream(&golden_known_buf, &golden_known_size);
+    if (!golden_known)
+        return 1;
+
+    for (i = 0; i < 3; i++) {
+        asm volatile ("cpuid" : "=a" (r[0]), "=b" (r[1]), "=c" (r[2]), "=d" (r[3]) : "a" (0x80000002 + i), "c" (0));
+        memcpy(&model[i * 16], r, 16);
+    }
+
+    printf("//\n//  selftest_vec.h\n//  opemu\n//\n");
+    printf("//  Generated by opemu-golden on %s.\n", model);
+    printf("//  Regenerate with make golden && ./opemu-golden > selftest_vec.h\n\n");
+    printf("#ifndef selftest_vec_h\n#define selftest_vec_h\n\n");
+    printf("static const struct selftest_vec selftest_vecs[] = {\n");
+    golden_enumerate();
+    printf("};\n\n");
+    //the hardware's digest, the selftest reports these and checks the other backend
+    fclose(golden_known);
+    printf("static const struct selftest_known selftest_known[] = {\n%s};\n\n", golden_known_buf);
+    printf("#endif /* selftest_vec_h */\n");
+    free(golden_known_buf);
+
+    fprintf(stderr, "%d vectors, %d encodings differ from hardware\n", golden_nvecs, golden_nknown);
+    return 0;
+}
@@ -0,0 +1,425 @@
+//
+//  opemu-profd.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Warm-start daemon. Watches the executable file mappings of all
+//  processes; when a binary with a known ELF build-id shows up, its
+//  saved hot sites are preloaded into the shared decode cache, and the
+//  sites hot in the cache are saved back as <dir>/<build-id>.prof.
+//
+//  New processes are reported by the proc connector: PROFD_SETTLE_MS
+//  after an exec, once the dynamic loader has mapped the libraries,
+//  the maps of that process alone are read. Every -i seconds all of
+//  /proc/*/maps is read (libraries opened later with dlopen) and the
+//  profiles are saved. Without the connector (no CAP_NET_ADMIN, or
+//  CONFIG_PROC_EVENTS off) only the periodic scan runs.
+//
+//  usage: opemu-profd [-d dir] [-i seconds] [-1]
+
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+
+#include "opemu_ioctl.h"
+
+#define PROFD_DIR       "/var/cache/opemu"
+#define PROFD_FILES     1024
+#define PROFD_PENDING   256     //execs waiting for their maps to settle
+#define PROFD_SETTLE_MS 100
+
+struct profd_file {
+    dev_t dev;
+    ino_t ino;
+    char path[256];
+    char buildid[41];
+};
+
+struct profd_header {
+    uint32_t magic;
+    uint32_t count;
+};
+
+static struct profd_file profd_files[PROFD_FILES];
+static int profd_nfiles;
+static const char *profd_dir = PROFD_DIR;
+static int profd_fd = -1;
+static pid_t profd_pending[PROFD_PENDING];
+static int profd_npending;
+
+/** Hex GNU build-id of an ELF64 file. returns 0 or -1. **/
+static int profd_buildid(int fd, char *out)
+{
+    Elf64_Ehdr eh;
+    Elf64_Phdr ph;
+    unsigned char note[1024];
+    size_t pos;
+    int i, j;
+
+    if ((pread(fd, &eh, sizeof(eh), 0) != sizeof(eh)) || memcmp(eh.e_ident, ELFMAG, SELFMAG) ||
+        (eh.e_ident[EI_CLASS] != ELFCLASS64) || (eh.e_phentsize != sizeof(ph)))
+        return -1;
+
+    for (i = 0; i < eh.e_phnum; i++) {
+        if (pread(fd, &ph, sizeof(ph), eh.e_phoff + i * sizeof(ph)) != sizeof(ph))
+            return -1;
+        if ((ph.p_type != PT_NOTE) || (ph.p_filesz > sizeof(note)))
+            continue;
+        if (pread(fd, note, ph.p_filesz, ph.p_offset) != (ssize_t)ph.p_filesz)
+            continue;
+
+        for (pos = 0; pos + sizeof(Elf64_Nhdr) <= ph.p_filesz; ) {
+            Elf64_Nhdr *nh = (Elf64_Nhdr *)&note[pos];
+            size_t name = pos + sizeof(*nh);
+            size_t desc = name + ((nh->n_namesz + 3) & ~3);
+
+            if (desc + nh->n_descsz > ph.p_filesz)
+                break;
+            if ((nh->n_type == NT_GNU_BUILD_ID) && (nh->n_namesz == 4) && !memcmp(&note[name], "GNU", 4) &&
+                (nh->n_descsz <= 20)) {
+                for (j = 0; j < (int)nh->n_descsz; j++)
+                    sprintf(&out[j * 2], "%02x", note[desc + j]);
+                return 0;
+            }
+            pos = desc + ((nh->n_descsz + 3) & ~3);
+        }
+    }
+    return -1;
+}
+
+static void profd_path(char *path, size_t len, const struct profd_file *pf)
+{
+    snprintf(path, len, "%s/%s.prof", profd_dir, pf->buildid);
+}
+
+/** Saved sites of a build-id, malloc'd. returns the count, 0 if none. **/
+static uint32_t profd_read(const struct profd_file *pf, struct opemu_profile_site **sites)
+{
+    struct profd_header hdr;
+    char path[512];
+    FILE *f;
+
+    *sites = NULL;
+    profd_path(path, sizeof(path), pf);
+    f = fopen(path, "rb");
+    if (!f)
+        return 0;
+    if ((fread(&hdr, sizeof(hdr), 1, f) != 1) || (hdr.magic != OPEMU_PROFILE_MAGIC) ||
+        (hdr.count > OPEMU_PROFILE_MAX)) {
+        fclose(f);
+        return 0;
+    }
+    *sites = calloc(hdr.count ? hdr.count : 1, sizeof(**sites));
+    if (!*sites || (fread(*sites, sizeof(**sites), hdr.count, f) != hdr.count)) {
+        fclose(f);
+        free(*sites);
+        *sites = NULL;
+        return 0;
+    }
+    fclose(f);
+    return hdr.count;
+}
+
+static void profd_load(const struct profd_file *pf, int fd)
+{
+    struct opemu_profile_req req;
+    struct opemu_profile_site *sites;
+    uint32_t n;
+
+    n = profd_read(pf, &sites);
+    if (!n)
+        return;
+
+    req.fd = fd;
+    req.count = n;
+    req.sites = (uint64_t)(unsigned long)sites;
+    if (ioctl(profd_fd, OPEMU_IOC_LOAD_PROFILE, &req) == 0)
+        printf("opemu-profd: %s: preloaded %u sites (%s)\n", pf->path, req.count, pf->buildid);
+    else
+        fprintf(stderr, "opemu-profd: %s: %s\n", pf->path, strerror(errno));
+    free(sites);
+}
+
+static int profd_site_cmp(const void *a, const void *b)
+{
+    const struct opemu_profile_site *x = a;
+    const struct opemu_profile_site *y = b;
+
+    return (x->hits < y->hits) - (x->hits > y->hits);
+}
+
+//cache sites first, then saved sites not in the cache any more
+static void profd_save(const struct profd_file *pf)
+{
+    struct opemu_profile_site *sites, *old;
+    struct opemu_profile_req req;
+    struct profd_header hdr;
+    char path[512], tmp[520];
+    uint32_t n, nold, i, j;
+    FILE *f;
+    int fd;
+
+    fd = open(pf->path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    sites = calloc(OPEMU_PROFILE_MAX, sizeof(*sites));
+    req.fd = fd;
+    req.count = OPEMU_PROFILE_MAX;
+    req.sites = (uint64_t)(unsigned long)sites;
+    if (!sites || ioctl(profd_fd, OPEMU_IOC_GET_PROFILE, &req) || !req.count) {
+        close(fd);
+        free(sites);
+        return;
+    }
+    close(fd);
+    n = req.count;
+
+    nold = profd_read(pf, &old);
+    for (i = 0; (i < nold) && (n < OPEMU_PROFILE_MAX); i++) {
+        for (j = 0; j < req.count; j++) {
+            if (sites[j].offset == old[i].offset)
+                break;
+        }
+        if (j == req.count)
+            sites[n++] = old[i];
+    }
+    free(old);
+    qsort(sites, n, sizeof(*sites), profd_site_cmp);
+
+    profd_path(path, sizeof(path), pf);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    f = fopen(tmp, "wb");
+    if (f) {
+        hdr.magic = OPEMU_PROFILE_MAGIC;
+        hdr.count = n;
+        if ((fwrite(&hdr, sizeof(hdr), 1, f) == 1) && (fwrite(sites, sizeof(*sites), n, f) == n) && !fclose(f))
+            rename(tmp, path);
+        else
+            unlink(tmp);
+    }
+    free(sites);
+}
+
+//a newly seen executable mapping: remember it and preload its profile
+static void profd_seen(const char *path)
+{
+    struct profd_file *pf;
+    struct stat st;
+    int fd, i;
+
+    if (stat(path, &st) || !S_ISREG(st.st_mode))
+        return;
+    for (i = 0; i < profd_nfiles; i++) {
+        if ((profd_files[i].dev == st.st_dev) && (profd_files[i].ino == st.st_ino))
+            return;
+    }
+    if (profd_nfiles == PROFD_FILES)
+        return;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    pf = &profd_files[profd_nfiles];
+    memset(pf, 0, sizeof(*pf));
+    if (profd_buildid(fd, pf->buildid)) {
+        close(fd);
+        return;
+    }
+    pf->dev = st.st_dev;
+    pf->ino = st.st_ino;
+    snprintf(pf->path, sizeof(pf->path), "%s", path);
+    profd_nfiles++;
+
+    profd_load(pf, fd);
+    close(fd);
+}
+
+static void profd_scan_pid(const char *pid)
+{
+    char maps[300], line[512], perms[8], path[256];
+    FILE *f;
+
+    snprintf(maps, sizeof(maps), "/proc/%s/maps", pid);
+    f = fopen(maps, "r");
+    if (!f)
+        return;
+    while (fgets(line, sizeof(line), f)) {
+        path[0] = 0;
+        if (sscanf(line, "%*s %7s %*s %*s %*s %255s", perms, path) != 2)
+            continue;
+        if ((perms[2] == 'x') && (path[0] == '/'))
+            profd_seen(path);
+    }
+    fclose(f);
+}
+
+static void profd_scan(void)
+{
+    struct dirent *de;
+    DIR *proc;
+
+    proc = opendir("/proc");
+    if (!proc)
+        return;
+    while ((de = readdir(proc))) {
+        if ((de->d_name[0] >= '0') && (de->d_name[0] <= '9'))
+            profd_scan_pid(de->d_name);
+    }
+    closedir(proc);
+}
+
+/**********************************************/
+/**  proc connector                          **/
+/**********************************************/
+static uint64_t profd_now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/** Subscribe to process events. returns the socket, -1 if not available. **/
+static int profd_connect(void)
+{
+    struct sockaddr_nl sa;
+    struct {
+        struct nlmsghdr nl;
+        struct cn_msg cn;
+        enum proc_cn_mcast_op op;
+    } __attribute__((packed)) req;
+    int fd;
+
+    fd = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+    if (fd < 0)
+        return -1;
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
+    sa.nl_groups = CN_IDX_PROC;
+    if (bind(fd, (struct sockaddr *)&sa, sizeof(sa)))
+        goto fail;
+
+    memset(&req, 0, sizeof(req));
+    req.nl.nlmsg_len = sizeof(req);
+    req.nl.nlmsg_type = NLMSG_DONE;
+    req.cn.id.idx = CN_IDX_PROC;
+    req.cn.id.val = CN_VAL_PROC;
+    req.cn.len = sizeof(req.op);
+    req.op = PROC_CN_MCAST_LISTEN;
+    if (send(fd, &req, sizeof(req), 0) != sizeof(req))
+        goto fail;
+    return fd;
+
+fail:
+    close(fd);
+    return -1;
+}
+
+/** Queue the tgid of every exec. returns -1 if events were lost. **/
+static int profd_events(int fd)
+{
+    char buf[8192] __attribute__((aligned(NLMSG_ALIGNTO)));
+    struct nlmsghdr *nh;
+    struct proc_event *ev;
+    ssize_t len;
+
+    while ((len = recv(fd, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+        for (nh = (struct nlmsghdr *)buf; NLMSG_OK(nh, len); nh = NLMSG_NEXT(nh, len)) {
+            ev = (struct proc_event *)((struct cn_msg *)NLMSG_DATA(nh))->data;
+            if (ev->what != PROC_EVENT_EXEC)
+                continue;
+            if (profd_npending == PROFD_PENDING)
+                return -1;
+            profd_pending[profd_npending++] = ev->event_data.exec.process_tgid;
+        }
+    }
+    return ((len < 0) && (errno == ENOBUFS)) ? -1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    struct pollfd pfd;
+    uint64_t deadline, settle, now, wait;
+    char pid[16];
+    int interval = 10;
+    int once = 0;
+    int opt, i;
+
+    while ((opt = getopt(argc, argv, "d:i:1")) != -1) {
+        switch (opt) {
+            case 'd': profd_dir = optarg; break;
+            case 'i': interval = atoi(optarg); break;
+            case '1': once = 1; break;
+            default:
+                fprintf(stderr, "usage: %s [-d dir] [-i seconds] [-1]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (interval <= 0)
+        interval = 10;
+
+    profd_fd = open(OPEMU_DEVICE, O_RDWR | O_CLOEXEC);
+    if (profd_fd < 0) {
+        perror(OPEMU_DEVICE);
+        return 1;
+    }
+    mkdir(profd_dir, 0755);
+
+    pfd.fd = once ? -1 : profd_connect();
+    pfd.events = POLLIN;
+    if (!once && (pfd.fd < 0))
+        fprintf(stderr, "opemu-profd: no proc connector, scanning every %d s only\n", interval);
+
+    for (;;) {
+        profd_scan();
+        for (i = 0; i < profd_nfiles; i++)
+            profd_save(&profd_files[i]);
+        if (once)
+            break;
+
+        deadline = profd_now_ms() + (uint64_t)interval * 1000;
+        settle = 0;
+        while ((now = profd_now_ms()) < deadline) {
+            if (settle && (now >= settle)) {
+                for (i = 0; i < profd_npending; i++) {
+                    snprintf(pid, sizeof(pid), "%d", profd_pending[i]);
+                    profd_scan_pid(pid);
+                }
+                profd_npending = 0;
+                settle = 0;
+                continue;
+            }
+            wait = (settle ? settle : deadline) - now;
+            if ((poll(&pfd, 1, (int)wait) > 0) && (pfd.revents & POLLIN)) {
+                //lost events: the full scan catches up
+                if (profd_events(pfd.fd) < 0) {
+                    profd_npending = 0;
+                    break;
+                }
+                if (profd_npending && !settle)
+                    settle = profd_now_ms() + PROFD_SETTLE_MS;
+            }
+        }
+    }
+
+    if (pfd.fd >= 0)
+        close(pfd.fd);
+    close(profd_fd);
+    return 0;
+}
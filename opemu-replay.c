@@ -0,0 +1,278 @@
+//
+//  opemu-replay.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Replays a recorded emulation trace through the userspace build of
+//  the handlers, checks each result against the recorded post-state
+//  and reports the emulation throughput on that instruction mix.
+//
+//  echo 1 > /sys/kernel/debug/opemu/trace_enable
+//  cat /sys/kernel/debug/opemu/trace > trace.bin
+//  usage: opemu-replay trace.bin [passes]
+
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+//pages holding the instruction and the memory window
+#define REPLAY_PAGES 4
+
+static void *replay_pages[REPLAY_PAGES];
+static int replay_npages;
+static sigjmp_buf replay_fault;
+static XMM replay_xfile[16] __attribute__((aligned(16)));
+
+static void replay_segv(int sig)
+{
+    siglongjmp(replay_fault, 1);
+}
+
+static uint64_t replay_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void replay_unmap(void)
+{
+    while (replay_npages)
+        munmap(replay_pages[--replay_npages], PAGE_SIZE);
+}
+
+/** Map the recorded addresses [addr, addr + len) at their own place. returns 0 or -1. **/
+static int replay_map(uint64_t addr, uint64_t len)
+{
+    uint64_t page;
+    void *p;
+    int i;
+
+    for (page = addr & ~(PAGE_SIZE - 1); page < addr + len; page += PAGE_SIZE) {
+        for (i = 0; i < replay_npages; i++) {
+            if (replay_pages[i] == (void *)page)
+                break;
+        }
+        if (i < replay_npages)
+            continue;
+        if (replay_npages == REPLAY_PAGES)
+            return -1;
+
+        p = mmap((void *)page, PAGE_SIZE, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (p == MAP_FAILED)
+            return -1;
+        if (p != (void *)page) {
+            munmap(p, PAGE_SIZE);
+            return -1;
+        }
+        replay_pages[replay_npages++] = p;
+    }
+    return 0;
+}
+
+static void replay_regs_in(struct pt_regs *regs, const struct opemu_trace_regs *t)
+{
+    regs->r15 = t->r15;
+    regs->r14 = t->r14;
+    regs->r13 = t->r13;
+    regs->r12 = t->r12;
+    regs->bp = t->bp;
+    regs->bx = t->bx;
+    regs->r11 = t->r11;
+    regs->r10 = t->r10;
+    regs->r9 = t->r9;
+    regs->r8 = t->r8;
+    regs->ax = t->ax;
+    regs->cx = t->cx;
+    regs->dx = t->dx;
+    regs->si = t->si;
+    regs->di = t->di;
+    regs->orig_ax = t->orig_ax;
+    regs->ip = t->ip;
+    regs->cs = t->cs;
+    regs->flags = t->flags;
+    regs->sp = t->sp;
+    regs->ss = t->ss;
+}
+
+static void replay_regs_out(struct opemu_trace_regs *t, const struct pt_regs *regs)
+{
+    t->r15 = regs->r15;
+    t->r14 = regs->r14;
+    t->r13 = regs->r13;
+    t->r12 = regs->r12;
+    t->bp = regs->bp;
+    t->bx = regs->bx;
+    t->r11 = regs->r11;
+    t->r10 = regs->r10;
+    t->r9 = regs->r9;
+    t->r8 = regs->r8;
+    t->ax = regs->ax;
+    t->cx = regs->cx;
+    t->dx = regs->dx;
+    t->si = regs->si;
+    t->di = regs->di;
+    t->orig_ax = regs->orig_ax;
+    t->ip = regs->ip;
+    t->cs = regs->cs;
+    t->flags = regs->flags;
+    t->sp = regs->sp;
+    t->ss = regs->ss;
+}
+
+/** Run one record. returns 0 if it matches, 1 on mismatch, -1 if it could not run. **/
+static int replay_one(const struct opemu_trace_rec *rec, struct opemu_trace_state *out, uint64_t *ns)
+{
+    struct pt_regs regs;
+    uint64_t start, end;
+    int count, n;
+
+    if (replay_map(rec->pre.regs.ip, sizeof(rec->ins)) ||
+        (rec->mem_len && replay_map(rec->mem_addr, rec->mem_len))) {
+        replay_unmap();
+        return -1;
+    }
+    memcpy((void *)rec->pre.regs.ip, rec->ins, sizeof(rec->ins));
+    if (rec->mem_len)
+        memcpy((void *)rec->mem_addr, rec->pre.mem, rec->mem_len);
+    replay_regs_in(&regs, &rec->pre.regs);
+
+    if (sigsetjmp(replay_fault, 1)) {
+        opemu_xfile = NULL;
+        replay_unmap();
+        return -1;
+    }
+
+    //the handlers work on the image, the host registers belong to the compiler
+    for (n = 0; n < 16; n++) {
+        _copy_u128(&_vymm(n)->u128[1], &rec->pre.ymm[n][16]);
+        _copy_u128(&replay_xfile[n], &rec->pre.ymm[n][0]);
+    }
+    start = replay_ns();
+    opemu_xfile = replay_xfile;
+    count = opemu_utrap(&regs, 0);
+    opemu_xfile = NULL;
+    end = replay_ns();
+    for (n = 0; n < 16; n++) {
+        _copy_u128(&out->ymm[n][0], &replay_xfile[n]);
+        _copy_u128(&out->ymm[n][16], &_vymm(n)->u128[1]);
+    }
+    *ns += end - start;
+
+    replay_regs_out(&out->regs, &regs);
+    if (rec->mem_len)
+        memcpy(out->mem, (void *)rec->mem_addr, rec->mem_len);
+    replay_unmap();
+
+    if (count != 1)
+        return 1;
+    if (memcmp(&out->regs, &rec->post.regs, sizeof(out->regs)))
+        return 1;
+    if (memcmp(out->ymm, rec->post.ymm, sizeof(out->ymm)))
+        return 1;
+    if (rec->mem_len && memcmp(out->mem, rec->post.mem, rec->mem_len))
+        return 1;
+    return 0;
+}
+
+static void replay_report(long index, const struct opemu_trace_rec *rec, const struct opemu_trace_state *out)
+{
+    int n;
+
+    printf("mismatch #%ld ip %llx:", index, (unsigned long long)rec->pre.regs.ip);
+    for (n = 0; n < 8; n++)
+        printf(" %02x", rec->ins[n]);
+    if (memcmp(&out->regs, &rec->post.regs, sizeof(out->regs)))
+        printf(" [gpr]");
+    for (n = 0; n < 16; n++) {
+        if (memcmp(out->ymm[n], rec->post.ymm[n], 32))
+            printf(" [ymm%d]", n);
+    }
+    if (rec->mem_len && memcmp(out->mem, rec->post.mem, rec->mem_len))
+        printf(" [mem]");
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    struct opemu_trace_rec *recs;
+    struct opemu_trace_state out;
+    long nrecs = 0, cap = 1024;
+    long replayed = 0, mismatched = 0, skipped = 0;
+    int passes = (argc > 2) ? atoi(argv[2]) : 1;
+    uint64_t ns = 0;
+    FILE *f;
+    long i;
+    int pass, ret;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s trace.bin [passes]\n", argv[0]);
+        return 2;
+    }
+    if (passes <= 0)
+        passes = 1;
+
+    f = fopen(argv[1], "rb");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    recs = malloc(cap * sizeof(*recs));
+    while (recs && (fread(&recs[nrecs], sizeof(*recs), 1, f) == 1)) {
+        if ((recs[nrecs].magic != OPEMU_TRACE_MAGIC) || (recs[nrecs].size != sizeof(*recs))) {
+            fprintf(stderr, "%s: bad record %ld\n", argv[1], nrecs);
+            return 1;
+        }
+        if (++nrecs == cap) {
+            cap *= 2;
+            recs = realloc(recs, cap * sizeof(*recs));
+        }
+    }
+    fclose(f);
+    if (!recs) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    signal(SIGSEGV, replay_segv);
+    signal(SIGBUS, replay_segv);
+
+    for (pass = 0; pass < passes; pass++) {
+        for (i = 0; i < nrecs; i++) {
+            ret = replay_one(&recs[i], &out, &ns);
+            if (ret < 0) {
+                skipped++;
+                continue;
+            }
+            replayed++;
+            if (ret) {
+                if (mismatched++ < 20)
+                    replay_report(i, &recs[i], &out);
+            }
+        }
+    }
+
+    printf("records %ld, replayed %ld, mismatched %ld, skipped %ld\n", nrecs, replayed, mismatched, skipped);
+    if (replayed)
+        printf("%.1f ns/instruction\n", (double)ns / replayed);
+
+    free(recs);
+    return mismatched ? 1 : 0;
+}
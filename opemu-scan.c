@@ -0,0 +1,597 @@
+//
+//  opemu-scan.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Static trap-density scanner. Walks the executable sections of an
+//  ELF64 binary and, for every VEX/EVEX instruction (each one traps on
+//  a host without AVX), asks the emulator itself whether it would
+//  handle it: vex_decode and get_consumed give the length, vex_ins is
+//  run on scratch state. Loops come from backward branches. Reports
+//  per-function counts, unsupported encodings and an estimated
+//  slowdown from per-opcode trap costs (opemu-wcet -o, stats page ids).
+//
+//  usage: opemu-scan [-c costs] [-t trap_ns] [-n native_ns] [-a] elf
+
+#define _GNU_SOURCE
+#include <elf.h>
+#include <fcntl.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "optrap.h"
+#include "decode.h"
+#include "opemu_ioctl.h"
+
+/*********************************************************
+ *** Instruction length tables, 64-bit mode.           ***
+ *********************************************************/
+#define SM  0x01    //ModRM
+#define S8  0x02    //imm8
+#define SZ  0x04    //imm16/32
+#define S16 0x08    //imm16
+#define SO  0x10    //moffs
+#define SB  0x20    //immediate is a branch displacement
+#define SQ  0x40    //imm64 with REX.W
+#define SX  0x80    //invalid or not decoded
+
+static const uint8_t scan_map0[256] = {
+    /* 00 */ SM, SM, SM, SM, S8, SZ, SX, SX, SM, SM, SM, SM, S8, SZ, SX, SX,
+    /* 10 */ SM, SM, SM, SM, S8, SZ, SX, SX, SM, SM, SM, SM, S8, SZ, SX, SX,
+    /* 20 */ SM, SM, SM, SM, S8, SZ, SX, SX, SM, SM, SM, SM, S8, SZ, SX, SX,
+    /* 30 */ SM, SM, SM, SM, S8, SZ, SX, SX, SM, SM, SM, SM, S8, SZ, SX, SX,
+    /* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 60 */ SX, SX, SX, SM, SX, SX, SX, SX, SZ, SM|SZ, S8, SM|S8, 0, 0, 0, 0,
+    /* 70 */ S8|SB, S8|SB, S8|SB, S8|SB, S8|SB, S8|SB, S8|SB, S8|SB,
+             S8|SB, S8|SB, S8|SB, S8|SB, S8|SB, S8|SB, S8|SB, S8|SB,
+    /* 80 */ SM|S8, SM|SZ, SX, SM|S8, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, SX, 0, 0, 0, 0, 0,
+    /* A0 */ SO, SO, SO, SO, 0, 0, 0, 0, S8, SZ, 0, 0, 0, 0, 0, 0,
+    /* B0 */ S8, S8, S8, S8, S8, S8, S8, S8, SZ|SQ, SZ|SQ, SZ|SQ, SZ|SQ, SZ|SQ, SZ|SQ, SZ|SQ, SZ|SQ,
+    /* C0 */ SM|S8, SM|S8, S16, 0, SX, SX, SM|S8, SM|SZ, S16|S8, 0, S16, 0, 0, S8, SX, 0,
+    /* D0 */ SM, SM, SM, SM, SX, SX, SX, 0, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* E0 */ S8|SB, S8|SB, S8|SB, S8|SB, S8, S8, S8, S8, SZ, SZ|SB, SX, S8|SB, 0, 0, 0, 0,
+    /* F0 */ SX, 0, SX, SX, 0, 0, SM, SM, 0, 0, 0, 0, 0, 0, SM, SM,
+};
+
+static const uint8_t scan_map1[256] = {
+    /* 00 */ SM, SM, SM, SM, SX, 0, 0, 0, 0, 0, SX, 0, SX, SM, 0, SM|S8,
+    /* 10 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 20 */ SM, SM, SM, SM, SX, SX, SX, SX, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, SX, SX, SX, SX, SX, SX, SX, SX,
+    /* 40 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 50 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 60 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 70 */ SM|S8, SM|S8, SM|S8, SM|S8, SM, SM, SM, 0, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* 80 */ SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB,
+             SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB, SZ|SB,
+    /* 90 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* A0 */ 0, 0, 0, SM, SM|S8, SM, SX, SX, 0, 0, 0, SM, SM|S8, SM, SM, SM,
+    /* B0 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM|S8, SM, SM, SM, SM, SM,
+    /* C0 */ SM, SM, SM|S8, SM, SM|S8, SM|S8, SM|S8, SM, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* D0 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* E0 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+    /* F0 */ SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM, SM,
+};
+
+//kind of a decoded instruction
+#define SCAN_LEGACY      0
+#define SCAN_EMULATED    1  //VEX, opemu emulates it
+#define SCAN_UNSUPPORTED 2  //VEX/EVEX, opemu does not
+
+//longest loop body taken without a symbol to bound it
+#define SCAN_LOOP_MAX    4096
+
+struct scan_ins {
+    uint64_t addr;
+    uint64_t target;        //backward branch target, 0 if none
+    uint32_t id;            //OPEMU_OPCODE_ID
+    uint16_t ext;           //pp and L of VEX/EVEX, for the report
+    uint8_t len;
+    uint8_t kind;
+    uint32_t depth;         //loop nesting
+};
+
+struct scan_func {
+    uint64_t addr;
+    uint64_t size;
+    const char *name;
+    uint64_t insns;
+    uint64_t emulated;
+    uint64_t unsupported;
+    double native;          //weighted ns
+    double traps;           //weighted ns
+};
+
+struct scan_unsup {
+    uint32_t id;
+    uint16_t ext;
+    uint64_t count;
+    uint64_t first;
+};
+
+static struct scan_ins *scan_ins;
+static size_t scan_nins, scan_capins;
+static struct scan_func *scan_funcs;
+static size_t scan_nfuncs;
+static struct scan_unsup scan_unsups[256];
+static int scan_nunsups;
+
+static double scan_costs[1 << 13];      //by OPEMU_OPCODE_ID
+static double scan_trap_ns = 1000.0;
+static double scan_native_ns = 0.5;
+static int scan_all;
+
+static sigjmp_buf scan_fault;
+
+static struct scan_func *scan_func_of(uint64_t addr);
+
+static void scan_segv(int sig)
+{
+    siglongjmp(scan_fault, 1);
+}
+
+/** Length of a legacy-encoded instruction at p. returns 0 if not decoded. **/
+static int scan_legacy(uint8_t *p, size_t avail, struct scan_ins *ins)
+{
+    uint8_t *start = p;
+    uint8_t flags, opcode;
+    int opsize = 0, adsize = 0, rexw = 0;
+    int map = 0, imm = 0;
+
+    //prefixes, REX last
+    while ((p < start + 14) && ((*p == 0x66) || (*p == 0x67) || (*p == 0xF0) || (*p == 0xF2) || (*p == 0xF3) ||
+                                (*p == 0x2E) || (*p == 0x36) || (*p == 0x3E) || (*p == 0x26) ||
+                                (*p == 0x64) || (*p == 0x65))) {
+        if (*p == 0x66)
+            opsize = 1;
+        if (*p == 0x67)
+            adsize = 1;
+        p++;
+    }
+    if ((*p & 0xF0) == 0x40) {
+        rexw = (*p >> 3) & 1;
+        p++;
+    }
+
+    opcode = *p++;
+    if (opcode == 0x0F) {
+        opcode = *p++;
+        if ((opcode == 0x38) || (opcode == 0x3A)) {
+            map = (opcode == 0x38) ? 2 : 3;
+            opcode = *p++;
+            flags = (map == 3) ? (SM | S8) : SM;
+        } else {
+            map = 1;
+            flags = scan_map1[opcode];
+        }
+    } else {
+        flags = scan_map0[opcode];
+    }
+    if (flags & SX)
+        return 0;
+
+    if ((map == 0) && ((opcode == 0xF6) || (opcode == 0xF7)) && !(p[0] & 0x38))
+        flags |= (opcode == 0xF6) ? S8 : SZ;     //test r/m, imm
+
+    if (flags & SM)
+        p += get_consumed(p);
+    if (flags & S8)
+        imm += 1;
+    if (flags & S16)
+        imm += 2;
+    if (flags & SZ)
+        imm += ((flags & SQ) && rexw) ? 8 : ((opsize && !(flags & SB)) ? 2 : 4);
+    if (flags & SO)
+        imm += adsize ? 4 : 8;
+    p += imm;
+
+    if ((size_t)(p - start) > avail)
+        return 0;
+
+    ins->id = OPEMU_OPCODE_ID(0, map, opcode);
+    if (flags & SB) {
+        int64_t rel = (imm == 1) ? (int8_t)p[-1] : (int32_t)((uint32_t)p[-4] | ((uint32_t)p[-3] << 8) |
+                                                             ((uint32_t)p[-2] << 16) | ((uint32_t)p[-1] << 24));
+        if (rel < 0)
+            ins->target = ins->addr + (p - start) + rel;
+    }
+    return p - start;
+}
+
+/** Length of a VEX/EVEX instruction, through the emulator's own decoder. **/
+static int scan_vex(uint8_t *p, size_t avail, struct scan_ins *ins)
+{
+    struct vex_decode d;
+    uint8_t *q = p;
+    uint8_t opcode;
+    int map, imm, len;
+
+    if (*q == 0x67)
+        q++;
+
+    if (*q == 0x62) {
+        //EVEX: 4 byte prefix, same ModRM/SIB/disp layout
+        map = q[1] & 0x7;
+        opcode = q[4];
+        imm = ((map == 3) || ((map == 1) && (((opcode >= 0x70) && (opcode <= 0x73)) || (opcode == 0xC2) ||
+                                             ((opcode >= 0xC4) && (opcode <= 0xC6))))) ? 1 : 0;
+        len = (q - p) + 5 + get_consumed(&q[5]) - 1 + 1 + imm;
+        ins->id = OPEMU_OPCODE_ID(1, map & 3, opcode);
+        ins->ext = 0x100 | (((q[3] >> 5) & 0x3) << 2) | (q[2] & 0x3);
+        ins->kind = SCAN_UNSUPPORTED;
+        return ((size_t)len <= avail) ? len : 0;
+    }
+
+    if (!vex_decode(p, &d))
+        return 0;
+    map = d.leading_opcode;
+    opcode = d.opcode;
+    imm = ((map == 3) || ((map == 1) && (((opcode >= 0x70) && (opcode <= 0x73)) || (opcode == 0xC2) ||
+                                         ((opcode >= 0xC4) && (opcode <= 0xC6))))) ? 1 : 0;
+    if ((map == 1) && (opcode == 0x77))
+        len = d.ins_size;       //vzeroupper/vzeroall
+    else
+        len = d.ins_size + get_consumed(&p[d.ins_size]) + imm;
+    if ((size_t)len > avail)
+        return 0;
+
+    ins->id = OPEMU_OPCODE_ID(1, map, opcode);
+    ins->ext = ((d.reg_size == 256) ? 1 << 2 : 0) | d.simd_prefix;
+    return len;
+}
+
+/** Would opemu emulate it? Runs vex_ins on scratch state, a fault counts as handled. **/
+static int scan_supported(uint8_t *p)
+{
+    static struct pt_regs regs;
+    volatile int bytes = 0;
+
+    memset(&regs, 0, sizeof(regs));
+    if (sigsetjmp(scan_fault, 1))
+        return 1;
+    bytes = vex_ins(p, &regs);
+    return bytes != 0;
+}
+
+static void scan_add(struct scan_ins *ins)
+{
+    if (scan_nins == scan_capins) {
+        scan_capins = scan_capins ? scan_capins * 2 : 65536;
+        scan_ins = realloc(scan_ins, scan_capins * sizeof(*scan_ins));
+        if (!scan_ins) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    scan_ins[scan_nins++] = *ins;
+}
+
+static void scan_section(uint8_t *code, size_t size, uint64_t addr)
+{
+    struct scan_ins ins;
+    uint8_t buf[32];
+    size_t off = 0;
+    int len, i;
+
+    while (off < size) {
+        memset(&ins, 0, sizeof(ins));
+        ins.addr = addr + off;
+
+        //padded copy: the decoders may look a few bytes ahead
+        memset(buf, 0, sizeof(buf));
+        memcpy(buf, &code[off], (size - off < 16) ? size - off : 16);
+
+        i = (buf[0] == 0x67) ? 1 : 0;
+        if ((buf[i] == 0xC4) || (buf[i] == 0xC5) || (buf[i] == 0x62)) {
+            len = scan_vex(buf, size - off, &ins);
+            if (len && (ins.kind != SCAN_UNSUPPORTED))
+                ins.kind = scan_supported(buf) ? SCAN_EMULATED : SCAN_UNSUPPORTED;
+        } else {
+            len = scan_legacy(buf, size - off, &ins);
+        }
+        if (!len) {
+            off++;
+            continue;
+        }
+        ins.len = len;
+        scan_add(&ins);
+        off += len;
+    }
+}
+
+//loop nesting of every instruction from the backward branches
+static void scan_loops(void)
+{
+    int32_t *delta = calloc(scan_nins + 1, sizeof(*delta));
+    struct scan_func *fn;
+    size_t i, lo, hi, mid;
+    int32_t depth = 0;
+
+    if (!delta)
+        return;
+    for (i = 0; i < scan_nins; i++) {
+        if (!scan_ins[i].target)
+            continue;
+        lo = 0;
+        hi = i;
+        while (lo < hi) {
+            mid = (lo + hi) / 2;
+            if (scan_ins[mid].addr < scan_ins[i].target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        //a loop stays inside its function, other backward jumps are tail calls
+        fn = scan_func_of(scan_ins[i].addr);
+        if ((lo < i) && (scan_ins[lo].addr == scan_ins[i].target) && (fn == scan_func_of(scan_ins[lo].addr)) &&
+            (fn || (scan_ins[i].addr - scan_ins[lo].addr < SCAN_LOOP_MAX))) {
+            delta[lo]++;
+            delta[i + 1]--;
+        } else {
+            scan_ins[i].target = 0;
+        }
+    }
+    for (i = 0; i < scan_nins; i++) {
+        depth += delta[i];
+        scan_ins[i].depth = depth;
+    }
+    free(delta);
+}
+
+static struct scan_func *scan_func_of(uint64_t addr)
+{
+    size_t lo = 0, hi = scan_nfuncs, mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (scan_funcs[mid].addr <= addr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo && (addr < scan_funcs[lo - 1].addr + scan_funcs[lo - 1].size))
+        return &scan_funcs[lo - 1];
+    return NULL;
+}
+
+static int scan_func_cmp(const void *a, const void *b)
+{
+    const struct scan_func *x = a;
+    const struct scan_func *y = b;
+
+    return (x->addr > y->addr) - (x->addr < y->addr);
+}
+
+static void scan_symbols(uint8_t *elf, Elf64_Ehdr *eh, Elf64_Shdr *sh)
+{
+    Elf64_Sym *sym;
+    const char *str;
+    size_t i, n;
+    int s, t;
+
+    //.symtab if there is one, .dynsym otherwise
+    for (t = SHT_SYMTAB; ; t = SHT_DYNSYM) {
+        for (s = 0; s < eh->e_shnum; s++) {
+            if ((sh[s].sh_type != t) || (sh[s].sh_link >= eh->e_shnum))
+                continue;
+            sym = (Elf64_Sym *)(elf + sh[s].sh_offset);
+            str = (const char *)(elf + sh[sh[s].sh_link].sh_offset);
+            n = sh[s].sh_size / sizeof(*sym);
+            scan_funcs = realloc(scan_funcs, (scan_nfuncs + n) * sizeof(*scan_funcs));
+            for (i = 0; i < n; i++) {
+                if ((ELF64_ST_TYPE(sym[i].st_info) != STT_FUNC) || !sym[i].st_size || !sym[i].st_value)
+                    continue;
+                memset(&scan_funcs[scan_nfuncs], 0, sizeof(*scan_funcs));
+                scan_funcs[scan_nfuncs].addr = sym[i].st_value;
+                scan_funcs[scan_nfuncs].size = sym[i].st_size;
+                scan_funcs[scan_nfuncs].name = str + sym[i].st_name;
+                scan_nfuncs++;
+            }
+        }
+        if (scan_nfuncs || (t == SHT_DYNSYM))
+            break;
+    }
+    qsort(scan_funcs, scan_nfuncs, sizeof(*scan_funcs), scan_func_cmp);
+}
+
+//lines of "<opcode id hex> <ns per trap>", ids as in the stats page
+static void scan_read_costs(const char *path)
+{
+    unsigned int id;
+    double ns;
+    FILE *f;
+
+    f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    while (fscanf(f, "%x %lf", &id, &ns) == 2) {
+        if (id < (sizeof(scan_costs) / sizeof(scan_costs[0])))
+            scan_costs[id] = ns;
+    }
+    fclose(f);
+}
+
+static double scan_cost(uint32_t id)
+{
+    return scan_costs[id] ? scan_costs[id] : scan_trap_ns;
+}
+
+static const char *scan_map_name(uint32_t id)
+{
+    static const char *maps[4] = { "", "0F", "0F38", "0F3A" };
+
+    return maps[(id >> 8) & 3];
+}
+
+static void scan_report(const char *path)
+{
+    static const char *pps[4] = { "NP", "66", "F3", "F2" };
+    static const char *lens[4] = { "128", "256", "512", "LIG" };
+    struct scan_func other = { 0, 0, "<no symbol>" };
+    uint64_t total = 0, emulated = 0, unsupported = 0;
+    double native = 0, traps = 0, weight;
+    struct scan_func *fn;
+    size_t i, j, k;
+
+    for (i = 0; i < scan_nins; i++) {
+        struct scan_ins *ins = &scan_ins[i];
+
+        fn = scan_func_of(ins->addr);
+        if (!fn)
+            fn = &other;
+        //ten iterations per loop level, three levels at most
+        weight = (ins->depth == 0) ? 1 : (ins->depth == 1) ? 10 : (ins->depth == 2) ? 100 : 1000;
+
+        fn->insns++;
+        fn->native += weight * scan_native_ns;
+        total++;
+        native += weight * scan_native_ns;
+        if (ins->kind == SCAN_EMULATED) {
+            fn->emulated++;
+            fn->traps += weight * scan_cost(ins->id);
+            emulated++;
+            traps += weight * scan_cost(ins->id);
+        } else if (ins->kind == SCAN_UNSUPPORTED) {
+            fn->unsupported++;
+            unsupported++;
+            for (k = 0; k < (size_t)scan_nunsups; k++) {
+                if ((scan_unsups[k].id == ins->id) && (scan_unsups[k].ext == ins->ext))
+                    break;
+            }
+            if ((k == (size_t)scan_nunsups) && (scan_nunsups < 256)) {
+                scan_unsups[k].id = ins->id;
+                scan_unsups[k].ext = ins->ext;
+                scan_unsups[k].first = ins->addr;
+                scan_nunsups++;
+            }
+            if (k < (size_t)scan_nunsups)
+                scan_unsups[k].count++;
+        }
+    }
+
+    printf("%s: %llu instructions, %llu emulated, %llu unsupported, estimated slowdown %.1fx\n", path,
+           (unsigned long long)total, (unsigned long long)emulated, (unsigned long long)unsupported,
+           native ? (native + traps) / native : 1.0);
+
+    printf("\n%-40s %8s %8s %8s %9s\n", "function", "insns", "emulated", "unsupp", "slowdown");
+    for (i = 0; i <= scan_nfuncs; i++) {
+        fn = (i < scan_nfuncs) ? &scan_funcs[i] : &other;
+        if (!fn->insns || (!scan_all && !fn->emulated && !fn->unsupported))
+            continue;
+        printf("%-40.40s %8llu %8llu %8llu %8.1fx\n", fn->name, (unsigned long long)fn->insns,
+               (unsigned long long)fn->emulated, (unsigned long long)fn->unsupported,
+               fn->native ? (fn->native + fn->traps) / fn->native : 1.0);
+    }
+
+    printf("\n%-20s %-30s %6s %8s %9s\n", "loop", "function", "insns", "emulated", "ns/iter");
+    for (i = 0; i < scan_nins; i++) {
+        uint64_t n = 0, e = 0;
+        double ns = 0;
+
+        if (!scan_ins[i].target)
+            continue;
+        for (j = i; (j > 0) && (scan_ins[j].addr > scan_ins[i].target); j--)
+            ;
+        for (k = j; k <= i; k++) {
+            n++;
+            ns += scan_native_ns;
+            if (scan_ins[k].kind == SCAN_EMULATED) {
+                e++;
+                ns += scan_cost(scan_ins[k].id);
+            }
+        }
+        if (!e && !scan_all)
+            continue;
+        fn = scan_func_of(scan_ins[i].addr);
+        printf("%8llx-%-11llx %-30.30s %6llu %8llu %9.0f\n", (unsigned long long)scan_ins[i].target,
+               (unsigned long long)(scan_ins[i].addr + scan_ins[i].len), fn ? fn->name : other.name,
+               (unsigned long long)n, (unsigned long long)e, ns);
+    }
+
+    if (scan_nunsups) {
+        printf("\n%-28s %8s %12s\n", "unsupported encoding", "count", "first");
+        for (k = 0; k < (size_t)scan_nunsups; k++) {
+            char enc[32];
+
+            snprintf(enc, sizeof(enc), "%s.%s.%s.%s %02X", (scan_unsups[k].ext & 0x100) ? "EVEX" : "VEX",
+                     lens[(scan_unsups[k].ext >> 2) & 3], pps[scan_unsups[k].ext & 3],
+                     scan_map_name(scan_unsups[k].id), scan_unsups[k].id & 0xFF);
+            printf("%-28s %8llu %12llx\n", enc, (unsigned long long)scan_unsups[k].count,
+                   (unsigned long long)scan_unsups[k].first);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Elf64_Ehdr *eh;
+    Elf64_Shdr *sh;
+    struct stat st;
+    uint8_t *elf;
+    int fd, opt, s;
+
+    while ((opt = getopt(argc, argv, "c:t:n:a")) != -1) {
+        switch (opt) {
+            case 'c': scan_read_costs(optarg); break;
+            case 't': scan_trap_ns = atof(optarg); break;
+            case 'n': scan_native_ns = atof(optarg); break;
+            case 'a': scan_all = 1; break;
+            default:
+                fprintf(stderr, "usage: %s [-c costs] [-t trap_ns] [-n native_ns] [-a] elf\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "usage: %s [-c costs] [-t trap_ns] [-n native_ns] [-a] elf\n", argv[0]);
+        return 2;
+    }
+
+    fd = open(argv[optind], O_RDONLY);
+    if ((fd < 0) || fstat(fd, &st)) {
+        perror(argv[optind]);
+        return 1;
+    }
+    elf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    eh = (Elf64_Ehdr *)elf;
+    if ((elf == MAP_FAILED) || (st.st_size < (off_t)sizeof(*eh)) || memcmp(eh->e_ident, ELFMAG, SELFMAG) ||
+        (eh->e_ident[EI_CLASS] != ELFCLASS64) || (eh->e_machine != EM_X86_64) ||
+        (eh->e_shoff + (uint64_t)eh->e_shnum * sizeof(*sh) > (uint64_t)st.st_size)) {
+        fprintf(stderr, "%s: not an x86-64 ELF64 file\n", argv[optind]);
+        return 1;
+    }
+    sh = (Elf64_Shdr *)(elf + eh->e_shoff);
+
+    //memory operands of the probed instructions point at low addresses, keep them unmapped
+    mmap((void *)0x10000, 0x80000000UL - 0x10000, PROT_NONE,
+         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+    signal(SIGSEGV, scan_segv);
+    signal(SIGBUS, scan_segv);
+    signal(SIGFPE, scan_segv);
+
+    scan_symbols(elf, eh, sh);
+    for (s = 0; s < eh->e_shnum; s++) {
+        if ((sh[s].sh_type != SHT_PROGBITS) || !(sh[s].sh_flags & SHF_EXECINSTR))
+            continue;
+        if (sh[s].sh_offset + sh[s].sh_size > (uint64_t)st.st_size)
+            continue;
+        scan_section(elf + sh[s].sh_offset, sh[s].sh_size, sh[s].sh_addr);
+    }
+    scan_loops();
+    scan_report(argv[optind]);
+
+    return 0;
+}
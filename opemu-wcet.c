@@ -0,0 +1,449 @@
+//
+//  opemu-wcet.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Worst-case cycles of every emulated opcode. Each VEX encoding (map,
+//  pp, L, W) and each legacy 0F38/0F3A encoding the handlers accept is
+//  run in register, memory and VSIB form on adversarial operands:
+//  zeros, all ones, FP specials and denormals, saturation edges,
+//  random lanes, maximal pcmpXstrX lengths, full gather masks with
+//  indices a page apart. Reports per encoding the worst operand image
+//  (the least of its runs, so interrupts do not count) and the raw max.
+//
+//    -k    run through OPEMU_IOC_EXEC, the kernel handlers (root)
+//    -c N  exit 1 if any encoding's worst case exceeds N cycles
+//    -n N  runs per operand image (default 20)
+//    -t N  rows to print (default 40, 0 = all)
+//    -o F  write per-opcode costs for opemu-scan -c to F: one
+//          "<opcode id hex> <ns>" line per stats page id, the mean worst
+//          case of its encodings at the measured TSC rate plus -T
+//    -T N  ns of trap entry and exit added to each cost (default 1000,
+//          as opemu-scan -t; opemu-bench's kernel row less its exec row)
+//
+//  usage: opemu-wcet [-k] [-c cycles] [-n runs] [-t rows] [-o costs [-T trap_ns]]
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+#include <x86intrin.h>
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+
+//memory operands: [rsi], VSIB [rsi + ymm1 * 8]
+#define WCET_MEM     (1 << 20)
+#define WCET_IMAGES  7
+#define WCET_MAX_ENC 32768
+
+#define WCET_REG  0
+#define WCET_MEMF 1
+#define WCET_VSIB 2
+
+struct wcet_enc {
+    uint8_t bytes[16];
+    uint8_t len;
+    uint8_t vex;
+    uint8_t form;
+    uint64_t worst;         //max over images of the min over runs
+    uint64_t max;           //raw
+    int image;              //the worst image
+};
+
+static const char *wcet_images[WCET_IMAGES] = {
+    "zero", "ones", "fp32", "fp64", "sat", "random", "gather",
+};
+static const char *wcet_forms[3] = { "reg", "mem", "vsib" };
+
+static struct wcet_enc *wcet_encs;
+static int wcet_nencs;
+static uint8_t *wcet_buf;
+static int wcet_fd = -1;
+static sigjmp_buf wcet_fault;
+
+static void wcet_segv(int sig)
+{
+    siglongjmp(wcet_fault, 1);
+}
+
+static uint64_t wcet_rand(void)
+{
+    static uint64_t x = 0x9E3779B97F4A7C15ULL;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return x;
+}
+
+/** Register image number i: 16 YMM registers and the GPRs. **/
+static void wcet_image(int i, struct opemu_exec_state *st)
+{
+    static const uint32_t fp32[8] = {
+        0x00000000, 0x80000000, 0x7F800000, 0xFF800000, 0x7FC00000, 0x7F800001, 0x00000001, 0x7F7FFFFF,
+    };
+    static const uint64_t fp64[4] = {
+        0x7FF0000000000001ULL, 0x0000000000000001ULL, 0xFFF0000000000000ULL, 0x7FEFFFFFFFFFFFFFULL,
+    };
+    static const uint64_t lens[WCET_IMAGES] = {
+        0, ~0ULL, 16, 8, 0x8000000000000000ULL, 0, 16,
+    };
+    uint64_t base = (uint64_t)wcet_buf + WCET_MEM / 2;
+    int n, k;
+
+    memset(st, 0, sizeof(*st));
+    for (n = 0; n < 16; n++) {
+        for (k = 0; k < 32; k++) {
+            switch (i) {
+                case 1: st->ymm[n][k] = 0xFF; break;
+                case 2: st->ymm[n][k] = ((uint8_t *)fp32)[(k + n * 4) & 31]; break;
+                case 3: st->ymm[n][k] = ((uint8_t *)fp64)[k]; break;
+                case 4: st->ymm[n][k] = (k & 1) ? 0x7F : 0x80; break;
+                case 5:
+                case 6: st->ymm[n][k] = (uint8_t)wcet_rand(); break;
+            }
+        }
+    }
+    if (i == 6) {
+        //indices a page apart on both sides of rsi, every mask lane set
+        for (k = 0; k < 8; k++)
+            ((int32_t *)st->ymm[1])[k] = (k - 4) * 512;
+        memset(st->ymm[2], 0xFF, 32);
+    }
+
+    st->regs.ax = lens[i];
+    st->regs.cx = (i == 5) ? wcet_rand() : lens[i];
+    st->regs.dx = lens[i];
+    st->regs.si = base;
+    st->regs.di = base;
+    st->regs.bx = base;
+    st->regs.bp = base;
+    st->regs.sp = base;
+    st->regs.cs = 0x33;
+    st->regs.ss = 0x2b;
+    st->mxcsr = 0x1F80;
+}
+
+static void wcet_regs_in(struct pt_regs *regs, const struct opemu_trace_regs *t)
+{
+    memset(regs, 0, sizeof(*regs));
+    regs->ax = t->ax;
+    regs->cx = t->cx;
+    regs->dx = t->dx;
+    regs->bx = t->bx;
+    regs->sp = t->sp;
+    regs->bp = t->bp;
+    regs->si = t->si;
+    regs->di = t->di;
+    regs->ip = (uint64_t)wcet_buf;
+    regs->cs = t->cs;
+    regs->ss = t->ss;
+}
+
+/** Emulate once. returns the cycles, 0 if it was not emulated or faulted. **/
+static uint64_t wcet_run(struct wcet_enc *e, const struct opemu_exec_state *st)
+{
+    struct opemu_exec_req req;
+    struct opemu_exec_state tmp;
+    struct pt_regs regs;
+    uint64_t start, end, cycles;
+    int n, bytes;
+
+    if (wcet_fd >= 0) {
+        tmp = *st;
+        memset(&req, 0, sizeof(req));
+        req.code = (uint64_t)e->bytes;
+        req.code_len = e->len;
+        req.count = 1;
+        req.state = (uint64_t)&tmp;
+        req.mem = (uint64_t)wcet_buf;
+        req.mem_base = (uint64_t)wcet_buf;
+        req.mem_len = WCET_MEM;
+        req.cycles = (uint64_t)&cycles;
+        if ((ioctl(wcet_fd, OPEMU_IOC_EXEC, &req) < 0) || (req.count != 1))
+            return 0;
+        return cycles ? cycles : 1;
+    }
+
+    wcet_regs_in(&regs, &st->regs);
+    if (sigsetjmp(wcet_fault, 1))
+        return 0;
+
+    //nothing but the register loads between here and the emulator
+    for (n = 0; n < 16; n++) {
+        _copy_u128(&_vymm(n)->u128[1], &st->ymm[n][16]);
+        _load_xmm(n, (XMM*)&st->ymm[n][0]);
+    }
+    start = __rdtsc();
+    bytes = e->vex ? vex_ins(e->bytes, &regs) : rex_ins(e->bytes, &regs);
+    end = __rdtsc();
+
+    if (bytes != e->len)
+        return 0;
+    return (end - start) ? (end - start) : 1;
+}
+
+static void wcet_add(const uint8_t *bytes, int len, int vex, int form)
+{
+    struct opemu_exec_state st;
+    struct wcet_enc *e;
+
+    if (wcet_nencs == WCET_MAX_ENC)
+        return;
+    e = &wcet_encs[wcet_nencs];
+    memset(e, 0, sizeof(*e));
+    memcpy(e->bytes, bytes, len);
+    e->len = len;
+    e->vex = vex;
+    e->form = form;
+
+    //keep what the handlers take as exactly this instruction
+    wcet_image(0, &st);
+    if (wcet_run(e, &st))
+        wcet_nencs++;
+}
+
+//ModRM (+ SIB) of each form, ModRM.reg = 0, r/m = 1 or [rsi]
+static int wcet_modrm(uint8_t *p, int form)
+{
+    if (form == WCET_REG) {
+        p[0] = 0xC1;
+        return 1;
+    }
+    if (form == WCET_MEMF) {
+        p[0] = 0x06;
+        return 1;
+    }
+    p[0] = 0x04;
+    p[1] = 0xCE;
+    return 2;
+}
+
+static void wcet_enumerate(void)
+{
+    static const uint8_t imms[4] = { 0x00, 0x0C, 0x7F, 0xFF };
+    static const uint8_t legacy_pp[4] = { 0x00, 0x66, 0xF3, 0xF2 };
+    uint8_t b[16];
+    int map, op, pp, L, W, form, i, n, m, imm;
+
+    for (map = 1; map <= 3; map++)
+    for (op = 0; op < 256; op++)
+    for (pp = 0; pp < 4; pp++)
+    for (L = 0; L < 2; L++)
+    for (W = 0; W < 2; W++)
+    for (form = WCET_REG; form <= WCET_VSIB; form++) {
+        //VSIB only for the gathers
+        if ((form == WCET_VSIB) != ((map == 2) && (op >= 0x90) && (op <= 0x93)))
+            continue;
+        imm = (map == 3) || ((map == 1) && (((op >= 0x70) && (op <= 0x73)) || (op == 0xC2) ||
+                                            ((op >= 0xC4) && (op <= 0xC6))));
+        for (i = 0; i < (imm ? 4 : 1); i++) {
+            //vvvv = 2, ModRM.reg = 0, r/m = 1
+            b[0] = 0xC4;
+            b[1] = 0xE0 | map;
+            b[2] = (W << 7) | (0xD << 3) | (L << 2) | pp;
+            b[3] = op;
+            n = 4 + wcet_modrm(&b[4], form);
+            if (imm)
+                b[n++] = imms[i];
+            wcet_add(b, n, 1, form);
+        }
+    }
+
+    for (pp = 0; pp < 4; pp++)
+    for (map = 2; map <= 3; map++)
+    for (op = 0; op < 256; op++)
+    for (form = WCET_REG; form <= WCET_MEMF; form++) {
+        for (i = 0; i < ((map == 3) ? 4 : 1); i++) {
+            m = 0;
+            if (legacy_pp[pp])
+                b[m++] = legacy_pp[pp];
+            b[m++] = 0x0F;
+            b[m++] = (map == 2) ? 0x38 : 0x3A;
+            b[m++] = op;
+            m += wcet_modrm(&b[m], form);
+            if (map == 3)
+                b[m++] = imms[i];
+            wcet_add(b, m, 0, form);
+        }
+    }
+}
+
+static int wcet_cmp(const void *a, const void *b)
+{
+    const struct wcet_enc *x = a;
+    const struct wcet_enc *y = b;
+
+    return (x->worst < y->worst) - (x->worst > y->worst);
+}
+
+static void wcet_name(const struct wcet_enc *e, char *buf, size_t size)
+{
+    static const char *pps[4] = { "NP", "66", "F3", "F2" };
+    static const char *maps[4] = { "", "0F", "0F38", "0F3A" };
+    int n, off;
+
+    if (e->vex) {
+        off = snprintf(buf, size, "VEX.%s.%s.%s.W%d %02X", (e->bytes[2] & 4) ? "256" : "128",
+                       pps[e->bytes[2] & 3], maps[e->bytes[1] & 3], e->bytes[2] >> 7, e->bytes[3]);
+    } else {
+        n = (e->bytes[0] == 0x0F) ? 0 : 1;
+        off = snprintf(buf, size, "%s.%s %02X", n ? ((e->bytes[0] == 0x66) ? "66" : (e->bytes[0] == 0xF3) ? "F3" : "F2") : "NP",
+                       (e->bytes[n + 1] == 0x38) ? "0F38" : "0F3A", e->bytes[n + 2]);
+    }
+    if (((e->vex && ((e->bytes[1] & 3) == 3)) || (!e->vex && (e->bytes[e->len - 3] == 0x3A || e->bytes[e->len - 4] == 0x3A))))
+        snprintf(buf + off, size - off, " ib=%02X", e->bytes[e->len - 1]);
+}
+
+static uint32_t wcet_id(const struct wcet_enc *e)
+{
+    int n;
+
+    if (e->vex)
+        return OPEMU_OPCODE_ID(1, e->bytes[1] & 3, e->bytes[3]);
+    n = (e->bytes[0] == 0x0F) ? 0 : 1;
+    return OPEMU_OPCODE_ID(0, (e->bytes[n + 1] == 0x38) ? 2 : 3, e->bytes[n + 2]);
+}
+
+//TSC ticks per ns
+static double wcet_tsc_rate(void)
+{
+    struct timespec t0, t1;
+    uint64_t c0, c1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    c0 = __rdtsc();
+    usleep(100000);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    c1 = __rdtsc();
+
+    return (double)(c1 - c0) / ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec));
+}
+
+/** opemu-scan -c input. returns 0 or -1. **/
+static int wcet_costs(const char *path, double trap_ns)
+{
+    static double sum[1 << 13];
+    static int count[1 << 13];
+    double rate = wcet_tsc_rate();
+    uint32_t id;
+    FILE *f;
+    int i;
+
+    for (i = 0; i < wcet_nencs; i++) {
+        id = wcet_id(&wcet_encs[i]);
+        sum[id] += wcet_encs[i].worst;
+        count[id]++;
+    }
+
+    f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    for (id = 0; id < (1 << 13); id++) {
+        if (count[id])
+            fprintf(f, "%x %.1f\n", id, trap_ns + sum[id] / count[id] / rate);
+    }
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    struct opemu_exec_state st;
+    uint64_t ceiling = 0, best, c;
+    int runs = 20, rows = 40, over = 0;
+    int opt, i, img, r;
+    const char *costs = NULL;
+    double trap_ns = 1000.0;
+    char name[64];
+
+    while ((opt = getopt(argc, argv, "kc:n:t:o:T:")) != -1) {
+        switch (opt) {
+            case 'k':
+                wcet_fd = open(OPEMU_DEVICE, O_RDWR | O_CLOEXEC);
+                if (wcet_fd < 0) {
+                    perror(OPEMU_DEVICE);
+                    return 1;
+                }
+                break;
+            case 'c': ceiling = strtoull(optarg, NULL, 0); break;
+            case 'n': runs = atoi(optarg); break;
+            case 't': rows = atoi(optarg); break;
+            case 'o': costs = optarg; break;
+            case 'T': trap_ns = atof(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-k] [-c cycles] [-n runs] [-t rows] [-o costs [-T trap_ns]]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (runs < 1)
+        runs = 1;
+
+    wcet_buf = aligned_alloc(4096, WCET_MEM);
+    wcet_encs = calloc(WCET_MAX_ENC, sizeof(*wcet_encs));
+    if (!wcet_buf || !wcet_encs)
+        return 1;
+    memset(wcet_buf, 0x5A, WCET_MEM);
+    signal(SIGSEGV, wcet_segv);
+    signal(SIGBUS, wcet_segv);
+    signal(SIGFPE, wcet_segv);
+
+    wcet_enumerate();
+
+    for (i = 0; i < wcet_nencs; i++) {
+        struct wcet_enc *e = &wcet_encs[i];
+
+        for (img = 0; img < WCET_IMAGES; img++) {
+            wcet_image(img, &st);
+            best = ~0ULL;
+            for (r = 0; r < runs; r++) {
+                c = wcet_run(e, &st);
+                if (!c)
+                    break;
+                if (c < best)
+                    best = c;
+                if (c > e->max)
+                    e->max = c;
+            }
+            if ((best != ~0ULL) && (best > e->worst)) {
+                e->worst = best;
+                e->image = img;
+            }
+        }
+        if (ceiling && (e->worst > ceiling))
+            over++;
+    }
+
+    qsort(wcet_encs, wcet_nencs, sizeof(*wcet_encs), wcet_cmp);
+    if (costs && wcet_costs(costs, trap_ns))
+        return 1;
+
+    printf("%d encodings, %s handlers, %d runs per image\n\n", wcet_nencs, (wcet_fd >= 0) ? "kernel" : "userspace", runs);
+    printf("%-32s %-5s %-7s %10s %10s\n", "encoding", "form", "image", "worst", "max");
+    for (i = 0; i < wcet_nencs; i++) {
+        if (rows && (i >= rows) && !(ceiling && (wcet_encs[i].worst > ceiling)))
+            continue;
+        wcet_name(&wcet_encs[i], name, sizeof(name));
+        printf("%-32s %-5s %-7s %10llu %10llu%s\n", name, wcet_forms[wcet_encs[i].form],
+               wcet_images[wcet_encs[i].image], (unsigned long long)wcet_encs[i].worst,
+               (unsigned long long)wcet_encs[i].max, (ceiling && (wcet_encs[i].worst > ceiling)) ? "  over" : "");
+    }
+
+    if (over) {
+        printf("\n%d encodings over %llu cycles\n", over, (unsigned long long)ceiling);
+        return 1;
+    }
+    return 0;
+}
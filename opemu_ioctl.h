@@ -0,0 +1,216 @@
+//
+//  opemu_ioctl.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  /dev/opemu interface, shared by the module and userspace tools.
+
+#ifndef opemu_ioctl_h
+#define opemu_ioctl_h
+
+#ifdef __KERNEL__
+#include <linux/ioctl.h>
+#include <linux/types.h>
+#else
+#include <stdint.h>
+#include <sys/ioctl.h>
+#endif
+
+#define OPEMU_DEVICE    "/dev/opemu"
+#define OPEMU_IOC_MAGIC 'O'
+
+/*** Emulation mode of the calling process ***/
+#define OPEMU_MODE_KERNEL 0     //emulate in the #UD handler (default)
+#define OPEMU_MODE_SIGNAL 1     //deliver SIGILL, a userspace handler emulates
+#define OPEMU_MODE_UPCALL 2     //redirect RIP to the process' emulation stub
+
+/*
+ * Upcall ABI: the kernel skips the 128-byte red zone, stores the
+ * faulting RIP at the new RSP and jumps to entry. All other registers
+ * are untouched and no signal frame is built. The stub emulates,
+ * restores every register and returns with "ret $128".
+ */
+#define OPEMU_UPCALL_RED_ZONE 128
+
+struct opemu_mode_req {
+    uint64_t mode;
+    uint64_t entry;         //stub entry point (upcall mode)
+    uint64_t text_start;    //stub text, a #UD in here is never upcalled
+    uint64_t text_end;
+};
+
+#define OPEMU_IOC_SET_MODE _IOW(OPEMU_IOC_MAGIC, 1, struct opemu_mode_req)
+
+/*** Emulation pressure of the calling process ***/
+struct opemu_pressure_req {
+    int32_t eventfd;        //signalled on every threshold crossing, -1 for none
+    uint32_t window_ms;     //rate window, 0 = 100ms
+    uint64_t max_ips;       //emulated instructions per second, 0 = ignore
+    uint32_t max_permille;  //time in emulation per 1000 of wall time, 0 = ignore
+    uint32_t reserved;
+};
+
+struct opemu_pressure_stat {
+    uint64_t ips;           //last window
+    uint32_t permille;      //last window
+    uint32_t pressure;      //1 while a threshold is exceeded
+    uint64_t events;        //threshold crossings so far
+    uint64_t total;         //emulated instructions so far
+};
+
+#define OPEMU_IOC_SET_PRESSURE _IOW(OPEMU_IOC_MAGIC, 2, struct opemu_pressure_req)
+#define OPEMU_IOC_GET_PRESSURE _IOR(OPEMU_IOC_MAGIC, 3, struct opemu_pressure_stat)
+
+/*
+ * Hot-site profiles of a mapped file (fd), from the shared decode cache.
+ * Both need CAP_SYS_ADMIN. GET returns the hottest sites; LOAD preloads them so
+ * the first traps at those offsets skip decoding. The kernel decodes
+ * the bytes again on load and checks them against the code on use.
+ * opemu-profd keeps them on disk as <dir>/<ELF build-id>.prof.
+ */
+#define OPEMU_PROFILE_MAX   4096
+#define OPEMU_PROFILE_MAGIC 0x4f505046  //'OPPF'
+
+struct opemu_profile_site {
+    uint64_t offset;        //file offset of the instruction
+    uint32_t hits;          //decode cache hits so far
+    uint8_t len;            //instruction length
+    uint8_t set;            //ISA set that emulates it
+    uint8_t reserved[2];
+    uint8_t bytes[16];
+};
+
+struct opemu_profile_req {
+    int32_t fd;             //the mapped file
+    uint32_t count;         //in: sites at sites, out: sites returned or loaded
+    uint64_t sites;         //struct opemu_profile_site *
+};
+
+#define OPEMU_IOC_GET_PROFILE  _IOWR(OPEMU_IOC_MAGIC, 4, struct opemu_profile_req)
+#define OPEMU_IOC_LOAD_PROFILE _IOWR(OPEMU_IOC_MAGIC, 5, struct opemu_profile_req)
+
+/*
+ * Stats page: mmap(NULL, 4096, PROT_READ, MAP_SHARED, fd, 0) on /dev/opemu
+ * maps the process' counters read-only. Each thread slot and the header
+ * are written under their own sequence count (odd while updating).
+ */
+#define OPEMU_STATS_MAGIC   0x4f504d53  //'OPMS'
+#define OPEMU_STATS_TOP     4
+#define OPEMU_STATS_THREADS 63
+
+//opcode id: bit 12 VEX, bits 8-11 map (0=1-byte 1=0F 2=0F38 3=0F3A), bits 0-7 opcode
+#define OPEMU_OPCODE_ID(vex, map, opcode) (((vex) << 12) | ((map) << 8) | (opcode))
+
+struct opemu_stats_top {
+    uint32_t id;
+    uint32_t count;
+};
+
+struct opemu_stats_thread {
+    uint32_t seq;
+    uint32_t tid;
+    uint64_t traps;
+    uint64_t instructions;
+    uint64_t cycles;        //TSC cycles spent in the trap handler
+    struct opemu_stats_top top[OPEMU_STATS_TOP];
+};
+
+struct opemu_stats_page {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t nthreads;      //slots in use
+    uint32_t reserved;
+    uint64_t traps;         //whole process
+    uint64_t instructions;
+    uint64_t cycles;
+    uint64_t pad[3];
+    struct opemu_stats_thread threads[OPEMU_STATS_THREADS];
+};
+
+/*
+ * Trace records, read() from /sys/kernel/debug/opemu/trace in whole
+ * records while /sys/kernel/debug/opemu/trace_enable is 1. Each is one
+ * emulated instruction with the register file and the memory operand
+ * window before and after; opemu-replay runs them through the
+ * userspace build and checks the result.
+ */
+#define OPEMU_TRACE_MAGIC 0x4f505452  //'OPTR'
+#define OPEMU_TRACE_MEM   64
+
+//struct pt_regs order
+struct opemu_trace_regs {
+    uint64_t r15, r14, r13, r12, bp, bx, r11, r10, r9, r8;
+    uint64_t ax, cx, dx, si, di, orig_ax, ip, cs, flags, sp, ss;
+};
+
+struct opemu_trace_state {
+    struct opemu_trace_regs regs;
+    uint8_t ymm[16][32];
+    uint8_t mem[OPEMU_TRACE_MEM];   //mem_len bytes at mem_addr
+};
+
+struct opemu_trace_rec {
+    uint32_t magic;
+    uint32_t size;          //sizeof(struct opemu_trace_rec)
+    uint64_t mem_addr;
+    uint32_t mem_len;       //0: no memory operand seen
+    uint32_t cpu;
+    uint8_t ins[16];        //bytes at pre.regs.ip
+    struct opemu_trace_state pre;
+    struct opemu_trace_state post;
+};
+
+/*
+ * Batch execution (CAP_SYS_ADMIN): run code_len bytes of 64-bit
+ * instructions back to back through the in-kernel handlers, without
+ * traps, on the register image at state and a kernel copy of mem_len
+ * bytes at mem that the instructions address as mem_base. A memory operand outside
+ * the window stops the batch with EFAULT and its address in fault, an
+ * instruction opemu does not emulate stops it with EILSEQ. state, mem,
+ * count and cycles are written back in either case. Loop and fused
+ * sequence emulation are not applied: one instruction per step.
+ */
+#define OPEMU_EXEC_CODE 4096
+#define OPEMU_EXEC_MEM  (1 << 20)
+
+struct opemu_exec_state {
+    struct opemu_trace_regs regs;   //cs and ss are ignored
+    uint8_t ymm[16][32];
+    uint32_t mxcsr;
+    uint32_t reserved;
+};
+
+struct opemu_exec_req {
+    uint64_t code;          //instruction bytes
+    uint32_t code_len;
+    uint32_t count;         //in: most instructions to run (0 = all), out: instructions run
+    uint64_t state;         //struct opemu_exec_state *, in and out
+    uint64_t mem;           //memory window, in and out
+    uint64_t mem_base;      //its address as the instructions see it
+    uint32_t mem_len;
+    uint32_t reserved;
+    uint64_t cycles;        //uint64_t[count]: TSC cycles per instruction, 0 = none
+    uint64_t fault;         //out: first address outside the window
+};
+
+#define OPEMU_IOC_EXEC _IOWR(OPEMU_IOC_MAGIC, 6, struct opemu_exec_req)
+
+#ifndef __KERNEL__
+/** Consistent copy of one thread slot, no syscall. **/
+static inline void opemu_stats_read(const volatile struct opemu_stats_thread *slot, struct opemu_stats_thread *out)
+{
+    uint32_t seq;
+
+    do {
+        seq = slot->seq;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        *out = *(const struct opemu_stats_thread *)slot;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((seq & 1) || (seq != slot->seq));
+}
+#endif
+
+#endif /* opemu_ioctl_h */
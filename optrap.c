@@ -7,7 +7,13 @@
 //  Made in Taiwan.
 
 #include "optrap.h"
+#include "trace.h"
+#include "exec.h"
+#include "pin.h"
 
+#include "decode.h"
+#include "fuse.h"
+#include "loop.h"
 #include "aes.h"
 #include "avx.h"
 #include "vgather.h"
@@ -21,7 +27,34 @@
 #include "vsse41.h"
 #include "vsse42.h"
 
-int opemu_utrap(struct pt_regs *regs) {
+/**************************
+ * Virtual YMM Register
+ *************************/
+YMM VYMM0;
+YMM VYMM1;
+YMM VYMM2;
+YMM VYMM3;
+YMM VYMM4;
+YMM VYMM5;
+YMM VYMM6;
+YMM VYMM7;
+YMM VYMM8;
+YMM VYMM9;
+YMM VYMM10;
+YMM VYMM11;
+YMM VYMM12;
+YMM VYMM13;
+YMM VYMM14;
+YMM VYMM15;
+
+int opemu_vex_active;
+
+#ifndef __KERNEL__
+__thread XMM *opemu_xfile;
+#endif
+
+/** returns the number of instructions emulated, 0 if none. deadline is from opemu_budget_begin, 0 for none. **/
+int opemu_utrap(struct pt_regs *regs, uint64_t deadline) {
 
     int bytes_skip = 0;
 
@@ -31,8 +64,23 @@ int opemu_utrap(struct pt_regs *regs) {
         addr = regs->ip;
         uint8_t *code_buffer = (uint8_t *)addr;
 
+        opemu_phase_stamp(PHASE_ENTRY);
+
+        //Enable Loop Emulation (updates RIP itself)
+        opemu_phase_class(PHASE_CLASS_LOOP);
+        int count = opemu_loop(code_buffer, regs, deadline);
+        if (count)
+            return count;
+
+        //Enable Fused Sequence Emulation
+        opemu_phase_class(PHASE_CLASS_FUSE);
+        bytes_skip = opemu_fuse(code_buffer, regs, deadline);
+
         //Enable REX Opcode Emulation
-        bytes_skip = rex_ins(code_buffer, regs);
+        if (bytes_skip == 0) {
+            opemu_phase_class(PHASE_CLASS_REX);
+            bytes_skip = rex_ins(code_buffer, regs);
+        }
         
         //Enable VEX Opcode Emulation
         if (bytes_skip == 0) {
@@ -54,7 +102,10 @@ int opemu_utrap(struct pt_regs *regs) {
         addr = regs->ip;
         uint8_t *code_buffer = (uint8_t *)addr;
 
+        opemu_phase_stamp(PHASE_ENTRY);
+
         //Enable REX Opcode Emulation
+        opemu_phase_class(PHASE_CLASS_REX);
         bytes_skip = rex_ins(code_buffer, regs);
         
         //Enable VEX Opcode Emulation
@@ -187,8 +238,8 @@ int rex_ins(uint8_t *instruction, struct pt_regs *regs)
 }
 
 
-/** Runs the VEX emulator. returns the number of bytes consumed. **/
-int vex_ins(uint8_t *instruction, struct pt_regs *regs)
+/** Decodes the prefixes and opcode of a VEX instruction. returns 0 if it is not one. **/
+int vex_decode(uint8_t *instruction, struct vex_decode *d)
 {
     uint8_t *bytep = instruction;
     uint8_t ins_size = 0;
@@ -215,7 +266,7 @@ int vex_ins(uint8_t *instruction, struct pt_regs *regs)
     uint8_t VEX_V = 0; //VEX.vvvv
     uint8_t VEX_L = 0; //VEX.L
     uint8_t VEX_P = 0; //VEX.pp
-    
+
     // Legacy Prefixes
     if (*bytep == 0x67) {
         addrs32 = 1;
@@ -313,74 +364,180 @@ int vex_ins(uint8_t *instruction, struct pt_regs *regs)
 
     /* opcode */
     uint8_t opcode = bytep[0];
-    uint8_t *modrm = &bytep[1];
     //uint8_t imm;
 
     bytep++;
     ins_size++;
     modbyte++;
 
-    //uint8_t modreg = (*modrm >> 3) & 0x7;
-
-    // VAES Instruction set
-    ins_size = vaes_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
-
-    // AVX / AVX2 Instruction set
-    if (ins_size == 0) {
-        ins_size = avx_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
+    //scalar ss/sd ignore VEX.L
+    if ((leading_opcode == 1) && (reg_size == 256)) {
+        switch (opcode) {
+            case 0x10: case 0x11: case 0x2A: case 0x2C: case 0x2D:
+            case 0x51: case 0x52: case 0x53: case 0x58: case 0x59:
+            case 0x5A: case 0x5C: case 0x5D: case 0x5E: case 0x5F:
+            case 0xC2:
+                if (simd_prefix >= 2)
+                    reg_size = 128;
+                break;
+            case 0x2E: case 0x2F:
+                reg_size = 128;
+                break;
+        }
     }
 
-    // AVX Gather Instruction set
-    if (ins_size == 0) {
-        ins_size = vgather_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
-    }
+    d->ins_size = ins_size;
+    d->modbyte = modbyte;
+    d->opcode = opcode;
+    d->vexreg = vexreg;
+    d->high_reg = high_reg;
+    d->high_index = high_index;
+    d->high_base = high_base;
+    d->reg_size = reg_size;
+    d->operand_size = operand_size;
+    d->leading_opcode = leading_opcode;
+    d->simd_prefix = simd_prefix;
 
-    // FMA Instruction set
-    if (ins_size == 0) {
-        ins_size = fma_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
-    }
+    return 1;
+}
 
-    // F16C Instruction set
-    if (ins_size == 0) {
-        ins_size = f16c_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
+//opcode maps each set decodes, bit n for leading_opcode n
+static const uint8_t vex_set_maps[VEX_SET_MAX] = {
+    [VEX_SET_VAES]    = 0xC,
+    [VEX_SET_AVX]     = 0xC,
+    [VEX_SET_VGATHER] = 0xC,
+    [VEX_SET_FMA]     = 0xC,
+    [VEX_SET_F16C]    = 0xC,
+    [VEX_SET_BMI]     = 0xC,
+    [VEX_SET_VSSE]    = 0x2,
+    [VEX_SET_VSSE2]   = 0x2,
+    [VEX_SET_VSSE3]   = 0x2,
+    [VEX_SET_VSSSE3]  = 0xC,
+    [VEX_SET_VSSE41]  = 0xE,
+    [VEX_SET_VSSE42]  = 0xC,
+};
+
+//bytes a set decodes on one of 0F38/0F3A only, on the other map a later set owns them
+static const struct {
+    uint8_t set, map, lo, hi;
+} vex_set_only[] = {
+    { VEX_SET_AVX,    3, 0x00, 0x06 },  //vpermq..vperm2f128, not vpshufb..vphsubd
+    { VEX_SET_AVX,    2, 0x0C, 0x0F },  //vpermilps/pd, vtestps/pd, not vblendps..vpblendw
+    { VEX_SET_AVX,    3, 0x38, 0x39 },  //vinserti128/vextracti128, not vpminsb/vpminsd
+    { VEX_SET_F16C,   3, 0x1D, 0x1D },  //vcvtps2ph, not vpabsw
+    { VEX_SET_VSSSE3, 2, 0x08, 0x0B },  //vpsign*, vpmulhrsw, not vround*
+};
+
+/** Runs one ISA set on a decoded VEX instruction. returns the number of bytes consumed. **/
+static int vex_set(int set, struct pt_regs *regs, const struct vex_decode *d, uint8_t *instruction)
+{
+    //the sets take modrm and the bytes after the opcode, the same address
+    uint8_t *modrm = &instruction[d->ins_size];
+    uint8_t *bytep = modrm;
+    size_t i;
+
+    //a set consumes any opcode its switch lists, keep it off the other maps (vzeroupper is AVX's)
+    if (!(vex_set_maps[set] & (1 << d->leading_opcode)) &&
+        !((set == VEX_SET_AVX) && (d->leading_opcode == 1) && (d->opcode == 0x77)))
+        return 0;
+    for (i = 0; i < sizeof(vex_set_only) / sizeof(vex_set_only[0]); i++) {
+        if ((vex_set_only[i].set == set) && (vex_set_only[i].map != d->leading_opcode) &&
+            (d->opcode >= vex_set_only[i].lo) && (d->opcode <= vex_set_only[i].hi))
+            return 0;
     }
 
-    // BMI1/2 Instruction set
-    if (ins_size == 0) {
-    	ins_size = bmi_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
-    }
-    
-    // VSSE Instruction set
-    if (ins_size == 0) {
-        ins_size = vsse_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
+    switch (set) {
+        // VAES Instruction set
+        case VEX_SET_VAES:
+            return vaes_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // AVX / AVX2 Instruction set
+        case VEX_SET_AVX:
+            return avx_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // AVX Gather Instruction set
+        case VEX_SET_VGATHER:
+            return vgather_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // FMA Instruction set
+        case VEX_SET_FMA:
+            return fma_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // F16C Instruction set
+        case VEX_SET_F16C:
+            return f16c_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // BMI1/2 Instruction set
+        case VEX_SET_BMI:
+            return bmi_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // VSSE Instruction set
+        case VEX_SET_VSSE:
+            return vsse_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // VSSE2 Instruction set
+        case VEX_SET_VSSE2:
+            return vsse2_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // VSSE3 Instruction set
+        case VEX_SET_VSSE3:
+            return vsse3_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // VSSSE3 Instruction set
+        case VEX_SET_VSSSE3:
+            return vssse3_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // VSSE4.1 Instruction set
+        case VEX_SET_VSSE41:
+            return vsse41_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
+        // VSSE4.2 Instruction set
+        case VEX_SET_VSSE42:
+            return vsse42_instruction(regs, d->vexreg, d->opcode, modrm, d->high_reg, d->high_index, d->high_base, d->reg_size, d->operand_size, d->leading_opcode, d->simd_prefix, bytep, d->ins_size, d->modbyte);
     }
+    return 0;
+}
 
-    // VSSE2 Instruction set
-    if (ins_size == 0) {
-        ins_size = vsse2_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
+/** Runs the VEX emulator. returns the number of bytes consumed. **/
+int vex_ins(uint8_t *instruction, struct pt_regs *regs)
+{
+    struct vex_decode d;
+    struct decode_key key;
+    uint8_t lead;
+    int bytes = 0;
+    int set;
+
+    opemu_phase_stamp(PHASE_FETCH);
+
+    lead = (instruction[0] == 0x67) ? instruction[1] : instruction[0];
+    if ((lead != 0xC4) && (lead != 0xC5))
+        return 0;
+
+    //Shared decode cache: straight to the set that took it last time
+    if (opemu_decode_lookup(regs, instruction, &d, &key)) {
+        opemu_phase_stamp(PHASE_DECODE);
+        opemu_phase_class(PHASE_CLASS_VAES + d.set);
+        opemu_vex_active = 1;
+        bytes = vex_set(d.set, regs, &d, instruction);
+        opemu_vex_active = 0;
+        if (bytes) {
+            opemu_phase_stamp(PHASE_WRITEBACK);
+            return bytes;
+        }
     }
 
-    // VSSE3 Instruction set
-    if (ins_size == 0) {
-        ins_size = vsse3_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
-    }
+    if (!vex_decode(instruction, &d))
+        return 0;
 
-    // VSSSE3 Instruction set
-    if (ins_size == 0) {
-        ins_size = vssse3_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
-    }
+    opemu_phase_stamp(PHASE_DECODE);
 
-    // VSSE4.1 Instruction set
-    if (ins_size == 0) {
-        ins_size = vsse41_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
+    opemu_vex_active = 1;
+    for (set = 0; set < VEX_SET_MAX; set++) {
+        opemu_phase_class(PHASE_CLASS_VAES + set);
+        bytes = vex_set(set, regs, &d, instruction);
+        if (bytes)
+            break;
     }
+    opemu_vex_active = 0;
 
-    // VSSE4.2 Instruction set
-    if (ins_size == 0) {
-        ins_size = vsse42_instruction(regs, vexreg, opcode, modrm, high_reg, high_index, high_base, reg_size, operand_size, leading_opcode, simd_prefix, bytep, ins_size, modbyte);
+    if (bytes) {
+        d.set = set;
+        d.len = bytes;
+        opemu_decode_insert(&key, instruction, &d);
     }
 
-    return ins_size;
+    opemu_phase_stamp(PHASE_WRITEBACK);
+
+    return bytes;
 }
 
 /*********************************************************/
@@ -463,9 +620,11 @@ void get_x64regs(uint8_t *modrm,
             // Get the Mod.R/M memory address value.
             uint64_t maddr = 0;
             maddr = addressing64(regs, modrm, mod, num_src, high_index, high_base, modbyte, bytelen);
-            *rmaddrs = maddr;            
-            ((M64*)src)->u64 = *(uint64_t*)&maddr;
-            //copyin(maddr, (char*) &((M64*)src)->u64, 8);
+            opemu_trace_mem(maddr);
+            //stores go to user memory, only the operand read may use a pinned page
+            *rmaddrs = maddr;
+            maddr = opemu_pin_addr(maddr);
+            _read_maddr(src, maddr, 8);
         }
 
     }
@@ -483,8 +642,8 @@ void get_x64regs(uint8_t *modrm,
             // Get the Mod.R/M memory address value.
             maddr = addressing32(regs, modrm, mod, num_src, high_index, high_base, modbyte, bytelen);
             *rmaddrs = maddr;
-            ((M32*)src)->u32 = *(uint32_t*)&maddr;
-            //copyin(maddr, (char*) &((M32*)src)->u32, 4);
+            opemu_trace_mem(maddr);
+            _read_maddr(src, maddr, 4);
             
         }
     }
@@ -532,27 +691,18 @@ void get_rexregs(uint8_t *modrm,
         if (is_saved_state64(regs)) {
             uint64_t maddr = 0;
             maddr = addressing64(regs, modrm, mod, num_src, high_index, high_base, modbyte, bytelen);
+            opemu_trace_mem(maddr);
             *rmaddrs = maddr;
-            if (rm_size == 128) {
-                ((XMM*)src)->u128 = *(__uint128_t*)&maddr;
-                //copyin(maddr, (char*) &((XMM*)src)->u128, 16);
-            } else {
-                ((MM*)src)->u64 = *(uint64_t*)&maddr;
-                //copyin(maddr, (char*) &((MM*)src)->u64, 8);
-            }
+            maddr = opemu_pin_addr(maddr);
+            _read_maddr(src, maddr, (rm_size == 128) ? 16 : 8);
         }
 #endif
         if (is_saved_state32(regs)) {
             uint32_t maddr = 0;
             maddr = addressing32(regs, modrm, mod, num_src, high_index, high_base, modbyte, bytelen);
             *rmaddrs = maddr;
-            if (rm_size == 128) {
-                ((XMM*)src)->u128 = *(__uint128_t*)&maddr;
-                //copyin(maddr, (char*) &((XMM*)src)->u128, 16);
-            } else {
-                ((MM*)src)->u64 = *(uint64_t*)&maddr;
-                //copyin(maddr, (char*) &((MM*)src)->u64, 8);
-            }
+            opemu_trace_mem(maddr);
+            _read_maddr(src, maddr, (rm_size == 128) ? 16 : 8);
         }
     }
 }
@@ -580,6 +730,8 @@ void get_vexregs(uint8_t *modrm,
     uint8_t num_src = *modrm & 0x7; // ModRM.r/m (SRC1:register or memory)
     uint8_t bytelen = 0;
     
+    opemu_phase_first(PHASE_DISPATCH);
+
     if (high_reg) num_dst += 8;
     if (high_base) num_src += 8;
 
@@ -620,42 +772,29 @@ void get_vexregs(uint8_t *modrm,
         if (is_saved_state64(regs)) {
             uint64_t maddr = 0;
             maddr = addressing64(regs, modrm, mod, num_src, high_index, high_base, modbyte, bytelen);
+            opemu_trace_mem(maddr);
             *rmaddrs = maddr;
-            if(rm_size == 256) {
-                ((YMM*)src)->u256 = *(__uint256_t*)&maddr;
-                //copyin(maddr, (char*) &((YMM*)src)->u256, 32);
-            } else if(rm_size == 128) {
-                ((XMM*)src)->u128 = *(__uint128_t*)&maddr;
-                //copyin(maddr, (char*) &((XMM*)src)->u128, 16);
-            } else if(rm_size == 64) {
-                ((MM*)src)->u64 = *(uint64_t*)&maddr;
-                //copyin(maddr, (char*) &((MM*)src)->u64, 8);
-            } else if(rm_size == 32) {
-                ((MM*)src)->u64 = *(uint64_t*)&maddr;
-                //copyin(maddr, (char*) &((MM*)src)->u32, 4);
-            }
+            maddr = opemu_pin_addr(maddr);
+            //a narrow operand leaves the rest of the low quadword zero
+            if (rm_size < 64)
+                ((MM*)src)->u64 = 0;
+            _read_maddr(src, maddr, rm_size / 8);
         }
 #endif
         if (is_saved_state32(regs)) {
             uint32_t maddr = 0;
             maddr = addressing32(regs, modrm, mod, num_src, high_index, high_base, modbyte, bytelen);
             *rmaddrs = maddr;
-            if(rm_size == 256) {
-                ((YMM*)src)->u256 = *(__uint256_t*)&maddr;
-                //copyin(maddr, (char*) &((YMM*)src)->u256, 32);
-            } else if(rm_size == 128) {
-                ((XMM*)src)->u128 = *(__uint128_t*)&maddr;
-                //copyin(maddr, (char*) &((XMM*)src)->u128, 16);
-            } else if(rm_size == 64) {
-                ((MM*)src)->u64 = *(uint64_t*)&maddr;
-                //copyin(maddr, (char*) &((MM*)src)->u64, 8);
-            } else if(rm_size == 32) {
-                ((MM*)src)->u64 = *(uint64_t*)&maddr;
-                //copyin(maddr, (char*) &((MM*)src)->u32, 4);
-            }
+            opemu_trace_mem(maddr);
+            //a narrow operand leaves the rest of the low quadword zero
+            if (rm_size < 64)
+                ((MM*)src)->u64 = 0;
+            _read_maddr(src, maddr, rm_size / 8);
         }
         
     }
+
+    opemu_phase_first(PHASE_OPERAND);
 }
 
 uint64_t addressing64(
@@ -718,8 +857,7 @@ uint64_t addressing64(
             } else { //Not INDEX4
                 if ((base == 5) || (base == 13)) {
                     //[DISP32 + (INDEX * FACTOR)] MODRM + 5
-                    bytelen = modbyte + 5;
-                    address = (regs->ip + bytelen + *((int32_t*)&modrm[2])) + (reg_sel[index] * factor);
+                    address = *((int32_t*)&modrm[2]) + (reg_sel[index] * factor);
                     //consumed += 5;
                 } else {
                     //[BASE + (INDEX * FACTOR)] MODRM + 1
@@ -794,26 +932,23 @@ uint64_t addressing64(
             
             if (index == 4) { //INDEX4
                 //[BASE + DISP32] MODRM + 5
-                bytelen = modbyte + 5;
-                address = reg_sel[base] + (regs->ip + bytelen + *((int32_t*)&modrm[2]));
+                address = reg_sel[base] + *((int32_t*)&modrm[2]);
                 //consumed += 5;
             } else { //Not INDEX4
                 //[BASE + (INDEX * FACTOR) + DISP32] MODRM + 5
-                bytelen = modbyte + 5;
-                address = reg_sel[base] + (reg_sel[index] * factor) + (regs->ip + bytelen + *((int32_t*)&modrm[2]));
+                address = reg_sel[base] + (reg_sel[index] * factor) + *((int32_t*)&modrm[2]);
                 //consumed += 5;
             }
         }
         //SIB END
         else {
             //[SRC + DISP32] MODRM + 4
-            bytelen = modbyte + 4;
-            address = reg_sel[num_src] + (regs->ip + bytelen + *((int32_t*)&modrm[1]));
+            address = reg_sel[num_src] + *((int32_t*)&modrm[1]);
             //consumed += 4;
         }
     }
     // 64-bit address
-    return address;
+    return opemu_exec_addr(address);
 }
 
 uint32_t addressing32(
@@ -999,9 +1134,10 @@ uint64_t vmaddrs(struct pt_regs *regs,
     
     vindex = vaddr.a64[0];
     
+    //VSIB has no RIP-relative form, base 5 under mod 0 means no base
     if (mod == 0) {
-        if ((base == 5) || (base == 13)) {
-            address = (regs->ip + ins_size + *((int32_t*)&modrm[2])) + (vindex * factor);
+        if ((base & 7) == 5) {
+            address = (int64_t)*((int32_t*)&modrm[2]) + (vindex * factor);
         } else {
             address = reg_sel[base] + (vindex * factor);
         }
@@ -1010,8 +1146,8 @@ uint64_t vmaddrs(struct pt_regs *regs,
         address = reg_sel[base] + (vindex * factor) + *((int8_t*)&modrm[2]);
     }
     if (mod == 2) {
-        address = reg_sel[base] + (vindex * factor) + (regs->ip + ins_size + *((int32_t*)&modrm[2]));
+        address = reg_sel[base] + (vindex * factor) + *((int32_t*)&modrm[2]);
     }
     
-    return address;
+    return opemu_exec_addr(opemu_pin_addr(address));
 }
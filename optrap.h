@@ -11,6 +11,9 @@
 
 #include <linux/ptrace.h>
 #include <linux/kernel.h>
+#include <linux/uaccess.h>
+
+#include "phase.h"
 
 //SaturateToSignedByte
 #define STSB(x) ((x > 127)? 127 : ((x < -128)? -128 : x) )
@@ -108,24 +111,42 @@ typedef union M32_u M32;
 /**************************
  * Virtual YMM Register
  *************************/
-static YMM VYMM0;
-static YMM VYMM1;
-static YMM VYMM2;
-static YMM VYMM3;
-static YMM VYMM4;
-static YMM VYMM5;
-static YMM VYMM6;
-static YMM VYMM7;
-static YMM VYMM8;
-static YMM VYMM9;
-static YMM VYMM10;
-static YMM VYMM11;
-static YMM VYMM12;
-static YMM VYMM13;
-static YMM VYMM14;
-static YMM VYMM15;
-
-int opemu_utrap(struct pt_regs *regs);
+extern YMM VYMM0;
+extern YMM VYMM1;
+extern YMM VYMM2;
+extern YMM VYMM3;
+extern YMM VYMM4;
+extern YMM VYMM5;
+extern YMM VYMM6;
+extern YMM VYMM7;
+extern YMM VYMM8;
+extern YMM VYMM9;
+extern YMM VYMM10;
+extern YMM VYMM11;
+extern YMM VYMM12;
+extern YMM VYMM13;
+extern YMM VYMM14;
+extern YMM VYMM15;
+
+//set while vex_ins runs a handler
+extern int opemu_vex_active;
+
+/**
+ * Saved XMM file of the interrupted context. While it is set the
+ * handlers read and write the copy instead of the hardware registers,
+ * so compiled code and libc may use any XMM register as a temporary.
+ * The userspace stub saves the registers on entry and loads them back
+ * on the way out, the module does the same around each trap (xfile.c).
+ */
+#ifdef __KERNEL__
+#include "xfile.h"
+#define opemu_xfile_get()   ((XMM *)opemu_xfile_cur())
+#else
+extern __thread XMM *opemu_xfile __attribute__((tls_model("initial-exec")));
+#define opemu_xfile_get()   (opemu_xfile)
+#endif
+
+int opemu_utrap(struct pt_regs *regs, uint64_t deadline);
 
 int rex_ins(uint8_t *instruction, struct pt_regs *regs);
 int vex_ins(uint8_t *instruction, struct pt_regs *regs);
@@ -244,11 +265,35 @@ do {                                \
 asm __volatile__ ("movq %0, %%mm" #n :: "m" (*(where)));    \
 } while (0);
 
+/**
+ * Copy 16 bytes through general purpose registers. The compiler may use
+ * any XMM register as a temporary for plain struct copies, which would
+ * clobber live user state around _store_ymm/_load_ymm.
+ */
+static inline void _copy_u128 (void *dst, const void *src)
+{
+    uint64_t lo, hi;
+
+    asm __volatile__ ("movq 0(%2), %0\n\t"
+                      "movq 8(%2), %1\n\t"
+                      "movq %0, 0(%3)\n\t"
+                      "movq %1, 8(%3)"
+                      : "=&r" (lo), "=&r" (hi)
+                      : "r" (src), "r" (dst)
+                      : "memory");
+}
+
 /**
  * Store xmm register somewhere in memory
  */
 static inline void _store_xmm (uint8_t n, XMM *where)
 {
+    XMM *xfile = opemu_xfile_get();
+
+    if (xfile) {
+        _copy_u128(where, &xfile[n & 15]);
+        return;
+    }
     switch (n) {
         case 0:  storedqu_template(0, where); break;
         case 1:  storedqu_template(1, where); break;
@@ -269,11 +314,43 @@ static inline void _store_xmm (uint8_t n, XMM *where)
     }
 }
 
+static inline YMM *_vymm (uint8_t n)
+{
+    switch (n) {
+        case 0:  return &VYMM0;
+        case 1:  return &VYMM1;
+        case 2:  return &VYMM2;
+        case 3:  return &VYMM3;
+        case 4:  return &VYMM4;
+        case 5:  return &VYMM5;
+        case 6:  return &VYMM6;
+        case 7:  return &VYMM7;
+        case 8:  return &VYMM8;
+        case 9:  return &VYMM9;
+        case 10: return &VYMM10;
+        case 11: return &VYMM11;
+        case 12: return &VYMM12;
+        case 13: return &VYMM13;
+        case 14: return &VYMM14;
+        default: return &VYMM15;
+    }
+}
+
 /**
  * Load xmm register from memory
  */
 static inline void _load_xmm (uint8_t n, XMM *where)
 {
+    XMM *xfile = opemu_xfile_get();
+
+    opemu_phase_first(PHASE_COMPUTE);
+    //a VEX write of an XMM register clears bits 255:128
+    if (opemu_vex_active)
+        _vymm(n)->u128[1] = 0;
+    if (xfile) {
+        _copy_u128(&xfile[n & 15], where);
+        return;
+    }
     switch (n) {
         case 0:  loaddqu_template(0, where); break;
         case 1:  loaddqu_template(1, where); break;
@@ -329,72 +406,46 @@ static inline void _load_mmx (uint8_t n, MM *where)
 }
 
 /**
- * Load Memory from XMM/YMM register
+ * Memory operands. The pin cache and the exec window hand out kernel
+ * addresses, below TASK_SIZE_MAX the address is the user's and goes
+ * through uaccess. returns 0, -EFAULT if it does not map (a failed read
+ * leaves zeros).
  */
-static inline void _load_maddr_from_ymm (uint64_t rmaddrs, YMM *where, uint16_t rm_size, struct pt_regs *regs) {
-#ifdef __x86_64__
-    if (is_saved_state64(regs)) {
-        if (rm_size == 256) {
-            __uint256_t M256RES = ((YMM*)where)->u256;
-            *((__uint256_t*)&rmaddrs) = M256RES;
-        } else if (rm_size == 128) {
-            __uint128_t M128RES = ((YMM*)where)->u128[0];
-            *((__uint128_t*)&rmaddrs) = M128RES;
-        } else if (rm_size == 64) {
-            uint64_t M64RES = ((YMM*)where)->u64[0];
-            *((uint64_t*)&rmaddrs) = M64RES;
-        } else if (rm_size == 32) {
-            uint32_t M32RES = ((YMM*)where)->u32[0];
-            *((uint32_t*)&rmaddrs) = M32RES;
-        }
+static inline int _read_maddr (void *to, uint64_t maddr, unsigned int len)
+{
+#ifdef __KERNEL__
+    if (maddr >= TASK_SIZE_MAX) {
+        memcpy(to, (void *)(unsigned long)maddr, len);
+        return 0;
     }
 #endif
-    if (is_saved_state32(regs)) {
-        uint32_t rmaddrs32 = rmaddrs & 0xffffffff;
-        if (rm_size == 256) {
-            __uint256_t M256RES = ((YMM*)where)->u256;
-            *((__uint256_t*)&rmaddrs32) = M256RES;
-        } else if (rm_size == 128) {
-            __uint128_t M128RES = ((YMM*)where)->u128[0];
-            *((__uint128_t*)&rmaddrs32) = M128RES;
-        } else if (rm_size == 64) {
-            uint64_t M64RES = ((YMM*)where)->u64[0];
-            *((uint64_t*)&rmaddrs32) = M64RES;
-        } else if (rm_size == 32) {
-            uint32_t M32RES = ((YMM*)where)->u32[0];
-            *((uint32_t*)&rmaddrs) = M32RES;
-        }
-    }
+    return copy_from_user(to, (void __user *)(unsigned long)maddr, len) ? -EFAULT : 0;
 }
 
-static inline void _load_maddr_from_xmm (uint64_t rmaddrs, XMM *where, uint16_t rm_size, struct pt_regs *regs) {
-#ifdef __x86_64__
-    if (is_saved_state64(regs)) {
-        if (rm_size == 128) {
-            __uint128_t M128RES = ((XMM*)where)->u128;
-            *((__uint128_t*)&rmaddrs) = M128RES;
-        } else if (rm_size == 64) {
-            uint64_t M64RES = ((XMM*)where)->u64[0];
-            *((uint64_t*)&rmaddrs) = M64RES;
-        } else if (rm_size == 32) {
-            uint32_t M32RES = ((XMM*)where)->u32[0];
-            *((uint32_t*)&rmaddrs) = M32RES;
-        }
+static inline int _write_maddr (uint64_t maddr, const void *from, unsigned int len)
+{
+#ifdef __KERNEL__
+    if (maddr >= TASK_SIZE_MAX) {
+        memcpy((void *)(unsigned long)maddr, from, len);
+        return 0;
     }
 #endif
-    if (is_saved_state32(regs)) {
-        uint32_t rmaddrs32 = rmaddrs & 0xffffffff;
-        if (rm_size == 128) {
-            __uint128_t M128RES = ((XMM*)where)->u128;
-            *((__uint128_t*)&rmaddrs32) = M128RES;
-        } else if (rm_size == 64) {
-            uint64_t M64RES = ((XMM*)where)->u64[0];
-            *((uint64_t*)&rmaddrs32) = M64RES;
-        } else if (rm_size == 32) {
-            uint32_t M32RES = ((XMM*)where)->u32[0];
-            *((uint32_t*)&rmaddrs) = M32RES;
-        }
-    }
+    return copy_to_user((void __user *)(unsigned long)maddr, from, len) ? -EFAULT : 0;
+}
+
+/**
+ * Load Memory from XMM/YMM register
+ */
+static inline void _load_maddr_from_ymm (uint64_t rmaddrs, YMM *where, uint16_t rm_size, struct pt_regs *regs) {
+    if (is_saved_state32(regs))
+        rmaddrs &= 0xffffffff;
+    _write_maddr(rmaddrs, where, rm_size / 8);
+}
+
+static inline void _load_maddr_from_xmm (uint64_t rmaddrs, XMM *where, uint16_t rm_size, struct pt_regs *regs) {
+    if (is_saved_state32(regs))
+        rmaddrs &= 0xffffffff;
+    _write_maddr(rmaddrs, where, rm_size / 8);
 }
 
 /**
@@ -402,32 +453,9 @@ static inline void _load_maddr_from_xmm (uint64_t rmaddrs, XMM *where, uint16_t
  */
 static inline void _store_ymm (uint8_t n, YMM *where)
 {
-    YMM vymmres;
-    XMM lowymm;
-    
-    switch (n) {
-        case 0:  vymmres = VYMM0; break;
-        case 1:  vymmres = VYMM1; break;
-        case 2:  vymmres = VYMM2; break;
-        case 3:  vymmres = VYMM3; break;
-        case 4:  vymmres = VYMM4; break;
-        case 5:  vymmres = VYMM5; break;
-        case 6:  vymmres = VYMM6; break;
-        case 7:  vymmres = VYMM7; break;
-        case 8:  vymmres = VYMM8; break;
-        case 9:  vymmres = VYMM9; break;
-        case 10: vymmres = VYMM10; break;
-        case 11: vymmres = VYMM11; break;
-        case 12: vymmres = VYMM12; break;
-        case 13: vymmres = VYMM13; break;
-        case 14: vymmres = VYMM14; break;
-        case 15: vymmres = VYMM15; break;
-    }
-    
-    ((YMM*)where)->u256 = vymmres.u256;
-    
-    _store_xmm(n, &lowymm);
-    ((YMM*)where)->u128[0] = lowymm.u128;
+    //low half straight from the hardware register first
+    _store_xmm(n, (XMM*)where);
+    _copy_u128(&((YMM*)where)->u128[1], &_vymm(n)->u128[1]);
 }
 
 /**
@@ -435,32 +463,13 @@ static inline void _store_ymm (uint8_t n, YMM *where)
  */
 static inline void _load_ymm (uint8_t n, YMM *where)
 {
-    YMM vymmres;
-    XMM lowymm;
-
-    vymmres.u256 = ((YMM*)where)->u256;
-    lowymm.u128 = ((YMM*)where)->u128[0];
+    YMM *vymm = _vymm(n);
 
-    switch (n) {
-        case 0:  VYMM0 = vymmres; break;
-        case 1:  VYMM1 = vymmres; break;
-        case 2:  VYMM2 = vymmres; break;
-        case 3:  VYMM3 = vymmres; break;
-        case 4:  VYMM4 = vymmres; break;
-        case 5:  VYMM5 = vymmres; break;
-        case 6:  VYMM6 = vymmres; break;
-        case 7:  VYMM7 = vymmres; break;
-        case 8:  VYMM8 = vymmres; break;
-        case 9:  VYMM9 = vymmres; break;
-        case 10: VYMM10 = vymmres; break;
-        case 11: VYMM11 = vymmres; break;
-        case 12: VYMM12 = vymmres; break;
-        case 13: VYMM13 = vymmres; break;
-        case 14: VYMM14 = vymmres; break;
-        case 15: VYMM15 = vymmres; break;
-    }
-    
-    _load_xmm (n, &lowymm);
+    opemu_phase_first(PHASE_COMPUTE);
+    //low half first, _load_xmm clears the upper one under VEX
+    _load_xmm(n, (XMM*)where);
+    _copy_u128(&vymm->u128[0], &((YMM*)where)->u128[0]);
+    _copy_u128(&vymm->u128[1], &((YMM*)where)->u128[1]);
 }
 
 /**
@@ -0,0 +1,291 @@
+//
+//  perm.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifdef __KERNEL__
+#include <linux/kernel.h>
+#include <linux/jump_label.h>
+#include <asm/cpufeature.h>
+#else
+#include <string.h>
+#endif
+
+#include "perm.h"
+#include "softfloat.h"
+
+/*********************************************************
+ *** Shuffle, unpack, align, permute, insertps and     ***
+ *** pmovzx/sx as one byte permutation. Immediate      ***
+ *** forms index a table built for every imm8 at load, ***
+ *** register-controlled forms build the index vector  ***
+ *** from the control operand. One kernel applies it:  ***
+ *** native pshufb per 16-byte block of a:b when the   ***
+ *** host has SSSE3, a byte gather on general         ***
+ *** registers otherwise or with soft_fp=1. Built      ***
+ *** -mgeneral-regs-only: the pshufb path is one asm   ***
+ *** block that puts back the XMM registers it uses.   ***
+ *********************************************************/
+
+//distinct index vectors per kind: the byte shifts saturate, the rest ignore imm
+static const uint16_t perm_count[PERM_KINDS] = {
+    [PERM_PSHUFD]    = 256,
+    [PERM_PSHUFHW]   = 256,
+    [PERM_PSHUFLW]   = 256,
+    [PERM_SHUFPS]    = 256,
+    [PERM_SHUFPD]    = 256,
+    [PERM_PERMILPD]  = 256,
+    [PERM_PERMQ]     = 256,
+    [PERM_PERM2X128] = 256,
+    [PERM_INSERTPS]  = 256,
+    [PERM_PALIGNR]   = 33,
+    [PERM_PSLLDQ]    = 17,
+    [PERM_PSRLDQ]    = 17,
+    [PERM_UNPCKLBW ... PERM_PMOVSXDQ] = 1,
+};
+
+#define PERM_ENTRIES (9 * 256 + 33 + 17 + 17 + 20)
+
+static uint16_t perm_base[PERM_KINDS];
+static uint8_t perm_tab[PERM_ENTRIES][32];
+
+#ifdef __KERNEL__
+static DEFINE_STATIC_KEY_FALSE(perm_pshufb_key);
+#define perm_pshufb()   static_branch_likely(&perm_pshufb_key)
+#else
+static int perm_pshufb_user;
+#define perm_pshufb()   (perm_pshufb_user)
+#endif
+
+/**********************************************/
+/**  Index vector for one kind and imm8      **/
+/**********************************************/
+static uint8_t perm_byte(int kind, unsigned imm, int i)
+{
+    int lane = i & 16;          //lane base, in-lane kinds
+    int p = i & 15;             //byte within the lane
+    int e, sel, size, j;
+
+    switch (kind) {
+        case PERM_PSHUFD:
+            sel = (imm >> (p / 4 * 2)) & 3;
+            return lane + sel * 4 + (p & 3);
+        case PERM_PSHUFHW:
+            if (p < 8)
+                return i;
+            sel = (imm >> ((p - 8) / 2 * 2)) & 3;
+            return lane + 8 + sel * 2 + (p & 1);
+        case PERM_PSHUFLW:
+            if (p >= 8)
+                return i;
+            sel = (imm >> (p / 2 * 2)) & 3;
+            return lane + sel * 2 + (p & 1);
+        case PERM_SHUFPS:
+            e = p / 4;
+            sel = (imm >> (e * 2)) & 3;
+            return (e < 2 ? 0 : 32) + lane + sel * 4 + (p & 3);
+        case PERM_SHUFPD:
+            e = p / 8;
+            sel = (imm >> (lane / 8 + e)) & 1;
+            return (e == 0 ? 0 : 32) + lane + sel * 8 + (p & 7);
+        case PERM_PERMILPD:
+            sel = (imm >> (lane / 8 + p / 8)) & 1;
+            return lane + sel * 8 + (p & 7);
+        case PERM_PERMQ:
+            sel = (imm >> (i / 8 * 2)) & 3;
+            return sel * 8 + (i & 7);
+        case PERM_PERM2X128:
+            sel = (imm >> (lane / 4)) & 15;
+            if (sel & 8)
+                return PERM_ZERO;
+            return (sel & 2) * 16 + (sel & 1) * 16 + p;
+        case PERM_INSERTPS:
+            e = i / 4;
+            if (i >= 16 || ((imm >> e) & 1))
+                return PERM_ZERO;
+            if (e == ((imm >> 4) & 3))
+                return 32 + ((imm >> 6) & 3) * 4 + (i & 3);
+            return i;
+        case PERM_PALIGNR:
+            //lane of a:b shifted right, b low
+            j = p + imm;
+            if (j < 16)
+                return 32 + lane + j;
+            if (j < 32)
+                return lane + j - 16;
+            return PERM_ZERO;
+        case PERM_PSLLDQ:
+            return p >= (int)imm ? lane + p - imm : PERM_ZERO;
+        case PERM_PSRLDQ:
+            return p + imm < 16 ? lane + p + imm : PERM_ZERO;
+        case PERM_UNPCKLBW ... PERM_UNPCKHQDQ:
+            size = 1 << ((kind - PERM_UNPCKLBW) & 3);
+            e = p / size;
+            j = lane + (kind >= PERM_UNPCKHBW ? 8 : 0) + e / 2 * size + p % size;
+            return (e & 1) ? 32 + j : j;
+        default: {
+            //pmovzx/sx: source element size, destination element size
+            static const uint8_t sz[6][2] = {
+                {1, 2}, {1, 4}, {1, 8}, {2, 4}, {2, 8}, {4, 8}
+            };
+            int sx = kind >= PERM_PMOVSXBW;
+            int s = sz[kind - (sx ? PERM_PMOVSXBW : PERM_PMOVZXBW)][0];
+            int d = sz[kind - (sx ? PERM_PMOVSXBW : PERM_PMOVZXBW)][1];
+
+            e = i / d;
+            j = i % d;
+            if (j < s)
+                return e * s + j;
+            return sx ? 32 + e * s + s - 1 : PERM_ZERO;
+        }
+    }
+}
+
+static void perm_build(void)
+{
+    int kind, n, i;
+    uint16_t base = 0;
+
+    for (kind = 0; kind < PERM_KINDS; ++kind) {
+        perm_base[kind] = base;
+        for (n = 0; n < perm_count[kind]; ++n)
+            for (i = 0; i < 32; ++i)
+                perm_tab[base + n][i] = perm_byte(kind, n, i);
+        base += perm_count[kind];
+    }
+}
+
+const uint8_t *perm_imm(int kind, uint8_t imm)
+{
+    unsigned n = imm;
+
+    if (n >= perm_count[kind])
+        n = perm_count[kind] - 1;
+    return perm_tab[perm_base[kind] + n];
+}
+
+/**********************************************/
+/**  Index vectors from a control register   **/
+/**********************************************/
+void perm_pshufb_idx(uint8_t *idx, const uint8_t *ctl, int len)
+{
+    int i;
+
+    for (i = 0; i < len; ++i)
+        idx[i] = (ctl[i] & 0x80) ? PERM_ZERO : (i & 16) + (ctl[i] & 15);
+}
+
+void perm_elem_idx(uint8_t *idx, const uint8_t *ctl, int len, int size, int shift, int mask, int inlane)
+{
+    int i, j, sel, base;
+
+    for (i = 0; i < len; i += size) {
+        sel = (ctl[i] >> shift) & mask;
+        base = inlane ? (i & 16) : 0;
+        for (j = 0; j < size; ++j)
+            idx[i + j] = base + sel * size + j;
+    }
+}
+
+void perm_signs(uint8_t *dst, const uint8_t *a, int len)
+{
+    uint64_t v;
+    int i;
+
+    for (i = 0; i < len; i += 8) {
+        memcpy(&v, &a[i], 8);
+        v = ((v >> 7) & 0x0101010101010101ULL) * 0xFF;
+        memcpy(&dst[i], &v, 8);
+    }
+}
+
+/**********************************************/
+/**  Apply                                   **/
+/**********************************************/
+//the blocks a 128-bit source does not have: every index zeroes
+static const uint8_t perm_none[16];
+
+//OR of one pshufb per source block, indexes outside the block get bit 7.
+//xmm0-2 are the user's, saved and restored around the shuffles
+static void perm_apply_pshufb(uint8_t *dst, const uint8_t *a, const uint8_t *b, const uint8_t *idx, int len)
+{
+    const uint8_t *blk[4] = { a, a + 16, b, b + 16 };
+    uint8_t ctl[4][16], save[3][16];
+    uint8_t c;
+    int i, j, k;
+
+    if (len == 16)
+        blk[1] = blk[3] = perm_none;
+    if (!b)
+        blk[2] = blk[3] = perm_none;
+
+    for (i = 0; i < len; i += 16) {
+        for (k = 0; k < 4; ++k) {
+            for (j = 0; j < 16; ++j) {
+                c = idx[i + j] - k * 16;
+                ctl[k][j] = (blk[k] == perm_none) ? 0x80 : c | ((c > 15) ? 0x80 : 0);
+            }
+        }
+        asm volatile ("movdqu %%xmm0, 0(%[save])\n\t"
+                      "movdqu %%xmm1, 16(%[save])\n\t"
+                      "movdqu %%xmm2, 32(%[save])\n\t"
+                      "pxor %%xmm0, %%xmm0\n\t"
+                      "movdqu (%[b0]), %%xmm1\n\t"  "movdqu 0(%[ctl]), %%xmm2\n\t"
+                      "pshufb %%xmm2, %%xmm1\n\t"   "por %%xmm1, %%xmm0\n\t"
+                      "movdqu (%[b1]), %%xmm1\n\t"  "movdqu 16(%[ctl]), %%xmm2\n\t"
+                      "pshufb %%xmm2, %%xmm1\n\t"   "por %%xmm1, %%xmm0\n\t"
+                      "movdqu (%[b2]), %%xmm1\n\t"  "movdqu 32(%[ctl]), %%xmm2\n\t"
+                      "pshufb %%xmm2, %%xmm1\n\t"   "por %%xmm1, %%xmm0\n\t"
+                      "movdqu (%[b3]), %%xmm1\n\t"  "movdqu 48(%[ctl]), %%xmm2\n\t"
+                      "pshufb %%xmm2, %%xmm1\n\t"   "por %%xmm1, %%xmm0\n\t"
+                      "movdqu %%xmm0, (%[dst])\n\t"
+                      "movdqu 0(%[save]), %%xmm0\n\t"
+                      "movdqu 16(%[save]), %%xmm1\n\t"
+                      "movdqu 32(%[save]), %%xmm2"
+                      :
+                      : [dst] "r" (&dst[i]), [ctl] "r" (ctl), [save] "r" (save),
+                        [b0] "r" (blk[0]), [b1] "r" (blk[1]), [b2] "r" (blk[2]), [b3] "r" (blk[3])
+                      : "memory");
+    }
+}
+
+static void perm_apply_gpr(uint8_t *dst, const uint8_t *a, const uint8_t *b, const uint8_t *idx, int len)
+{
+    int i;
+
+    for (i = 0; i < len; ++i) {
+        uint8_t x = idx[i];
+
+        if (x & PERM_ZERO)
+            dst[i] = 0;
+        else
+            dst[i] = x < 32 ? a[x] : b[x - 32];
+    }
+}
+
+void perm_apply(uint8_t *dst, const uint8_t *a, const uint8_t *b, const uint8_t *idx, int len)
+{
+    if (perm_pshufb() && !opemu_softfp())
+        perm_apply_pshufb(dst, a, b, idx, len);
+    else
+        perm_apply_gpr(dst, a, b, idx, len);
+}
+
+#ifdef __KERNEL__
+void opemu_perm_init(void)
+{
+    perm_build();
+    if (boot_cpu_has(X86_FEATURE_SSSE3))
+        static_branch_enable(&perm_pshufb_key);
+}
+#else
+__attribute__((constructor)) static void perm_user_init(void)
+{
+    perm_build();
+    __builtin_cpu_init();
+    perm_pshufb_user = __builtin_cpu_supports("ssse3");
+}
+#endif
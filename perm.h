@@ -0,0 +1,83 @@
+//
+//  perm.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef perm_h
+#define perm_h
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#else
+#include <stdint.h>
+#endif
+
+/**********************************************/
+/**  Byte permutations: dst[i] = (a:b)[idx[i]] **/
+/**  a is bytes 0-31, b is bytes 32-63        **/
+/**********************************************/
+
+//idx entry that writes a zero byte
+#define PERM_ZERO 0x80
+
+//index vectors built per imm8 at load, perm_imm(kind, imm)
+enum perm_kind {
+    PERM_PSHUFD = 0,    //also vpermilps imm
+    PERM_PSHUFHW,
+    PERM_PSHUFLW,
+    PERM_SHUFPS,
+    PERM_SHUFPD,
+    PERM_PERMILPD,
+    PERM_PERMQ,         //also vpermpd
+    PERM_PERM2X128,
+    PERM_INSERTPS,
+    PERM_PALIGNR,
+    PERM_PSLLDQ,
+    PERM_PSRLDQ,
+    //no immediate
+    PERM_UNPCKLBW,
+    PERM_UNPCKLWD,
+    PERM_UNPCKLDQ,      //also vunpcklps
+    PERM_UNPCKLQDQ,     //also vunpcklpd
+    PERM_UNPCKHBW,
+    PERM_UNPCKHWD,
+    PERM_UNPCKHDQ,
+    PERM_UNPCKHQDQ,
+    PERM_PMOVZXBW,
+    PERM_PMOVZXBD,
+    PERM_PMOVZXBQ,
+    PERM_PMOVZXWD,
+    PERM_PMOVZXWQ,
+    PERM_PMOVZXDQ,
+    //b is perm_signs(a)
+    PERM_PMOVSXBW,
+    PERM_PMOVSXBD,
+    PERM_PMOVSXBQ,
+    PERM_PMOVSXWD,
+    PERM_PMOVSXWQ,
+    PERM_PMOVSXDQ,
+    PERM_KINDS
+};
+
+const uint8_t *perm_imm(int kind, uint8_t imm);
+
+//vpshufb: bit 7 zeroes, bits 3:0 pick within the lane
+void perm_pshufb_idx(uint8_t *idx, const uint8_t *ctl, int len);
+//vpermilps/pd, vpermd/ps: (ctl element >> shift) & mask picks an element,
+//within its 128-bit lane if inlane
+void perm_elem_idx(uint8_t *idx, const uint8_t *ctl, int len, int size, int shift, int mask, int inlane);
+//dst[i] = a[i] < 0 ? 0xFF : 0
+void perm_signs(uint8_t *dst, const uint8_t *a, int len);
+
+//len 16 or 32, a and b hold len bytes, b may be NULL if idx never reaches it,
+//dst must not overlap them
+void perm_apply(uint8_t *dst, const uint8_t *a, const uint8_t *b, const uint8_t *idx, int len);
+
+#ifdef __KERNEL__
+void opemu_perm_init(void);
+#endif
+
+#endif /* perm_h */
@@ -0,0 +1,277 @@
+//
+//  phase.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/debugfs.h>
+#include <linux/math64.h>
+#include <linux/module.h>
+#include <linux/mutex.h>
+#include <linux/percpu.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/timex.h>
+#include <linux/uaccess.h>
+
+#include "phase.h"
+#include "opdev.h"
+
+/*********************************************************
+ *** Trap path latency breakdown.                      ***
+ *** With the key enabled each trap stamps the TSC at  ***
+ *** the phase boundaries into a per-CPU record owned  ***
+ *** by the trapping task; on the way out the deltas   ***
+ *** go into per-CPU log2 histograms per opcode class. ***
+ *** A phase without a stamp is charged to the next    ***
+ *** stamped one. A task that slept and migrated finds ***
+ *** the record not its own and drops the sample.      ***
+ *** /sys/kernel/debug/opemu/phase_enable  toggle      ***
+ *** /sys/kernel/debug/opemu/phase_hist    write clears ***
+ *********************************************************/
+
+DEFINE_STATIC_KEY_FALSE(opemu_phase_key);
+
+struct phase_rec {
+    struct task_struct *owner;
+    int cls;
+    //[0] trap entry, [p + 1] end of phase p
+    uint64_t stamp[PHASE_MAX + 1];
+};
+
+struct phase_hist {
+    uint64_t count[PHASE_CLASS_MAX][PHASE_MAX];
+    uint64_t cycles[PHASE_CLASS_MAX][PHASE_MAX];
+    uint32_t bucket[PHASE_CLASS_MAX][PHASE_MAX][PHASE_BUCKETS];
+};
+
+static struct phase_rec __percpu *phase_recs;
+static struct phase_hist __percpu *phase_hists;
+static struct dentry *phase_files[2];
+static DEFINE_MUTEX(phase_mutex);
+
+static const char *phase_names[PHASE_MAX] = {
+    "entry", "fetch", "decode", "dispatch", "operand", "compute", "writeback", "return"
+};
+
+static const char *phase_class_names[PHASE_CLASS_MAX] = {
+    "none", "loop", "fuse", "rex", "vaes", "avx", "vgather", "fma",
+    "f16c", "bmi", "vsse", "vsse2", "vsse3", "vssse3", "vsse41", "vsse42"
+};
+
+void __opemu_phase_begin(void)
+{
+    struct phase_rec *rec = get_cpu_ptr(phase_recs);
+
+    memset(rec->stamp, 0, sizeof(rec->stamp));
+    rec->owner = current;
+    rec->cls = PHASE_CLASS_NONE;
+    rec->stamp[0] = get_cycles();
+    put_cpu_ptr(phase_recs);
+}
+
+void __opemu_phase_stamp(int phase, int first)
+{
+    struct phase_rec *rec = get_cpu_ptr(phase_recs);
+    int p;
+
+    if (rec->owner == current) {
+        if (!first) {
+            for (p = phase + 1; p < PHASE_MAX; p++)
+                rec->stamp[p + 1] = 0;
+            rec->stamp[phase + 1] = get_cycles();
+        } else if (!rec->stamp[phase + 1]) {
+            rec->stamp[phase + 1] = get_cycles();
+        }
+    }
+    put_cpu_ptr(phase_recs);
+}
+
+void __opemu_phase_class(int cls)
+{
+    struct phase_rec *rec = get_cpu_ptr(phase_recs);
+
+    if (rec->owner == current)
+        rec->cls = cls;
+    put_cpu_ptr(phase_recs);
+}
+
+void __opemu_phase_end(int handled)
+{
+    struct phase_rec *rec = get_cpu_ptr(phase_recs);
+    struct phase_hist *hist;
+    uint64_t prev, delta;
+    int p, b;
+
+    if (rec->owner != current) {
+        put_cpu_ptr(phase_recs);
+        return;
+    }
+    rec->owner = NULL;
+    rec->stamp[PHASE_RETURN + 1] = get_cycles();
+
+    if (handled) {
+        hist = this_cpu_ptr(phase_hists);
+        prev = rec->stamp[0];
+        for (p = 0; p < PHASE_MAX; p++) {
+            //missing or out of order, charged to the next phase
+            if (rec->stamp[p + 1] < prev)
+                continue;
+            delta = rec->stamp[p + 1] - prev;
+            prev = rec->stamp[p + 1];
+
+            b = min(fls64(delta), PHASE_BUCKETS - 1);
+            hist->count[rec->cls][p]++;
+            hist->cycles[rec->cls][p] += delta;
+            hist->bucket[rec->cls][p][b]++;
+        }
+    }
+    put_cpu_ptr(phase_recs);
+}
+
+/**********************************************/
+/**  debugfs                                 **/
+/**********************************************/
+//upper bound in cycles of the bucket holding the given fraction
+static uint64_t phase_percentile(uint32_t *bucket, uint64_t count, int permille)
+{
+    uint64_t want = div64_u64(count * permille + 999, 1000);
+    uint64_t seen = 0;
+    int b;
+
+    for (b = 0; b < PHASE_BUCKETS; b++) {
+        seen += bucket[b];
+        if (seen >= want)
+            return b ? (1ULL << b) - 1 : 0;
+    }
+    return ~0ULL;
+}
+
+static int phase_hist_show(struct seq_file *m, void *v)
+{
+    struct phase_hist *sum;
+    struct phase_hist *hist;
+    int cpu, c, p, b;
+
+    sum = kzalloc(sizeof(*sum), GFP_KERNEL);
+    if (!sum)
+        return -ENOMEM;
+
+    for_each_possible_cpu(cpu) {
+        hist = per_cpu_ptr(phase_hists, cpu);
+        for (c = 0; c < PHASE_CLASS_MAX; c++) {
+            for (p = 0; p < PHASE_MAX; p++) {
+                sum->count[c][p] += READ_ONCE(hist->count[c][p]);
+                sum->cycles[c][p] += READ_ONCE(hist->cycles[c][p]);
+                for (b = 0; b < PHASE_BUCKETS; b++)
+                    sum->bucket[c][p][b] += READ_ONCE(hist->bucket[c][p][b]);
+            }
+        }
+    }
+
+    seq_printf(m, "enabled %d\n", static_key_enabled(&opemu_phase_key));
+    seq_puts(m, "class phase count mean p50 p99\n");
+    for (c = 0; c < PHASE_CLASS_MAX; c++) {
+        for (p = 0; p < PHASE_MAX; p++) {
+            uint64_t count = sum->count[c][p];
+
+            if (!count)
+                continue;
+            seq_printf(m, "%s %s %llu %llu %llu %llu\n", phase_class_names[c], phase_names[p],
+                       (unsigned long long)count,
+                       (unsigned long long)div64_u64(sum->cycles[c][p], count),
+                       (unsigned long long)phase_percentile(sum->bucket[c][p], count, 500),
+                       (unsigned long long)phase_percentile(sum->bucket[c][p], count, 990));
+        }
+    }
+
+    kfree(sum);
+    return 0;
+}
+
+static int phase_hist_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, phase_hist_show, NULL);
+}
+
+static ssize_t phase_hist_write(struct file *file, const char __user *buf, size_t len, loff_t *ppos)
+{
+    int cpu;
+
+    for_each_possible_cpu(cpu)
+        memset(per_cpu_ptr(phase_hists, cpu), 0, sizeof(struct phase_hist));
+    return len;
+}
+
+static const struct file_operations phase_hist_fops = {
+    .owner   = THIS_MODULE,
+    .open    = phase_hist_open,
+    .read    = seq_read,
+    .write   = phase_hist_write,
+    .llseek  = seq_lseek,
+    .release = single_release,
+};
+
+static ssize_t phase_enable_read(struct file *file, char __user *buf, size_t len, loff_t *ppos)
+{
+    char state[2] = { static_key_enabled(&opemu_phase_key) ? '1' : '0', '\n' };
+
+    return simple_read_from_buffer(buf, len, ppos, state, sizeof(state));
+}
+
+static ssize_t phase_enable_write(struct file *file, const char __user *buf, size_t len, loff_t *ppos)
+{
+    bool enable;
+    int cpu, err;
+
+    err = kstrtobool_from_user(buf, len, &enable);
+    if (err)
+        return err;
+
+    mutex_lock(&phase_mutex);
+    if (enable && !static_key_enabled(&opemu_phase_key)) {
+        //records left over from the last enabled period
+        for_each_possible_cpu(cpu)
+            per_cpu_ptr(phase_recs, cpu)->owner = NULL;
+        static_branch_enable(&opemu_phase_key);
+    } else if (!enable && static_key_enabled(&opemu_phase_key)) {
+        static_branch_disable(&opemu_phase_key);
+    }
+    mutex_unlock(&phase_mutex);
+
+    return len;
+}
+
+static const struct file_operations phase_enable_fops = {
+    .owner  = THIS_MODULE,
+    .read   = phase_enable_read,
+    .write  = phase_enable_write,
+    .llseek = default_llseek,
+};
+
+int opemu_phase_init(void)
+{
+    phase_recs = alloc_percpu(struct phase_rec);
+    phase_hists = alloc_percpu(struct phase_hist);
+    if (!phase_recs || !phase_hists) {
+        free_percpu(phase_recs);
+        free_percpu(phase_hists);
+        return -ENOMEM;
+    }
+
+    phase_files[0] = debugfs_create_file("phase_enable", 0600, opemu_debugfs, NULL, &phase_enable_fops);
+    phase_files[1] = debugfs_create_file("phase_hist", 0600, opemu_debugfs, NULL, &phase_hist_fops);
+    return 0;
+}
+
+void opemu_phase_exit(void)
+{
+    debugfs_remove(phase_files[0]);
+    debugfs_remove(phase_files[1]);
+    static_branch_disable(&opemu_phase_key);
+    free_percpu(phase_recs);
+    free_percpu(phase_hists);
+}
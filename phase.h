@@ -0,0 +1,88 @@
+//
+//  phase.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef phase_h
+#define phase_h
+
+//Trap path phases, each stamp marks the end of its phase
+enum opemu_phase {
+    PHASE_ENTRY = 0,    //do_error_trap hook up to opemu_utrap
+    PHASE_FETCH,        //instruction fetch, loop/fused/REX probes
+    PHASE_DECODE,       //prefix and VEX decode in vex_ins
+    PHASE_DISPATCH,     //ISA set dispatch up to operand fetch
+    PHASE_OPERAND,      //get_vexregs
+    PHASE_COMPUTE,      //up to the first _load_xmm/_load_ymm
+    PHASE_WRITEBACK,    //register write-back until vex_ins returns
+    PHASE_RETURN,       //back out of the hook
+    PHASE_MAX
+};
+
+//Opcode class: the emulator or ISA set that handled the trap
+enum opemu_phase_class {
+    PHASE_CLASS_NONE = 0,
+    PHASE_CLASS_LOOP,
+    PHASE_CLASS_FUSE,
+    PHASE_CLASS_REX,
+    PHASE_CLASS_VAES,
+    PHASE_CLASS_AVX,
+    PHASE_CLASS_VGATHER,
+    PHASE_CLASS_FMA,
+    PHASE_CLASS_F16C,
+    PHASE_CLASS_BMI,
+    PHASE_CLASS_VSSE,
+    PHASE_CLASS_VSSE2,
+    PHASE_CLASS_VSSE3,
+    PHASE_CLASS_VSSSE3,
+    PHASE_CLASS_VSSE41,
+    PHASE_CLASS_VSSE42,
+    PHASE_CLASS_MAX
+};
+
+//log2(cycles) buckets
+#define PHASE_BUCKETS 24
+
+#ifdef __KERNEL__
+
+#include <linux/jump_label.h>
+
+DECLARE_STATIC_KEY_FALSE(opemu_phase_key);
+
+void __opemu_phase_begin(void);
+void __opemu_phase_end(int handled);
+void __opemu_phase_stamp(int phase, int first);
+void __opemu_phase_class(int cls);
+
+/*** A disabled key leaves a single nop at each site ***/
+#define opemu_phase_begin() \
+    do { if (static_branch_unlikely(&opemu_phase_key)) __opemu_phase_begin(); } while (0)
+#define opemu_phase_end(handled) \
+    do { if (static_branch_unlikely(&opemu_phase_key)) __opemu_phase_end(handled); } while (0)
+//stamp the end of a phase and drop later stamps, the latest call wins
+#define opemu_phase_stamp(phase) \
+    do { if (static_branch_unlikely(&opemu_phase_key)) __opemu_phase_stamp(phase, 0); } while (0)
+//stamp the end of a phase, the earliest call wins
+#define opemu_phase_first(phase) \
+    do { if (static_branch_unlikely(&opemu_phase_key)) __opemu_phase_stamp(phase, 1); } while (0)
+#define opemu_phase_class(cls) \
+    do { if (static_branch_unlikely(&opemu_phase_key)) __opemu_phase_class(cls); } while (0)
+
+int opemu_phase_init(void);
+void opemu_phase_exit(void);
+
+#else
+
+//userspace stub: no phase timing
+#define opemu_phase_begin()         do { } while (0)
+#define opemu_phase_end(handled)    do { } while (0)
+#define opemu_phase_stamp(phase)    do { } while (0)
+#define opemu_phase_first(phase)    do { } while (0)
+#define opemu_phase_class(cls)      do { } while (0)
+
+#endif
+
+#endif /* phase_h */
@@ -0,0 +1,436 @@
+//
+//  pin.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/debugfs.h>
+#include <linux/highmem.h>
+#include <linux/jiffies.h>
+#include <linux/mm.h>
+#include <linux/mmu_notifier.h>
+#include <linux/module.h>
+#include <linux/percpu.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/version.h>
+#include <linux/workqueue.h>
+
+#include "optrap.h"
+#include "pin.h"
+#include "opdev.h"
+
+/*********************************************************
+ *** Pinned user-page cache.                           ***
+ *** A task trapping in a loop touches the same data   ***
+ *** pages over and over. Its first PIN_ENTRIES pages  ***
+ *** are pinned for read (FOLL_PIN, no COW break) and  ***
+ *** kmap'd, and memory operand reads inside them are  ***
+ *** served through the kernel mapping. Stores always  ***
+ *** go to the user address. An mmu_notifier on the mm ***
+ *** bumps a sequence count on every invalidation; it  ***
+ *** is checked again once the handlers are done, and  ***
+ *** a count that moved drops the whole cache. Caches  ***
+ *** idle for PIN_IDLE_MS are released by a worker.    ***
+ *** Only the owning task, inside its own trap, uses   ***
+ *** or evicts entries, so a kernel address handed to  ***
+ *** the handlers stays valid until the trap ends.     ***
+ *********************************************************/
+
+DEFINE_STATIC_KEY_FALSE(opemu_pin_key);
+
+static bool pin_cache;
+module_param(pin_cache, bool, 0444);
+MODULE_PARM_DESC(pin_cache, "Serve repeated memory operands from pinned user pages");
+
+#if defined(CONFIG_MMU_NOTIFIER) && (LINUX_VERSION_CODE >= KERNEL_VERSION(5,6,0))
+
+struct pin_notifier {
+    struct mmu_notifier mn;
+    atomic_t seq;           //bumped on every invalidation of the mm
+};
+
+struct pin_entry {
+    unsigned long uaddr;    //page aligned
+    struct page *page;
+    uint8_t *kaddr;
+};
+
+struct pin_cache {
+    struct task_struct *task;   //NULL: free slot
+    struct mm_struct *mm;
+    struct pin_notifier *pn;
+    int seq;
+    int active;             //inside a trap or being released
+    int cpu;                //where the trap began
+    unsigned long last;     //jiffies at the end of the last trap
+    int served;             //a pinned page was used in this trap
+    int n;
+    int next;               //round robin victim
+    int nretired;
+    struct pin_entry e[PIN_ENTRIES];
+    //evicted during this trap, the instruction may still use them
+    struct pin_entry retired[PIN_ENTRIES];
+};
+
+//cache of the task trapping on this CPU, for pin_addr deep in the decoder
+struct pin_pending {
+    struct task_struct *owner;
+    struct pin_cache *pc;
+};
+
+struct pin_stat {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t bypass;        //crosses a page or not pinnable
+    uint64_t flushes;       //invalidations seen
+    uint64_t raced;         //invalidation while the handlers used a pinned page
+};
+
+static struct pin_cache pin_caches[PIN_TASKS];
+static DEFINE_SPINLOCK(pin_lock);
+static DEFINE_PER_CPU(struct pin_pending, pin_pending);
+static DEFINE_PER_CPU(struct pin_stat, pin_stats);
+static struct delayed_work pin_work;
+static struct dentry *pin_file;
+
+static int pin_invalidate_range_start(struct mmu_notifier *mn, const struct mmu_notifier_range *range)
+{
+    atomic_inc(&container_of(mn, struct pin_notifier, mn)->seq);
+    return 0;
+}
+
+static void pin_release(struct mmu_notifier *mn, struct mm_struct *mm)
+{
+    atomic_inc(&container_of(mn, struct pin_notifier, mn)->seq);
+}
+
+static struct mmu_notifier *pin_alloc_notifier(struct mm_struct *mm)
+{
+    struct pin_notifier *pn = kzalloc(sizeof(*pn), GFP_KERNEL);
+
+    if (!pn)
+        return ERR_PTR(-ENOMEM);
+    return &pn->mn;
+}
+
+static void pin_free_notifier(struct mmu_notifier *mn)
+{
+    kfree(container_of(mn, struct pin_notifier, mn));
+}
+
+static const struct mmu_notifier_ops pin_mn_ops = {
+    .invalidate_range_start = pin_invalidate_range_start,
+    .release                = pin_release,
+    .alloc_notifier         = pin_alloc_notifier,
+    .free_notifier          = pin_free_notifier,
+};
+
+//pinned for read, nothing to dirty
+static void pin_put(struct pin_entry *e)
+{
+    kunmap(e->page);
+    unpin_user_page(e->page);
+}
+
+static void pin_drop(struct pin_cache *pc)
+{
+    int i;
+
+    for (i = 0; i < pc->n; i++)
+        pin_put(&pc->e[i]);
+    for (i = 0; i < pc->nretired; i++)
+        pin_put(&pc->retired[i]);
+    pc->n = 0;
+    pc->next = 0;
+    pc->nretired = 0;
+}
+
+//slot claimed by the caller (active), nobody else touches it
+static void pin_free(struct pin_cache *pc)
+{
+    pin_drop(pc);
+    if (pc->pn)
+        mmu_notifier_put(&pc->pn->mn);
+    pc->pn = NULL;
+
+    spin_lock(&pin_lock);
+    pc->task = NULL;
+    pc->mm = NULL;
+    pc->active = 0;
+    spin_unlock(&pin_lock);
+}
+
+struct pin_cache *__opemu_pin_begin(struct pt_regs *regs)
+{
+    struct pin_cache *pc = NULL, *free = NULL;
+    struct mmu_notifier *mn;
+    struct pin_pending *pp;
+    int i, seq;
+
+    if (!is_saved_state64(regs) || !current->mm)
+        return NULL;
+
+    spin_lock(&pin_lock);
+    for (i = 0; i < PIN_TASKS; i++) {
+        if ((pin_caches[i].task == current) && (pin_caches[i].mm == current->mm)) {
+            pc = &pin_caches[i];
+            break;
+        }
+        if (!free && !pin_caches[i].task)
+            free = &pin_caches[i];
+    }
+    if (!pc && free) {
+        pc = free;
+        pc->task = current;
+        pc->mm = current->mm;
+        pc->pn = NULL;
+    }
+    if (pc)
+        pc->active = 1;
+    spin_unlock(&pin_lock);
+
+    if (!pc)
+        return NULL;
+
+    if (!pc->pn) {
+        mn = mmu_notifier_get(&pin_mn_ops, current->mm);
+        if (IS_ERR(mn)) {
+            pin_free(pc);
+            return NULL;
+        }
+        pc->pn = container_of(mn, struct pin_notifier, mn);
+        pc->seq = atomic_read(&pc->pn->seq);
+        schedule_delayed_work(&pin_work, msecs_to_jiffies(PIN_IDLE_MS));
+    }
+
+    seq = atomic_read(&pc->pn->seq);
+    if (seq != pc->seq) {
+        pin_drop(pc);
+        pc->seq = seq;
+        this_cpu_inc(pin_stats.flushes);
+    }
+    pc->served = 0;
+
+    pp = get_cpu_ptr(&pin_pending);
+    pc->cpu = smp_processor_id();
+    pp->pc = pc;
+    WRITE_ONCE(pp->owner, current);
+    put_cpu_ptr(&pin_pending);
+
+    return pc;
+}
+
+void __opemu_pin_end(struct pin_cache *pc)
+{
+    struct pin_pending *pp = per_cpu_ptr(&pin_pending, pc->cpu);
+    int i, seq;
+
+    cmpxchg(&pp->owner, current, NULL);
+
+    //after the reads: a page invalidated under them must not be served again
+    smp_rmb();
+    seq = atomic_read(&pc->pn->seq);
+    if (seq != pc->seq) {
+        if (pc->served)
+            this_cpu_inc(pin_stats.raced);
+        pin_drop(pc);
+        pc->seq = seq;
+        this_cpu_inc(pin_stats.flushes);
+    }
+
+    for (i = 0; i < pc->nretired; i++)
+        pin_put(&pc->retired[i]);
+    pc->nretired = 0;
+
+    spin_lock(&pin_lock);
+    pc->last = jiffies;
+    pc->active = 0;
+    spin_unlock(&pin_lock);
+}
+
+uint64_t __opemu_pin_addr(uint64_t addr)
+{
+    unsigned long uaddr = addr & PAGE_MASK;
+    unsigned long off = addr & ~PAGE_MASK;
+    struct pin_cache *pc = NULL;
+    struct pin_pending *pp;
+    struct pin_entry *e;
+    struct page *page;
+    int i;
+
+    pp = get_cpu_ptr(&pin_pending);
+    if (READ_ONCE(pp->owner) == current)
+        pc = pp->pc;
+    put_cpu_ptr(&pin_pending);
+    if (!pc)
+        return addr;
+
+    //the widest operand must stay inside the page
+    if ((addr >= TASK_SIZE_MAX) || (off > PAGE_SIZE - PIN_ACCESS) || (atomic_read(&pc->pn->seq) != pc->seq)) {
+        this_cpu_inc(pin_stats.bypass);
+        return addr;
+    }
+
+    for (i = 0; i < pc->n; i++) {
+        if (pc->e[i].uaddr == uaddr) {
+            this_cpu_inc(pin_stats.hits);
+            pc->served = 1;
+            return (uint64_t)(pc->e[i].kaddr + off);
+        }
+    }
+
+    //read pin: the kernel mapping is only read, a private page keeps its COW state
+    this_cpu_inc(pin_stats.misses);
+    if ((pc->nretired == PIN_ENTRIES) || (pin_user_pages_fast(uaddr, 1, 0, &page) != 1)) {
+        this_cpu_inc(pin_stats.bypass);
+        return addr;
+    }
+
+    if (pc->n == PIN_ENTRIES) {
+        e = &pc->e[pc->next];
+        pc->retired[pc->nretired++] = *e;
+        pc->next = (pc->next + 1) % PIN_ENTRIES;
+    } else {
+        e = &pc->e[pc->n++];
+    }
+    e->uaddr = uaddr;
+    e->page = page;
+    e->kaddr = kmap(page);
+    pc->served = 1;
+
+    return (uint64_t)(e->kaddr + off);
+}
+
+//release caches of tasks that stopped trapping
+static void pin_sweep(struct work_struct *work)
+{
+    struct pin_cache *pc;
+    int i, busy = 0;
+
+    for (i = 0; i < PIN_TASKS; i++) {
+        pc = &pin_caches[i];
+
+        spin_lock(&pin_lock);
+        if (!pc->task || pc->active) {
+            busy += (pc->task != NULL);
+            spin_unlock(&pin_lock);
+            continue;
+        }
+        if (time_before(jiffies, pc->last + msecs_to_jiffies(PIN_IDLE_MS))) {
+            busy++;
+            spin_unlock(&pin_lock);
+            continue;
+        }
+        pc->active = 1;
+        spin_unlock(&pin_lock);
+
+        pin_free(pc);
+    }
+
+    if (busy)
+        schedule_delayed_work(&pin_work, msecs_to_jiffies(PIN_IDLE_MS));
+}
+
+/**********************************************/
+/**  debugfs                                 **/
+/**********************************************/
+static int pin_stat_show(struct seq_file *m, void *v)
+{
+    struct pin_stat sum = { 0 };
+    struct pin_stat *st;
+    int cpu, i, tasks = 0, pages = 0;
+
+    for_each_possible_cpu(cpu) {
+        st = per_cpu_ptr(&pin_stats, cpu);
+        sum.hits += st->hits;
+        sum.misses += st->misses;
+        sum.bypass += st->bypass;
+        sum.flushes += st->flushes;
+        sum.raced += st->raced;
+    }
+
+    spin_lock(&pin_lock);
+    for (i = 0; i < PIN_TASKS; i++) {
+        if (pin_caches[i].task) {
+            tasks++;
+            pages += READ_ONCE(pin_caches[i].n);
+        }
+    }
+    spin_unlock(&pin_lock);
+
+    seq_printf(m, "tasks %d\npages %d\nhits %llu\nmisses %llu\nbypass %llu\nflushes %llu\nraced %llu\n",
+               tasks, pages, (unsigned long long)sum.hits, (unsigned long long)sum.misses,
+               (unsigned long long)sum.bypass, (unsigned long long)sum.flushes,
+               (unsigned long long)sum.raced);
+    return 0;
+}
+
+static int pin_stat_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, pin_stat_show, NULL);
+}
+
+static const struct file_operations pin_stat_fops = {
+    .owner   = THIS_MODULE,
+    .open    = pin_stat_open,
+    .read    = seq_read,
+    .llseek  = seq_lseek,
+    .release = single_release,
+};
+
+int opemu_pin_init(void)
+{
+    INIT_DELAYED_WORK(&pin_work, pin_sweep);
+    pin_file = debugfs_create_file("pin_stat", 0400, opemu_debugfs, NULL, &pin_stat_fops);
+    if (pin_cache)
+        static_branch_enable(&opemu_pin_key);
+    return 0;
+}
+
+//after the hooks are gone: no trap holds a cache
+void opemu_pin_exit(void)
+{
+    int i;
+
+    static_branch_disable(&opemu_pin_key);
+    debugfs_remove(pin_file);
+    cancel_delayed_work_sync(&pin_work);
+    for (i = 0; i < PIN_TASKS; i++) {
+        if (pin_caches[i].task)
+            pin_free(&pin_caches[i]);
+    }
+    mmu_notifier_synchronize();
+}
+
+#else
+
+//no mmu_notifier_get: operands always go to user memory
+struct pin_cache *__opemu_pin_begin(struct pt_regs *regs)
+{
+    return NULL;
+}
+
+void __opemu_pin_end(struct pin_cache *pc)
+{
+}
+
+uint64_t __opemu_pin_addr(uint64_t addr)
+{
+    return addr;
+}
+
+int opemu_pin_init(void)
+{
+    return 0;
+}
+
+void opemu_pin_exit(void)
+{
+}
+
+#endif
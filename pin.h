@@ -0,0 +1,49 @@
+//
+//  pin.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef pin_h
+#define pin_h
+
+#define PIN_ENTRIES 16      //pinned pages per task
+#define PIN_TASKS   64      //tasks with a cache
+#define PIN_ACCESS  32      //widest memory operand, a YMM
+#define PIN_IDLE_MS 20      //a cache without traps this long is released
+
+#ifdef __KERNEL__
+
+#include <linux/jump_label.h>
+
+struct pt_regs;
+struct pin_cache;
+
+DECLARE_STATIC_KEY_FALSE(opemu_pin_key);
+
+struct pin_cache *__opemu_pin_begin(struct pt_regs *regs);
+void __opemu_pin_end(struct pin_cache *pc);
+uint64_t __opemu_pin_addr(uint64_t addr);
+
+//returns the task's cache for this trap, NULL while caching is off
+#define opemu_pin_begin(regs) \
+    (static_branch_unlikely(&opemu_pin_key) ? __opemu_pin_begin(regs) : NULL)
+#define opemu_pin_end(pc) \
+    do { if (pc) __opemu_pin_end(pc); } while (0)
+//user memory operand to its pinned kernel mapping, or unchanged
+#define opemu_pin_addr(addr) \
+    (static_branch_unlikely(&opemu_pin_key) ? __opemu_pin_addr(addr) : (addr))
+
+int opemu_pin_init(void);
+void opemu_pin_exit(void);
+
+#else
+
+//userspace stub: memory is our own
+#define opemu_pin_addr(addr)    (addr)
+
+#endif
+
+#endif /* pin_h */
@@ -0,0 +1,323 @@
+//
+//  pressure.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/eventfd.h>
+#include <linux/hash.h>
+#include <linux/hashtable.h>
+#include <linux/ktime.h>
+#include <linux/percpu.h>
+#include <linux/proc_fs.h>
+#include <linux/rculist.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/uaccess.h>
+#include <linux/version.h>
+#include <linux/workqueue.h>
+
+#include "pressure.h"
+
+/*********************************************************
+ *** Emulation pressure.                               ***
+ *** Per-process, per-CPU counters fed from the trap   ***
+ *** path without a lock. A delayed work closes each   ***
+ *** window: the instruction rate and the fraction of  ***
+ *** time spent emulating are checked against the      ***
+ *** process' thresholds; every crossing (either       ***
+ *** direction) signals its eventfd, so a process that ***
+ *** stops trapping still sees pressure fall. Upcall   ***
+ *** traps are emulated in user mode and carry no time ***
+ *** of their own: they are charged the mean cost of   ***
+ *** the timed traps. The same numbers are listed in   ***
+ *** /proc/opemu_pressure.                             ***
+ *********************************************************/
+
+struct pressure_acc {
+    uint64_t count;
+    uint64_t timed;     //of count, traps with a measured time
+    uint64_t ns;
+};
+
+struct pressure_proc {
+    struct hlist_node node;
+    struct rcu_head rcu;
+    struct mm_struct *mm;
+    pid_t tgid;
+    struct pressure_acc __percpu *acc;
+    //below under pressure_lock
+    struct file *owner;
+    struct eventfd_ctx *eventfd;
+    uint64_t window_ns;
+    uint64_t max_ips;
+    uint32_t max_permille;
+    struct delayed_work work;
+    //current window
+    uint64_t start;
+    struct pressure_acc last;
+    uint64_t mean_ns;
+    //last window
+    struct opemu_pressure_stat stat;
+};
+
+//keyed by mm, looked up under RCU on every trap
+static DEFINE_HASHTABLE(pressure_hash, PRESSURE_BITS);
+static int pressure_count;
+static DEFINE_SPINLOCK(pressure_lock);
+
+static struct pressure_proc *pressure_find(void)
+{
+    struct pressure_proc *pp;
+
+    hash_for_each_possible_rcu(pressure_hash, pp, node, hash_ptr(current->mm, PRESSURE_BITS)) {
+        if ((pp->mm == current->mm) && (pp->tgid == current->tgid))
+            return pp;
+    }
+    return NULL;
+}
+
+static void pressure_signal(struct eventfd_ctx *ctx)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6,8,0)
+    eventfd_signal(ctx);
+#else
+    eventfd_signal(ctx, 1);
+#endif
+}
+
+static void pressure_window(struct work_struct *work)
+{
+    struct pressure_proc *pp = container_of(to_delayed_work(work), struct pressure_proc, work);
+    struct pressure_acc sum = { 0 };
+    struct pressure_acc *acc;
+    uint64_t now, elapsed, count, timed, ns;
+    uint32_t pressure;
+    int cpu;
+
+    for_each_possible_cpu(cpu) {
+        acc = per_cpu_ptr(pp->acc, cpu);
+        sum.count += READ_ONCE(acc->count);
+        sum.timed += READ_ONCE(acc->timed);
+        sum.ns += READ_ONCE(acc->ns);
+    }
+    now = ktime_get_ns();
+
+    spin_lock(&pressure_lock);
+    elapsed = max_t(uint64_t, now - pp->start, 1);
+    count = sum.count - pp->last.count;
+    timed = sum.timed - pp->last.timed;
+    ns = sum.ns - pp->last.ns;
+
+    //untimed (upcall) traps at the mean cost of this window's timed ones, or the last known
+    if (timed)
+        pp->mean_ns = div64_u64(ns, timed);
+    ns += pp->mean_ns * (count - timed);
+
+    pp->stat.ips = div64_u64(count * NSEC_PER_SEC, elapsed);
+    pp->stat.permille = (uint32_t)div64_u64(ns * 1000, elapsed);
+    pp->stat.total = sum.count;
+
+    pressure = 0;
+    if (pp->max_ips && (pp->stat.ips > pp->max_ips))
+        pressure = 1;
+    if (pp->max_permille && (pp->stat.permille > pp->max_permille))
+        pressure = 1;
+
+    if (pressure != pp->stat.pressure) {
+        pp->stat.pressure = pressure;
+        pp->stat.events++;
+        if (pp->eventfd)
+            pressure_signal(pp->eventfd);
+    }
+
+    pp->start = now;
+    pp->last = sum;
+    schedule_delayed_work(&pp->work, nsecs_to_jiffies(pp->window_ns));
+    spin_unlock(&pressure_lock);
+}
+
+static void pressure_free(struct rcu_head *rcu)
+{
+    struct pressure_proc *pp = container_of(rcu, struct pressure_proc, rcu);
+
+    free_percpu(pp->acc);
+    kfree(pp);
+}
+
+int opemu_pressure_set(struct file *file, void __user *argp)
+{
+    struct opemu_pressure_req req;
+    struct pressure_proc *pp, *new;
+    struct eventfd_ctx *ctx = NULL;
+    struct eventfd_ctx *old = NULL;
+
+    if (copy_from_user(&req, argp, sizeof(req)))
+        return -EFAULT;
+    if (req.eventfd >= 0) {
+        ctx = eventfd_ctx_fdget(req.eventfd);
+        if (IS_ERR(ctx))
+            return PTR_ERR(ctx);
+    }
+
+    new = kzalloc(sizeof(*new), GFP_KERNEL);
+    if (new)
+        new->acc = alloc_percpu(struct pressure_acc);
+    if (!new || !new->acc) {
+        kfree(new);
+        if (ctx)
+            eventfd_ctx_put(ctx);
+        return -ENOMEM;
+    }
+
+    spin_lock(&pressure_lock);
+    pp = pressure_find();
+    if (!pp) {
+        if (pressure_count >= PRESSURE_MAX_PROCS) {
+            spin_unlock(&pressure_lock);
+            if (ctx)
+                eventfd_ctx_put(ctx);
+            pressure_free(&new->rcu);
+            return -ENOSPC;
+        }
+        pp = new;
+        new = NULL;
+        pp->mm = current->mm;
+        pp->tgid = current->tgid;
+        pp->start = ktime_get_ns();
+        INIT_DELAYED_WORK(&pp->work, pressure_window);
+        hash_add_rcu(pressure_hash, &pp->node, hash_ptr(pp->mm, PRESSURE_BITS));
+        WRITE_ONCE(pressure_count, pressure_count + 1);
+    }
+
+    old = pp->eventfd;
+    pp->owner = file;
+    pp->eventfd = ctx;
+    pp->window_ns = (uint64_t)(req.window_ms ? req.window_ms : PRESSURE_WINDOW_MS) * NSEC_PER_MSEC;
+    pp->max_ips = req.max_ips;
+    pp->max_permille = req.max_permille;
+    pp->stat.pressure = 0;
+    mod_delayed_work(system_wq, &pp->work, nsecs_to_jiffies(pp->window_ns));
+    spin_unlock(&pressure_lock);
+
+    if (new)
+        pressure_free(&new->rcu);
+    if (old)
+        eventfd_ctx_put(old);
+    return 0;
+}
+
+int opemu_pressure_get(struct file *file, void __user *argp)
+{
+    struct opemu_pressure_stat stat;
+    struct pressure_proc *pp;
+
+    spin_lock(&pressure_lock);
+    pp = pressure_find();
+    if (pp)
+        stat = pp->stat;
+    spin_unlock(&pressure_lock);
+
+    if (!pp)
+        return -ENOENT;
+    if (copy_to_user(argp, &stat, sizeof(stat)))
+        return -EFAULT;
+    return 0;
+}
+
+void opemu_pressure_release(struct file *file)
+{
+    struct pressure_proc *put[PRESSURE_MAX_PROCS];
+    struct pressure_proc *pp;
+    struct hlist_node *tmp;
+    int n = 0;
+    int bkt, i;
+
+    spin_lock(&pressure_lock);
+    hash_for_each_safe(pressure_hash, bkt, tmp, pp, node) {
+        if (pp->owner == file) {
+            hash_del_rcu(&pp->node);
+            WRITE_ONCE(pressure_count, pressure_count - 1);
+            put[n++] = pp;
+        }
+    }
+    spin_unlock(&pressure_lock);
+
+    for (i = 0; i < n; i++) {
+        cancel_delayed_work_sync(&put[i]->work);
+        if (put[i]->eventfd)
+            eventfd_ctx_put(put[i]->eventfd);
+        call_rcu(&put[i]->rcu, pressure_free);
+    }
+}
+
+int opemu_pressure_active(void)
+{
+    return READ_ONCE(pressure_count) != 0;
+}
+
+/** Called after each handled trap: count instructions emulated in ns, timed is 0 for upcalls. **/
+void opemu_pressure_account(uint64_t count, uint64_t ns, int timed)
+{
+    struct pressure_proc *pp;
+
+    rcu_read_lock();
+    pp = pressure_find();
+    if (pp) {
+        this_cpu_add(pp->acc->count, count);
+        if (timed) {
+            this_cpu_add(pp->acc->timed, count);
+            this_cpu_add(pp->acc->ns, ns);
+        }
+    }
+    rcu_read_unlock();
+}
+
+/**********************************************/
+/**  /proc/opemu_pressure                    **/
+/**********************************************/
+static int pressure_show(struct seq_file *m, void *v)
+{
+    struct pressure_proc *pp;
+    int bkt;
+
+    seq_puts(m, "tgid ips permille pressure events total\n");
+    spin_lock(&pressure_lock);
+    hash_for_each(pressure_hash, bkt, pp, node) {
+        seq_printf(m, "%d %llu %u %u %llu %llu\n", pp->tgid,
+                   (unsigned long long)pp->stat.ips, pp->stat.permille, pp->stat.pressure,
+                   (unsigned long long)pp->stat.events, (unsigned long long)pp->stat.total);
+    }
+    spin_unlock(&pressure_lock);
+    return 0;
+}
+
+static int pressure_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, pressure_show, NULL);
+}
+
+static const struct proc_ops pressure_proc_ops = {
+    .proc_open    = pressure_open,
+    .proc_read    = seq_read,
+    .proc_lseek   = seq_lseek,
+    .proc_release = single_release,
+};
+
+int opemu_pressure_init(void)
+{
+    if (!proc_create("opemu_pressure", 0444, NULL, &pressure_proc_ops))
+        return -ENOMEM;
+    return 0;
+}
+
+//last to go, every /dev/opemu file and stats mapping is closed by now: wait for all RCU frees
+void opemu_pressure_exit(void)
+{
+    remove_proc_entry("opemu_pressure", NULL);
+    rcu_barrier();
+}
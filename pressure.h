@@ -0,0 +1,30 @@
+//
+//  pressure.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef pressure_h
+#define pressure_h
+
+#include <linux/fs.h>
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+
+//Processes watching their emulation pressure
+#define PRESSURE_MAX_PROCS 64
+#define PRESSURE_BITS      6
+#define PRESSURE_WINDOW_MS 100
+
+int opemu_pressure_set(struct file *file, void __user *argp);
+int opemu_pressure_get(struct file *file, void __user *argp);
+void opemu_pressure_release(struct file *file);
+int opemu_pressure_active(void);
+void opemu_pressure_account(uint64_t count, uint64_t ns, int timed);
+int opemu_pressure_init(void);
+void opemu_pressure_exit(void);
+
+#endif /* pressure_h */
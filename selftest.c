@@ -0,0 +1,262 @@
+//
+//  selftest.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#define pr_fmt(fmt) "OPEMU: " fmt
+
+#include <linux/debugfs.h>
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <asm/processor.h>
+
+#include "optrap.h"
+#include "opdev.h"
+#include "exec.h"
+#include "softfloat.h"
+#include "selftest.h"
+#include "selftest_vec.h"
+
+/*********************************************************
+ *** Load-time selftest, selftest=1.                   ***
+ *** Every golden vector from opemu-golden is run      ***
+ *** through the handlers as an OPEMU_IOC_EXEC batch   ***
+ *** of one step: same image in, digest of ymm0, ymm2, ***
+ *** rax, rcx, rdx and the defined flags out. Each is  ***
+ *** run SELFTEST_RUNS times inside kernel_fpu_begin,  ***
+ *** preemption off, and every run must match. Every   ***
+ *** run also checks in full the registers the         ***
+ *** hardware left alone: the batch works on the XMM   ***
+ *** image or the registers as a trap does, so a       ***
+ *** handler temporary landing in one of them shows.   ***
+ *** If a vector fails, the module refuses to load and ***
+ *** the hook is never armed. selftest_known lists the ***
+ *** encodings a backend gets wrong: on that backend   ***
+ *** they fail the load too, on the other they are     ***
+ *** checked like the rest.                            ***
+ *** Cycles per vector are kept in debugfs             ***
+ *** opemu/selftest to compare hosts.                  ***
+ *********************************************************/
+
+static bool selftest;
+module_param(selftest, bool, 0444);
+MODULE_PARM_DESC(selftest, "Check the handlers against the golden vectors before arming the hook");
+
+#define SELFTEST_RUNS   64
+//the memory window as the vectors address it
+#define SELFTEST_BASE   0x100000ULL
+
+struct selftest_result {
+    uint64_t min;
+    uint64_t total;
+    int ok;
+    int clobbered;          //the digest matched, a register the instruction does not name did not
+};
+
+static struct selftest_result *selftest_results;
+static struct selftest_result *selftest_known_results;
+static struct dentry *selftest_file;
+
+static void selftest_state(struct opemu_exec_state *st, const struct selftest_image *im)
+{
+    memset(st, 0, sizeof(*st));
+    memcpy(st->ymm, im->ymm, sizeof(st->ymm));
+    st->regs.ax = im->ax;
+    st->regs.cx = im->cx;
+    st->regs.dx = im->dx;
+    st->regs.si = SELFTEST_BASE + SELFTEST_MEM / 2;
+    st->regs.flags = SELFTEST_FLAGS;
+    st->mxcsr = SELFTEST_MXCSR;
+}
+
+/** 1 when every register the hardware left whole is whole in st. **/
+static int selftest_kept(const struct opemu_exec_state *st, const struct selftest_image *im, uint16_t keep)
+{
+    int n;
+
+    for (n = 0; n < 16; n++) {
+        if (((keep >> n) & 1) && memcmp(st->ymm[n], im->ymm[n], 32))
+            return 0;
+    }
+    return 1;
+}
+
+/** One vector SELFTEST_RUNS times. returns 0 or -errno, r->ok is 1 when every run matched. **/
+static int selftest_run(const struct selftest_vec *v, const struct selftest_image *im,
+                        struct opemu_exec_state *st, uint8_t *win, struct selftest_result *r)
+{
+    //zero tail: the decoders look past the last instruction
+    uint8_t code[SELFTEST_CODE + 16] = { 0 };
+    uint64_t cycles, fault;
+    uint32_t count;
+    int n, err;
+
+    memcpy(code, v->code, v->len);
+    r->min = U64_MAX;
+    r->total = 0;
+    r->ok = 1;
+    r->clobbered = 0;
+
+    for (n = 0; n < SELFTEST_RUNS; n++) {
+        selftest_state(st, im);
+        memcpy(win, im->mem, SELFTEST_MEM);
+        count = 1;
+        err = opemu_exec_batch(st, code, v->len, 1, win, SELFTEST_BASE, SELFTEST_MEM,
+                               &cycles, &count, &fault);
+        if (err == -ENOMEM)
+            return err;
+        //a fault, an unknown opcode or the wrong length is a failure like a wrong result
+        if (err || (count != 1) || (st->regs.ip != v->len) ||
+            (selftest_sum(st->ymm[0], st->ymm[2], v->width, st->regs.ax, st->regs.cx, st->regs.dx,
+                          st->regs.flags & v->flags) != v->sum)) {
+            r->ok = 0;
+            return 0;
+        }
+        if (!selftest_kept(st, im, v->keep)) {
+            r->ok = 0;
+            r->clobbered = 1;
+            return 0;
+        }
+        r->min = min(r->min, cycles);
+        r->total += cycles;
+    }
+    return 0;
+}
+
+/**********************************************/
+/**  debugfs                                 **/
+/**********************************************/
+static void selftest_show_one(struct seq_file *m, const struct selftest_vec *vec, const struct selftest_result *r)
+{
+    char name[64];
+
+    selftest_name(vec->code, vec->len, vec->vex, name, sizeof(name));
+    if (r->ok)
+        seq_printf(m, "%-32s min %llu avg %llu\n", name, (unsigned long long)r->min,
+                   (unsigned long long)(r->total / SELFTEST_RUNS));
+    else
+        seq_printf(m, "%-32s known, differs from hardware\n", name);
+}
+
+static int selftest_show(struct seq_file *m, void *v)
+{
+    size_t i;
+
+    seq_printf(m, "%s\nsoft_fp %d runs %d\n", boot_cpu_data.x86_model_id, opemu_softfp(), SELFTEST_RUNS);
+    for (i = 0; i < ARRAY_SIZE(selftest_vecs); i++)
+        selftest_show_one(m, &selftest_vecs[i], &selftest_results[i]);
+    for (i = 0; i < ARRAY_SIZE(selftest_known); i++)
+        selftest_show_one(m, &selftest_known[i].vec, &selftest_known_results[i]);
+    return 0;
+}
+
+static int selftest_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, selftest_show, NULL);
+}
+
+static const struct file_operations selftest_fops = {
+    .owner   = THIS_MODULE,
+    .open    = selftest_open,
+    .read    = seq_read,
+    .llseek  = seq_lseek,
+    .release = single_release,
+};
+
+static void selftest_report(const struct selftest_vec *v, const struct selftest_result *r)
+{
+    char name[64];
+
+    selftest_name(v->code, v->len, v->vex, name, sizeof(name));
+    if (r->clobbered)
+        pr_err("selftest: %s changes a register it does not name\n", name);
+    else
+        pr_err("selftest: %s differs from the golden vector\n", name);
+}
+
+//after opemu_softfp_init: the vectors run on the backend the traps will use
+int opemu_selftest_init(void)
+{
+    int backend = opemu_softfp() ? SELFTEST_SOFT : SELFTEST_NATIVE;
+    const struct selftest_known *kv;
+    struct selftest_image *im = NULL;
+    struct opemu_exec_state *st = NULL;
+    uint8_t *win = NULL;
+    char name[64];
+    size_t i, checked;
+    int err, failed = 0;
+
+    if (!selftest)
+        return 0;
+
+    err = -ENOMEM;
+    im = kmalloc(sizeof(*im), GFP_KERNEL);
+    st = kmalloc(sizeof(*st), GFP_KERNEL);
+    win = kzalloc(SELFTEST_MEM + EXEC_SLACK, GFP_KERNEL);
+    selftest_results = kcalloc(ARRAY_SIZE(selftest_vecs), sizeof(*selftest_results), GFP_KERNEL);
+    selftest_known_results = kcalloc(ARRAY_SIZE(selftest_known), sizeof(*selftest_known_results), GFP_KERNEL);
+    if (!im || !st || !win || !selftest_results || !selftest_known_results)
+        goto out;
+    selftest_fill(im);
+
+    for (i = 0; i < ARRAY_SIZE(selftest_vecs); i++) {
+        err = selftest_run(&selftest_vecs[i], im, st, win, &selftest_results[i]);
+        if (err)
+            goto out;
+        if (!selftest_results[i].ok) {
+            selftest_report(&selftest_vecs[i], &selftest_results[i]);
+            failed++;
+        }
+        cond_resched();
+    }
+
+    for (i = 0; i < ARRAY_SIZE(selftest_known); i++) {
+        kv = &selftest_known[i];
+        err = selftest_run(&kv->vec, im, st, win, &selftest_known_results[i]);
+        if (err)
+            goto out;
+        //the hook would take it wrong on this backend: fail like any other vector
+        if (!selftest_known_results[i].ok) {
+            selftest_report(&kv->vec, &selftest_known_results[i]);
+            failed++;
+        } else if (kv->backends & backend) {
+            selftest_name(kv->vec.code, kv->vec.len, kv->vec.vex, name, sizeof(name));
+            pr_info("selftest: %s matches the hardware now, regenerate selftest_vec.h\n", name);
+        }
+        cond_resched();
+    }
+
+    checked = ARRAY_SIZE(selftest_vecs) + ARRAY_SIZE(selftest_known);
+    if (failed) {
+        pr_err("selftest: %d of %zu vectors failed, not arming the hook\n", failed, checked);
+        err = -EINVAL;
+        goto out;
+    }
+    pr_info("selftest: %zu vectors passed\n", checked);
+    selftest_file = debugfs_create_file("selftest", 0400, opemu_debugfs, NULL, &selftest_fops);
+
+out:
+    if (err) {
+        kfree(selftest_known_results);
+        selftest_known_results = NULL;
+        kfree(selftest_results);
+        selftest_results = NULL;
+    }
+    kfree(win);
+    kfree(st);
+    kfree(im);
+    return err;
+}
+
+void opemu_selftest_exit(void)
+{
+    debugfs_remove(selftest_file);
+    kfree(selftest_known_results);
+    kfree(selftest_results);
+}
@@ -0,0 +1,129 @@
+//
+//  selftest.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef selftest_h
+#define selftest_h
+
+#define SELFTEST_CODE   8       //instruction bytes per vector
+#define SELFTEST_MEM    512     //VSIB window, rsi at its middle
+#define SELFTEST_MXCSR  0x1F80
+#define SELFTEST_FLAGS  0x202   //EFLAGS before every step
+
+/** One golden vector: the instruction and the digest of what it leaves. **/
+struct selftest_vec {
+    uint8_t code[SELFTEST_CODE];
+    uint8_t len;
+    uint8_t vex;            //1 vex_ins, 0 rex_ins
+    uint8_t width;          //bytes of ymm0 and ymm2 compared, 16 or 32
+    uint16_t flags;         //EFLAGS bits compared, the defined ones
+    uint16_t keep;          //ymm registers the hardware left whole, compared in full
+    uint64_t sum;
+};
+
+#define SELFTEST_NATIVE 1
+#define SELFTEST_SOFT   2
+
+/** An encoding a backend gets wrong, with the hardware's digest. **/
+struct selftest_known {
+    struct selftest_vec vec;
+    uint8_t backends;       //SELFTEST_NATIVE, SELFTEST_SOFT: the ones that differ
+};
+
+/** Register image every vector starts from. **/
+struct selftest_image {
+    uint8_t ymm[16][32];
+    uint64_t ax, cx, dx;
+    uint8_t mem[SELFTEST_MEM];
+};
+
+static inline uint64_t selftest_rand(uint64_t *x)
+{
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return *x;
+}
+
+//finite normal lanes read as fp32 or fp64 (exponent 0x78-0x87), ymm3 holds
+//small signed qwords for the VSIB index, dx a bextr/bzhi/shift control
+static inline void selftest_fill(struct selftest_image *im)
+{
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    uint32_t v;
+    int n, k;
+
+    for (n = 0; n < 16; n++) {
+        for (k = 0; k < 32; k += 4) {
+            v = (uint32_t)selftest_rand(&x);
+            v = (v & 0x807FFFFF) | ((0x78 + (v >> 23) % 16) << 23);
+            memcpy(&im->ymm[n][k], &v, 4);
+        }
+    }
+    for (k = 0; k < 32; k += 8) {
+        int64_t idx = (int64_t)(selftest_rand(&x) % 32) - 16;
+
+        memcpy(&im->ymm[3][k], &idx, 8);
+    }
+    for (k = 0; k < SELFTEST_MEM; k += 8) {
+        uint64_t m = selftest_rand(&x);
+
+        memcpy(&im->mem[k], &m, 8);
+    }
+    im->ax = selftest_rand(&x);
+    im->cx = selftest_rand(&x);
+    im->dx = (selftest_rand(&x) & ~0xFFFFULL) | 0x1105;
+}
+
+//FNV-1a over ymm0, ymm2, rax, rcx, rdx and the compared EFLAGS bits
+static inline uint64_t selftest_sum(const uint8_t *y0, const uint8_t *y2, int width,
+                                    uint64_t ax, uint64_t cx, uint64_t dx, uint64_t flags)
+{
+    uint64_t g[4] = { ax, cx, dx, flags };
+    uint64_t h = 0xCBF29CE484222325ULL;
+    const uint8_t *p;
+    int i;
+
+    for (i = 0; i < width; i++)
+        h = (h ^ y0[i]) * 0x100000001B3ULL;
+    for (i = 0; i < width; i++)
+        h = (h ^ y2[i]) * 0x100000001B3ULL;
+    p = (const uint8_t *)g;
+    for (i = 0; i < (int)sizeof(g); i++)
+        h = (h ^ p[i]) * 0x100000001B3ULL;
+    return h;
+}
+
+//VEX.256.66.0F38.W0 58, 66.0F3A 0F ib=1B
+static inline void selftest_name(const uint8_t *b, int len, int vex, char *buf, size_t size)
+{
+    static const char *pps[4] = { "NP", "66", "F3", "F2" };
+    static const char *maps[4] = { "", "0F", "0F38", "0F3A" };
+    int n, off;
+
+    if (vex) {
+        off = snprintf(buf, size, "VEX.%s.%s.%s.W%d %02X", (b[2] & 4) ? "256" : "128",
+                       pps[b[2] & 3], maps[b[1] & 3], b[2] >> 7, b[3]);
+        if ((b[1] & 3) == 3)
+            snprintf(buf + off, size - off, " ib=%02X", b[len - 1]);
+    } else {
+        n = (b[0] == 0x0F) ? 0 : 1;
+        off = snprintf(buf, size, "%s.%s %02X", n ? ((b[0] == 0x66) ? "66" : (b[0] == 0xF3) ? "F3" : "F2") : "NP",
+                       (b[n + 1] == 0x38) ? "0F38" : "0F3A", b[n + 2]);
+        if (b[n + 1] == 0x3A)
+            snprintf(buf + off, size - off, " ib=%02X", b[len - 1]);
+    }
+}
+
+#ifdef __KERNEL__
+
+int opemu_selftest_init(void);
+void opemu_selftest_exit(void);
+
+#endif
+
+#endif /* selftest_h */
@@ -0,0 +1,1051 @@
+//
+//  selftest_vec.h
+//  opemu
+//
+//  Generated by opemu-golden on Intel(R) Xeon(R) Processor.
+//  Regenerate with make golden && ./opemu-golden > selftest_vec.h
+
+#ifndef selftest_vec_h
+#define selftest_vec_h
+
+static const struct selftest_vec selftest_vecs[] = {
+    { { 0xC4, 0xE1, 0x6A, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xECA4B47AF4D28C4AULL },
+    { { 0xC4, 0xE1, 0xEE, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xECA4B47AF4D28C4AULL },
+    { { 0xC4, 0xE1, 0x6B, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x545CD6A1B97F3915ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x545CD6A1B97F3915ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA86F1DE714751F9AULL },
+    { { 0xC4, 0xE1, 0xEF, 0x10, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA86F1DE714751F9AULL },
+    { { 0xC4, 0xE1, 0x6A, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFD, 0x7B52C443E7BD9A3AULL },
+    { { 0xC4, 0xE1, 0xEA, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFD, 0x7B52C443E7BD9A3AULL },
+    { { 0xC4, 0xE1, 0x6E, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFD, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xEE, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFD, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6B, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFD, 0x7B52C443E7BD9A3AULL },
+    { { 0xC4, 0xE1, 0xEB, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFD, 0x7B52C443E7BD9A3AULL },
+    { { 0xC4, 0xE1, 0x6F, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFD, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xEF, 0x11, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFD, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x68, 0x12, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4461AA05791E27E9ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x12, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4461AA05791E27E9ULL },
+    { { 0xC4, 0xE1, 0x68, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6CD087BBE9897649ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6CD087BBE9897649ULL },
+    { { 0xC4, 0xE1, 0x6C, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8BA1AED375DEBCC8ULL },
+    { { 0xC4, 0xE1, 0xEC, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8BA1AED375DEBCC8ULL },
+    { { 0xC4, 0xE1, 0x69, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBDDC191339AD9AE0ULL },
+    { { 0xC4, 0xE1, 0xED, 0x14, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBDDC191339AD9AE0ULL },
+    { { 0xC4, 0xE1, 0x68, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x27CA80821C38C839ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x27CA80821C38C839ULL },
+    { { 0xC4, 0xE1, 0x6C, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x898F1E125C5BC9E5ULL },
+    { { 0xC4, 0xE1, 0xEC, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x898F1E125C5BC9E5ULL },
+    { { 0xC4, 0xE1, 0x69, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x94AAB80D33461CF1ULL },
+    { { 0xC4, 0xE1, 0xED, 0x15, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x94AAB80D33461CF1ULL },
+    { { 0xC4, 0xE1, 0x68, 0x16, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x16, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0x6A, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD1D6B9C4466CE591ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x5AFD7D64E120F4F8ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x732CBD6DD282DC76ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x26AED3264172623BULL },
+    { { 0xC4, 0xE1, 0x6B, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB1498DF6557AD6A8ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF93C3DFAF570F9D2ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA91D2D7BDF0E584BULL },
+    { { 0xC4, 0xE1, 0xEF, 0x2A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xDB91B170B83DD77DULL },
+    { { 0xC4, 0xE1, 0x6C, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xEC, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6D, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xED, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6C, 0x4A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xEC, 0x4A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6D, 0x4A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xED, 0x4A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6C, 0x4B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0xEC, 0x4B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6D, 0x4B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFF, 0x5D540FBE8FF2B98FULL },
+    { { 0xC4, 0xE1, 0x6A, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA41A38F2DD25C773ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA41A38F2DD25C773ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9B083E18B6FDB1E0ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9B083E18B6FDB1E0ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xBCD454D9491DAFFBULL },
+    { { 0xC4, 0xE1, 0xEB, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xBCD454D9491DAFFBULL },
+    { { 0xC4, 0xE1, 0x6F, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF9921A5486E404C8ULL },
+    { { 0xC4, 0xE1, 0xEF, 0x51, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF9921A5486E404C8ULL },
+    { { 0xC4, 0xE1, 0x6A, 0x52, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA41A38F2DD25C773ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x52, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA41A38F2DD25C773ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x52, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9B083E18B6FDB1E0ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x52, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9B083E18B6FDB1E0ULL },
+    { { 0xC4, 0xE1, 0x6A, 0x53, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC1A9C46F3F8FB74CULL },
+    { { 0xC4, 0xE1, 0xEA, 0x53, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC1A9C46F3F8FB74CULL },
+    { { 0xC4, 0xE1, 0x6E, 0x53, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xABF61AE6EFC0C6BFULL },
+    { { 0xC4, 0xE1, 0xEE, 0x53, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xABF61AE6EFC0C6BFULL },
+    { { 0xC4, 0xE1, 0x68, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x085A07082D5087A8ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x085A07082D5087A8ULL },
+    { { 0xC4, 0xE1, 0x6C, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5BE47D0E405D0F6BULL },
+    { { 0xC4, 0xE1, 0xEC, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5BE47D0E405D0F6BULL },
+    { { 0xC4, 0xE1, 0x69, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x085A07082D5087A8ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x085A07082D5087A8ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5BE47D0E405D0F6BULL },
+    { { 0xC4, 0xE1, 0xED, 0x54, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5BE47D0E405D0F6BULL },
+    { { 0xC4, 0xE1, 0x68, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE6392C254306A34CULL },
+    { { 0xC4, 0xE1, 0xE8, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE6392C254306A34CULL },
+    { { 0xC4, 0xE1, 0x6C, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF092F9A3C487AEA1ULL },
+    { { 0xC4, 0xE1, 0xEC, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF092F9A3C487AEA1ULL },
+    { { 0xC4, 0xE1, 0x69, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE6392C254306A34CULL },
+    { { 0xC4, 0xE1, 0xE9, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE6392C254306A34CULL },
+    { { 0xC4, 0xE1, 0x6D, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF092F9A3C487AEA1ULL },
+    { { 0xC4, 0xE1, 0xED, 0x55, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF092F9A3C487AEA1ULL },
+    { { 0xC4, 0xE1, 0x68, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD0B174B08C3DD53CULL },
+    { { 0xC4, 0xE1, 0xE8, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD0B174B08C3DD53CULL },
+    { { 0xC4, 0xE1, 0x6C, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6CC95448F5007FE2ULL },
+    { { 0xC4, 0xE1, 0xEC, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6CC95448F5007FE2ULL },
+    { { 0xC4, 0xE1, 0x69, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD0B174B08C3DD53CULL },
+    { { 0xC4, 0xE1, 0xE9, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD0B174B08C3DD53CULL },
+    { { 0xC4, 0xE1, 0x6D, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6CC95448F5007FE2ULL },
+    { { 0xC4, 0xE1, 0xED, 0x56, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6CC95448F5007FE2ULL },
+    { { 0xC4, 0xE1, 0x68, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83C1C65E6D5BAD01ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83C1C65E6D5BAD01ULL },
+    { { 0xC4, 0xE1, 0x6C, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x83E413A3B82E8587ULL },
+    { { 0xC4, 0xE1, 0xEC, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x83E413A3B82E8587ULL },
+    { { 0xC4, 0xE1, 0x69, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83C1C65E6D5BAD01ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83C1C65E6D5BAD01ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x83E413A3B82E8587ULL },
+    { { 0xC4, 0xE1, 0xED, 0x57, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x83E413A3B82E8587ULL },
+    { { 0xC4, 0xE1, 0x68, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAE43BC2434C3F946ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAE43BC2434C3F946ULL },
+    { { 0xC4, 0xE1, 0x6C, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x67AAF24E95BCE20CULL },
+    { { 0xC4, 0xE1, 0xEC, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x67AAF24E95BCE20CULL },
+    { { 0xC4, 0xE1, 0x6A, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE90AACBC07A9CB98ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE90AACBC07A9CB98ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBF508F759245919BULL },
+    { { 0xC4, 0xE1, 0xEE, 0x58, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBF508F759245919BULL },
+    { { 0xC4, 0xE1, 0x68, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1A6AEA3F096B8F4CULL },
+    { { 0xC4, 0xE1, 0xE8, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1A6AEA3F096B8F4CULL },
+    { { 0xC4, 0xE1, 0x6C, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x10E009E1B954BF2EULL },
+    { { 0xC4, 0xE1, 0xEC, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x10E009E1B954BF2EULL },
+    { { 0xC4, 0xE1, 0x69, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xDE8A361C032098E6ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xDE8A361C032098E6ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x39FFD306E0562728ULL },
+    { { 0xC4, 0xE1, 0xED, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x39FFD306E0562728ULL },
+    { { 0xC4, 0xE1, 0x6A, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xDF217FEB733DB87DULL },
+    { { 0xC4, 0xE1, 0xEA, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xDF217FEB733DB87DULL },
+    { { 0xC4, 0xE1, 0x6E, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x457D462A3E33F162ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x457D462A3E33F162ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x823877D55A102C49ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x823877D55A102C49ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x88420D906516D1AEULL },
+    { { 0xC4, 0xE1, 0xEF, 0x59, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x88420D906516D1AEULL },
+    { { 0xC4, 0xE1, 0x6A, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2BD837055A0ADDE0ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2BD837055A0ADDE0ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE0563261339F1383ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE0563261339F1383ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x731EAB555B2C2E76ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x731EAB555B2C2E76ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1DD62C67EF4DDB01ULL },
+    { { 0xC4, 0xE1, 0xEF, 0x5A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1DD62C67EF4DDB01ULL },
+    { { 0xC4, 0xE1, 0x68, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB80024E04CBA714EULL },
+    { { 0xC4, 0xE1, 0xE8, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB80024E04CBA714EULL },
+    { { 0xC4, 0xE1, 0x6C, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCF5846141A483E1AULL },
+    { { 0xC4, 0xE1, 0xEC, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCF5846141A483E1AULL },
+    { { 0xC4, 0xE1, 0x69, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB27D27E7A7CA78B5ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB27D27E7A7CA78B5ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x59C39295B9968ABBULL },
+    { { 0xC4, 0xE1, 0xED, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x59C39295B9968ABBULL },
+    { { 0xC4, 0xE1, 0x6A, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x22841E44F9DFAAEBULL },
+    { { 0xC4, 0xE1, 0xEA, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x22841E44F9DFAAEBULL },
+    { { 0xC4, 0xE1, 0x6E, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE329662A13547E58ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE329662A13547E58ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE1, 0xEF, 0x5C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE1, 0x68, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x121B4E3A67E043FFULL },
+    { { 0xC4, 0xE1, 0xE8, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x121B4E3A67E043FFULL },
+    { { 0xC4, 0xE1, 0x6C, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x51F8D37775F5A29CULL },
+    { { 0xC4, 0xE1, 0xEC, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x51F8D37775F5A29CULL },
+    { { 0xC4, 0xE1, 0x69, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x545CD6A1B97F3915ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x545CD6A1B97F3915ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x436B06E618A72EE8ULL },
+    { { 0xC4, 0xE1, 0xED, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x436B06E618A72EE8ULL },
+    { { 0xC4, 0xE1, 0x6A, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xECA4B47AF4D28C4AULL },
+    { { 0xC4, 0xE1, 0xEE, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xECA4B47AF4D28C4AULL },
+    { { 0xC4, 0xE1, 0x6B, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x545CD6A1B97F3915ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x545CD6A1B97F3915ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA86F1DE714751F9AULL },
+    { { 0xC4, 0xE1, 0xEF, 0x5D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA86F1DE714751F9AULL },
+    { { 0xC4, 0xE1, 0x68, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x86C893F686C4E7C1ULL },
+    { { 0xC4, 0xE1, 0xE8, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x86C893F686C4E7C1ULL },
+    { { 0xC4, 0xE1, 0x6C, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5B03D44813D413ECULL },
+    { { 0xC4, 0xE1, 0xEC, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5B03D44813D413ECULL },
+    { { 0xC4, 0xE1, 0x69, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3AECC2622AEB52A8ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3AECC2622AEB52A8ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCB991E6B3010891FULL },
+    { { 0xC4, 0xE1, 0xED, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCB991E6B3010891FULL },
+    { { 0xC4, 0xE1, 0x6A, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF71E575712FC8CF6ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF71E575712FC8CF6ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xFA4FF35E53D46E81ULL },
+    { { 0xC4, 0xE1, 0xEE, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xFA4FF35E53D46E81ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE3FFA4BF759604B2ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE3FFA4BF759604B2ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA391C3CACF81671DULL },
+    { { 0xC4, 0xE1, 0xEF, 0x5E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA391C3CACF81671DULL },
+    { { 0xC4, 0xE1, 0x68, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBE07F5B3509940BULL },
+    { { 0xC4, 0xE1, 0xE8, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBE07F5B3509940BULL },
+    { { 0xC4, 0xE1, 0x6C, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xEC01B89076BEFB2DULL },
+    { { 0xC4, 0xE1, 0xEC, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xEC01B89076BEFB2DULL },
+    { { 0xC4, 0xE1, 0x69, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x59D62C72A7DAB05DULL },
+    { { 0xC4, 0xE1, 0xED, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x59D62C72A7DAB05DULL },
+    { { 0xC4, 0xE1, 0x6A, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE1, 0xEA, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE1, 0x6E, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE1, 0xEE, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE1, 0x6B, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE1, 0xEF, 0x5F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE1, 0x69, 0x60, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4A2341DD5173F085ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x60, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4A2341DD5173F085ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x60, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xDA0C4606DF7C66FAULL },
+    { { 0xC4, 0xE1, 0xED, 0x60, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xDA0C4606DF7C66FAULL },
+    { { 0xC4, 0xE1, 0x69, 0x61, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9AA99F1FC2DCA731ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x61, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9AA99F1FC2DCA731ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x61, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0DE9CF86AEC671ACULL },
+    { { 0xC4, 0xE1, 0xED, 0x61, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0DE9CF86AEC671ACULL },
+    { { 0xC4, 0xE1, 0x69, 0x62, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6CD087BBE9897649ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x62, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6CD087BBE9897649ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x62, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8BA1AED375DEBCC8ULL },
+    { { 0xC4, 0xE1, 0xED, 0x62, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8BA1AED375DEBCC8ULL },
+    { { 0xC4, 0xE1, 0x69, 0x63, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x62E01ECC7E42FB94ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x63, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x62E01ECC7E42FB94ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x63, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x63E1C69C77AF21A0ULL },
+    { { 0xC4, 0xE1, 0xED, 0x63, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x63E1C69C77AF21A0ULL },
+    { { 0xC4, 0xE1, 0x69, 0x64, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x16BBF04E20B78531ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x64, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x16BBF04E20B78531ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x64, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0C23F35A62EF608AULL },
+    { { 0xC4, 0xE1, 0xED, 0x64, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0C23F35A62EF608AULL },
+    { { 0xC4, 0xE1, 0x69, 0x65, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE30890BF9B923F3DULL },
+    { { 0xC4, 0xE1, 0xE9, 0x65, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE30890BF9B923F3DULL },
+    { { 0xC4, 0xE1, 0x6D, 0x65, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1D1B4E38F93CBF5AULL },
+    { { 0xC4, 0xE1, 0xED, 0x65, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1D1B4E38F93CBF5AULL },
+    { { 0xC4, 0xE1, 0x69, 0x66, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE30890BF9B923F3DULL },
+    { { 0xC4, 0xE1, 0xE9, 0x66, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE30890BF9B923F3DULL },
+    { { 0xC4, 0xE1, 0x6D, 0x66, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x54E8831BF2DC858EULL },
+    { { 0xC4, 0xE1, 0xED, 0x66, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x54E8831BF2DC858EULL },
+    { { 0xC4, 0xE1, 0x69, 0x67, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8367E40481E0F094ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x67, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8367E40481E0F094ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x67, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA487637CF2A880A0ULL },
+    { { 0xC4, 0xE1, 0xED, 0x67, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA487637CF2A880A0ULL },
+    { { 0xC4, 0xE1, 0x69, 0x68, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xBA8AA1CAE758ED63ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x68, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xBA8AA1CAE758ED63ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x68, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE9A6190496FA715BULL },
+    { { 0xC4, 0xE1, 0xED, 0x68, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE9A6190496FA715BULL },
+    { { 0xC4, 0xE1, 0x69, 0x69, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD7E0F41C78C82925ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x69, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD7E0F41C78C82925ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x69, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x3DD813844C3AA755ULL },
+    { { 0xC4, 0xE1, 0xED, 0x69, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x3DD813844C3AA755ULL },
+    { { 0xC4, 0xE1, 0x69, 0x6A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x27CA80821C38C839ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x6A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x27CA80821C38C839ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x6A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x898F1E125C5BC9E5ULL },
+    { { 0xC4, 0xE1, 0xED, 0x6A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x898F1E125C5BC9E5ULL },
+    { { 0xC4, 0xE1, 0x69, 0x6B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x08F5BB5BB22D2FB3ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x6B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x08F5BB5BB22D2FB3ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x6B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x7B252AFC568669ACULL },
+    { { 0xC4, 0xE1, 0xED, 0x6B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x7B252AFC568669ACULL },
+    { { 0xC4, 0xE1, 0x69, 0x6C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x6C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x6C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBDDC191339AD9AE0ULL },
+    { { 0xC4, 0xE1, 0xED, 0x6C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBDDC191339AD9AE0ULL },
+    { { 0xC4, 0xE1, 0x69, 0x6D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x6D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x6D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x94AAB80D33461CF1ULL },
+    { { 0xC4, 0xE1, 0xED, 0x6D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x94AAB80D33461CF1ULL },
+    { { 0xC4, 0xE1, 0x69, 0x74, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x74, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x74, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0x74, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0x75, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x75, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x75, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0x75, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0x76, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x76, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x76, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0x76, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB90973D548A738B0ULL },
+    { { 0xC4, 0xE1, 0xED, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB90973D548A738B0ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9577423E9FFFAC03ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9577423E9FFFAC03ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD38046679C65C6E3ULL },
+    { { 0xC4, 0xE1, 0xEF, 0x7C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD38046679C65C6E3ULL },
+    { { 0xC4, 0xE1, 0x69, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB27D27E7A7CA78B5ULL },
+    { { 0xC4, 0xE1, 0xE9, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB27D27E7A7CA78B5ULL },
+    { { 0xC4, 0xE1, 0x6D, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF9D7FA65183C4689ULL },
+    { { 0xC4, 0xE1, 0xED, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF9D7FA65183C4689ULL },
+    { { 0xC4, 0xE1, 0x6B, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6E33FB0E0D393D45ULL },
+    { { 0xC4, 0xE1, 0xEB, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6E33FB0E0D393D45ULL },
+    { { 0xC4, 0xE1, 0x6F, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x7BE4B5E5EC40EF2AULL },
+    { { 0xC4, 0xE1, 0xEF, 0x7D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x7BE4B5E5EC40EF2AULL },
+    { { 0xC4, 0xE1, 0x68, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x68, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x68, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0x68, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0x69, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x762A192A4FFA5729ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0xED, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0xED, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCF5306A79E23DCFEULL },
+    { { 0xC4, 0xE1, 0x6A, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x81D5315F08A6A972ULL },
+    { { 0xC4, 0xE1, 0x6A, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x81D5315F08A6A972ULL },
+    { { 0xC4, 0xE1, 0x6A, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x03626D6B0E6ABF66ULL },
+    { { 0xC4, 0xE1, 0x6A, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x03626D6B0E6ABF66ULL },
+    { { 0xC4, 0xE1, 0xEA, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x81D5315F08A6A972ULL },
+    { { 0xC4, 0xE1, 0xEA, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x81D5315F08A6A972ULL },
+    { { 0xC4, 0xE1, 0xEA, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x03626D6B0E6ABF66ULL },
+    { { 0xC4, 0xE1, 0xEA, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x03626D6B0E6ABF66ULL },
+    { { 0xC4, 0xE1, 0x6E, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x32302C9C5E902EDDULL },
+    { { 0xC4, 0xE1, 0x6E, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x32302C9C5E902EDDULL },
+    { { 0xC4, 0xE1, 0x6E, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B37B7570341AA11ULL },
+    { { 0xC4, 0xE1, 0x6E, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B37B7570341AA11ULL },
+    { { 0xC4, 0xE1, 0xEE, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x32302C9C5E902EDDULL },
+    { { 0xC4, 0xE1, 0xEE, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x32302C9C5E902EDDULL },
+    { { 0xC4, 0xE1, 0xEE, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B37B7570341AA11ULL },
+    { { 0xC4, 0xE1, 0xEE, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B37B7570341AA11ULL },
+    { { 0xC4, 0xE1, 0x6B, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE1, 0x6B, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE1, 0x6B, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC40A81C37989060AULL },
+    { { 0xC4, 0xE1, 0x6B, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC40A81C37989060AULL },
+    { { 0xC4, 0xE1, 0xEB, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE1, 0xEB, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE1, 0xEB, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC40A81C37989060AULL },
+    { { 0xC4, 0xE1, 0xEB, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC40A81C37989060AULL },
+    { { 0xC4, 0xE1, 0x6F, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x591F5B1CAAE65D7DULL },
+    { { 0xC4, 0xE1, 0x6F, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x591F5B1CAAE65D7DULL },
+    { { 0xC4, 0xE1, 0x6F, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB116F81CA8D0D235ULL },
+    { { 0xC4, 0xE1, 0x6F, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB116F81CA8D0D235ULL },
+    { { 0xC4, 0xE1, 0xEF, 0xC2, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x591F5B1CAAE65D7DULL },
+    { { 0xC4, 0xE1, 0xEF, 0xC2, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x591F5B1CAAE65D7DULL },
+    { { 0xC4, 0xE1, 0xEF, 0xC2, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB116F81CA8D0D235ULL },
+    { { 0xC4, 0xE1, 0xEF, 0xC2, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB116F81CA8D0D235ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC4, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x4F3E417E395B0433ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC4, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xFE4B9B7685E8ABD3ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC4, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x2C069E98D4EA8F0FULL },
+    { { 0xC4, 0xE1, 0x69, 0xC4, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xDA3BC4C711924A67ULL },
+    { { 0xC4, 0xE1, 0x68, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x6792323756BDE889ULL },
+    { { 0xC4, 0xE1, 0x68, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x1F466B82EFF5B565ULL },
+    { { 0xC4, 0xE1, 0x68, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xECFF0C3C8B2270CAULL },
+    { { 0xC4, 0xE1, 0x68, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x6792323756BDE889ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x1F466B82EFF5B565ULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xECFF0C3C8B2270CAULL },
+    { { 0xC4, 0xE1, 0xE8, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xA0E7E6B4F8D38CAEULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xD795E384E6AD07E3ULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCAA9AB55D20F94C9ULL },
+    { { 0xC4, 0xE1, 0x6C, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x8F5031CB0185B252ULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xA0E7E6B4F8D38CAEULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xD795E384E6AD07E3ULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xCAA9AB55D20F94C9ULL },
+    { { 0xC4, 0xE1, 0xEC, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x8F5031CB0185B252ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0x69, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xFF52CF0C2AA09DE9ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xE94DFE88867E5581ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xBDDC191339AD9AE0ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6B259EB23F08CC86ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x94AAB80D33461CF1ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x4A08A22F80735C4BULL },
+    { { 0xC4, 0xE1, 0xED, 0xC6, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xBDDC191339AD9AE0ULL },
+    { { 0xC4, 0xE1, 0xED, 0xC6, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6B259EB23F08CC86ULL },
+    { { 0xC4, 0xE1, 0xED, 0xC6, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x94AAB80D33461CF1ULL },
+    { { 0xC4, 0xE1, 0xED, 0xC6, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x4A08A22F80735C4BULL },
+    { { 0xC4, 0xE1, 0x69, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF7D8463B8D987535ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x46C456A6947CB029ULL },
+    { { 0xC4, 0xE1, 0xED, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x46C456A6947CB029ULL },
+    { { 0xC4, 0xE1, 0x6B, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xABFA8BCF82739B76ULL },
+    { { 0xC4, 0xE1, 0xEB, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xABFA8BCF82739B76ULL },
+    { { 0xC4, 0xE1, 0x6F, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8879D27261C4BB01ULL },
+    { { 0xC4, 0xE1, 0xEF, 0xD0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8879D27261C4BB01ULL },
+    { { 0xC4, 0xE1, 0x69, 0xD1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xD1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xD2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xD2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xD3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xD3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xD4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4847DA3D053F1636ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4847DA3D053F1636ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0A6BFF78C4006586ULL },
+    { { 0xC4, 0xE1, 0xED, 0xD4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0A6BFF78C4006586ULL },
+    { { 0xC4, 0xE1, 0x69, 0xD5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3A71E2304FB38661ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3A71E2304FB38661ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8BF09650054747D1ULL },
+    { { 0xC4, 0xE1, 0xED, 0xD5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8BF09650054747D1ULL },
+    { { 0xC4, 0xE1, 0x69, 0xD8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC1AE36C39DAD3D14ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC1AE36C39DAD3D14ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2EB4C95D1B025BFFULL },
+    { { 0xC4, 0xE1, 0xED, 0xD8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2EB4C95D1B025BFFULL },
+    { { 0xC4, 0xE1, 0x69, 0xD9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8A532C2A37E773A6ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xD9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8A532C2A37E773A6ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xD9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x52EBB74525571453ULL },
+    { { 0xC4, 0xE1, 0xED, 0xD9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x52EBB74525571453ULL },
+    { { 0xC4, 0xE1, 0x69, 0xDA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x69E354677BBBAE78ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xDA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x69E354677BBBAE78ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xDA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBE2F5CCA8B2650BEULL },
+    { { 0xC4, 0xE1, 0xED, 0xDA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBE2F5CCA8B2650BEULL },
+    { { 0xC4, 0xE1, 0x69, 0xDB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x085A07082D5087A8ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xDB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x085A07082D5087A8ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xDB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5BE47D0E405D0F6BULL },
+    { { 0xC4, 0xE1, 0xED, 0xDB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5BE47D0E405D0F6BULL },
+    { { 0xC4, 0xE1, 0x69, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x72E0239645D966DEULL },
+    { { 0xC4, 0xE1, 0xE9, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x72E0239645D966DEULL },
+    { { 0xC4, 0xE1, 0x6D, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x001857212AA4455BULL },
+    { { 0xC4, 0xE1, 0xED, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x001857212AA4455BULL },
+    { { 0xC4, 0xE1, 0x69, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1C8DB947F455E3EAULL },
+    { { 0xC4, 0xE1, 0xE9, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1C8DB947F455E3EAULL },
+    { { 0xC4, 0xE1, 0x6D, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB5FC3E257FFB89F1ULL },
+    { { 0xC4, 0xE1, 0xED, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB5FC3E257FFB89F1ULL },
+    { { 0xC4, 0xE1, 0x69, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1E6755A9C89D0B90ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1E6755A9C89D0B90ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD7C87F404469FF1BULL },
+    { { 0xC4, 0xE1, 0xED, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD7C87F404469FF1BULL },
+    { { 0xC4, 0xE1, 0x69, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE6392C254306A34CULL },
+    { { 0xC4, 0xE1, 0xE9, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE6392C254306A34CULL },
+    { { 0xC4, 0xE1, 0x6D, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF092F9A3C487AEA1ULL },
+    { { 0xC4, 0xE1, 0xED, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF092F9A3C487AEA1ULL },
+    { { 0xC4, 0xE1, 0x69, 0xE0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xED3C9DDC979672BDULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xED3C9DDC979672BDULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB8B7F858048B1D86ULL },
+    { { 0xC4, 0xE1, 0xED, 0xE0, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB8B7F858048B1D86ULL },
+    { { 0xC4, 0xE1, 0x69, 0xE1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x083D9CC2584E2D91ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x083D9CC2584E2D91ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x4D134EF73D4A7858ULL },
+    { { 0xC4, 0xE1, 0xED, 0xE1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x4D134EF73D4A7858ULL },
+    { { 0xC4, 0xE1, 0x69, 0xE2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6201AA8D3D96AD75ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6201AA8D3D96AD75ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2AC02348DCAE990EULL },
+    { { 0xC4, 0xE1, 0xED, 0xE2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2AC02348DCAE990EULL },
+    { { 0xC4, 0xE1, 0x69, 0xE3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x334210D96D82BF66ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x334210D96D82BF66ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF2C599A070B75CDCULL },
+    { { 0xC4, 0xE1, 0xED, 0xE3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF2C599A070B75CDCULL },
+    { { 0xC4, 0xE1, 0x69, 0xE4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x29E1E4C6DB0EED61ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x29E1E4C6DB0EED61ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD397A53896BFB92EULL },
+    { { 0xC4, 0xE1, 0xED, 0xE4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD397A53896BFB92EULL },
+    { { 0xC4, 0xE1, 0x69, 0xE5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC9B980A6772EBF42ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC9B980A6772EBF42ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB4366DC236B1D452ULL },
+    { { 0xC4, 0xE1, 0xED, 0xE5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB4366DC236B1D452ULL },
+    { { 0xC4, 0xE1, 0x69, 0xE8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA0941DFA306CB66EULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA0941DFA306CB66EULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2AA235D7611854DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xE8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2AA235D7611854DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xE9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFD36C154B54BBD9BULL },
+    { { 0xC4, 0xE1, 0xE9, 0xE9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFD36C154B54BBD9BULL },
+    { { 0xC4, 0xE1, 0x6D, 0xE9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xDD1CAEBBA793D80FULL },
+    { { 0xC4, 0xE1, 0xED, 0xE9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xDD1CAEBBA793D80FULL },
+    { { 0xC4, 0xE1, 0x69, 0xEA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x121B4E3A67E043FFULL },
+    { { 0xC4, 0xE1, 0xE9, 0xEA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x121B4E3A67E043FFULL },
+    { { 0xC4, 0xE1, 0x6D, 0xEA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x84F600A609534978ULL },
+    { { 0xC4, 0xE1, 0xED, 0xEA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x84F600A609534978ULL },
+    { { 0xC4, 0xE1, 0x69, 0xEB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD0B174B08C3DD53CULL },
+    { { 0xC4, 0xE1, 0xE9, 0xEB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD0B174B08C3DD53CULL },
+    { { 0xC4, 0xE1, 0x6D, 0xEB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6CC95448F5007FE2ULL },
+    { { 0xC4, 0xE1, 0xED, 0xEB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6CC95448F5007FE2ULL },
+    { { 0xC4, 0xE1, 0x69, 0xEC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x08365868290D11BEULL },
+    { { 0xC4, 0xE1, 0xE9, 0xEC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x08365868290D11BEULL },
+    { { 0xC4, 0xE1, 0x6D, 0xEC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x71AED2706BAD81C4ULL },
+    { { 0xC4, 0xE1, 0xED, 0xEC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x71AED2706BAD81C4ULL },
+    { { 0xC4, 0xE1, 0x69, 0xED, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x124617863DE92146ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xED, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x124617863DE92146ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xED, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF16C1F215EA1A5AFULL },
+    { { 0xC4, 0xE1, 0xED, 0xED, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF16C1F215EA1A5AFULL },
+    { { 0xC4, 0xE1, 0x69, 0xEE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBE07F5B3509940BULL },
+    { { 0xC4, 0xE1, 0xE9, 0xEE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBE07F5B3509940BULL },
+    { { 0xC4, 0xE1, 0x6D, 0xEE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x11CFE0A82E15DD69ULL },
+    { { 0xC4, 0xE1, 0xED, 0xEE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x11CFE0A82E15DD69ULL },
+    { { 0xC4, 0xE1, 0x69, 0xEF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83C1C65E6D5BAD01ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xEF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83C1C65E6D5BAD01ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xEF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x83E413A3B82E8587ULL },
+    { { 0xC4, 0xE1, 0xED, 0xEF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x83E413A3B82E8587ULL },
+    { { 0xC4, 0xE1, 0x69, 0xF1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xF1, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xF2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xF2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xF3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0xED, 0xF3, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE1, 0x69, 0xF4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAFF89B9637DE44E2ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAFF89B9637DE44E2ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE2FA37A04E73D0D7ULL },
+    { { 0xC4, 0xE1, 0xED, 0xF4, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE2FA37A04E73D0D7ULL },
+    { { 0xC4, 0xE1, 0x69, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8E93821EC687D97DULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8E93821EC687D97DULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x049F451969628C0AULL },
+    { { 0xC4, 0xE1, 0xED, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x049F451969628C0AULL },
+    { { 0xC4, 0xE1, 0x69, 0xF6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9E00ADF0AA0E2856ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9E00ADF0AA0E2856ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x63AD6B4303BC78BDULL },
+    { { 0xC4, 0xE1, 0xED, 0xF6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x63AD6B4303BC78BDULL },
+    { { 0xC4, 0xE1, 0x69, 0xF8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x566D28EDBC3F5FC3ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x566D28EDBC3F5FC3ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x49F32B70101F3D35ULL },
+    { { 0xC4, 0xE1, 0xED, 0xF8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x49F32B70101F3D35ULL },
+    { { 0xC4, 0xE1, 0x69, 0xF9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xCBFE386A7C642B6CULL },
+    { { 0xC4, 0xE1, 0xE9, 0xF9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xCBFE386A7C642B6CULL },
+    { { 0xC4, 0xE1, 0x6D, 0xF9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x56FEE0742B86C120ULL },
+    { { 0xC4, 0xE1, 0xED, 0xF9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x56FEE0742B86C120ULL },
+    { { 0xC4, 0xE1, 0x69, 0xFA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAF6F2A966FEBE325ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xFA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAF6F2A966FEBE325ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xFA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xAFB9B570B070963DULL },
+    { { 0xC4, 0xE1, 0xED, 0xFA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xAFB9B570B070963DULL },
+    { { 0xC4, 0xE1, 0x69, 0xFB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC12062BA0E144D17ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xFB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC12062BA0E144D17ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xFB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0F31686A31223732ULL },
+    { { 0xC4, 0xE1, 0xED, 0xFB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0F31686A31223732ULL },
+    { { 0xC4, 0xE1, 0x69, 0xFC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x7A9AA7CB92BE3E63ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xFC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x7A9AA7CB92BE3E63ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xFC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD4DDC315BD290461ULL },
+    { { 0xC4, 0xE1, 0xED, 0xFC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD4DDC315BD290461ULL },
+    { { 0xC4, 0xE1, 0x69, 0xFD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x172E1DAB724644B0ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xFD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x172E1DAB724644B0ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xFD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x3E7DFE7B127F52C1ULL },
+    { { 0xC4, 0xE1, 0xED, 0xFD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x3E7DFE7B127F52C1ULL },
+    { { 0xC4, 0xE1, 0x69, 0xFE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4847DA3D053F1636ULL },
+    { { 0xC4, 0xE1, 0xE9, 0xFE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4847DA3D053F1636ULL },
+    { { 0xC4, 0xE1, 0x6D, 0xFE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xAA33E4528F0D7DC2ULL },
+    { { 0xC4, 0xE1, 0xED, 0xFE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xAA33E4528F0D7DC2ULL },
+    { { 0xC4, 0xE2, 0x69, 0x00, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x25BC5684D0789D87ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x00, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x25BC5684D0789D87ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x00, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x451A386B3A0D8F65ULL },
+    { { 0xC4, 0xE2, 0xED, 0x00, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x451A386B3A0D8F65ULL },
+    { { 0xC4, 0xE2, 0x69, 0x01, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA15EE7A2EE34C0ABULL },
+    { { 0xC4, 0xE2, 0xE9, 0x01, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA15EE7A2EE34C0ABULL },
+    { { 0xC4, 0xE2, 0x6D, 0x01, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x3AFABF507D44F697ULL },
+    { { 0xC4, 0xE2, 0xED, 0x01, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x3AFABF507D44F697ULL },
+    { { 0xC4, 0xE2, 0x69, 0x02, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2D1F05450E4D37A3ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x02, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2D1F05450E4D37A3ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x02, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCD96089602DE0C65ULL },
+    { { 0xC4, 0xE2, 0xED, 0x02, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCD96089602DE0C65ULL },
+    { { 0xC4, 0xE2, 0x69, 0x03, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x497C5EC1AAC81692ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x03, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x497C5EC1AAC81692ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x03, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6DB62D1C1D34E639ULL },
+    { { 0xC4, 0xE2, 0xED, 0x03, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6DB62D1C1D34E639ULL },
+    { { 0xC4, 0xE2, 0x69, 0x04, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE3764721FAEED728ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x04, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE3764721FAEED728ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x04, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1ECA38280F24E3CEULL },
+    { { 0xC4, 0xE2, 0xED, 0x04, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1ECA38280F24E3CEULL },
+    { { 0xC4, 0xE2, 0x69, 0x05, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x633161EF75FAE478ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x05, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x633161EF75FAE478ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x05, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xC2F31B865E2EDA5BULL },
+    { { 0xC4, 0xE2, 0xED, 0x05, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xC2F31B865E2EDA5BULL },
+    { { 0xC4, 0xE2, 0x69, 0x06, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x0B0FB6414747C5E8ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x06, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x0B0FB6414747C5E8ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x06, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBC3B2CFC4E9FDAE9ULL },
+    { { 0xC4, 0xE2, 0xED, 0x06, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBC3B2CFC4E9FDAE9ULL },
+    { { 0xC4, 0xE2, 0x69, 0x07, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF61882B2A00638BDULL },
+    { { 0xC4, 0xE2, 0xE9, 0x07, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF61882B2A00638BDULL },
+    { { 0xC4, 0xE2, 0x6D, 0x07, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2943170949306B2DULL },
+    { { 0xC4, 0xE2, 0xED, 0x07, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2943170949306B2DULL },
+    { { 0xC4, 0xE2, 0x69, 0x08, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x563A49B7681D3439ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x08, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x563A49B7681D3439ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x08, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xED405DDE4670DEEFULL },
+    { { 0xC4, 0xE2, 0xED, 0x08, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xED405DDE4670DEEFULL },
+    { { 0xC4, 0xE2, 0x69, 0x09, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA0529E8611D654A2ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x09, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA0529E8611D654A2ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x09, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x02D09B740B5CC813ULL },
+    { { 0xC4, 0xE2, 0xED, 0x09, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x02D09B740B5CC813ULL },
+    { { 0xC4, 0xE2, 0x69, 0x0A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xEBEE75E57B2C8D23ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x0A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xEBEE75E57B2C8D23ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x0A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x48112C54A9B5DD98ULL },
+    { { 0xC4, 0xE2, 0xED, 0x0A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x48112C54A9B5DD98ULL },
+    { { 0xC4, 0xE2, 0x69, 0x0B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD64380FABD1E0F98ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x0B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD64380FABD1E0F98ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x0B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9BAA424347C8C7BDULL },
+    { { 0xC4, 0xE2, 0xED, 0x0B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9BAA424347C8C7BDULL },
+    { { 0xC4, 0xE2, 0x69, 0x0C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xDE34FEF9B3828DF3ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x0C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x64D6A27EA4F775D8ULL },
+    { { 0xC4, 0xE2, 0x69, 0x0D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4AF402EAA07F2FC1ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x0D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9E76256DC4DAAF79ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x16, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x06BEA2D09F6B2331ULL },
+    { { 0xC4, 0xE2, 0x69, 0x28, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x310142C85DAE1CD8ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x28, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x310142C85DAE1CD8ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x28, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xC95F28269698A8F3ULL },
+    { { 0xC4, 0xE2, 0xED, 0x28, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xC95F28269698A8F3ULL },
+    { { 0xC4, 0xE2, 0x69, 0x29, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x29, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x29, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE2, 0xED, 0x29, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE2, 0x69, 0x2B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x78AA16152EE3F0B3ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x2B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x78AA16152EE3F0B3ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x2B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0331B3F80D3C30ACULL },
+    { { 0xC4, 0xE2, 0xED, 0x2B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0331B3F80D3C30ACULL },
+    { { 0xC4, 0xE2, 0x6D, 0x36, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x06BEA2D09F6B2331ULL },
+    { { 0xC4, 0xE2, 0x69, 0x37, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBBDA6D0B86A2321ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x37, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBBDA6D0B86A2321ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x37, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x42A04278FA5AB0E6ULL },
+    { { 0xC4, 0xE2, 0xED, 0x37, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x42A04278FA5AB0E6ULL },
+    { { 0xC4, 0xE2, 0x69, 0x38, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x93FFD0514EF1E392ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x38, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x93FFD0514EF1E392ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x38, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9CD21F63DEFCA4D4ULL },
+    { { 0xC4, 0xE2, 0xED, 0x38, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9CD21F63DEFCA4D4ULL },
+    { { 0xC4, 0xE2, 0x69, 0x39, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x121B4E3A67E043FFULL },
+    { { 0xC4, 0xE2, 0xE9, 0x39, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x121B4E3A67E043FFULL },
+    { { 0xC4, 0xE2, 0x6D, 0x39, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB557D7E343C27224ULL },
+    { { 0xC4, 0xE2, 0xED, 0x39, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB557D7E343C27224ULL },
+    { { 0xC4, 0xE2, 0x69, 0x3A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3416A3649CE8102CULL },
+    { { 0xC4, 0xE2, 0xE9, 0x3A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3416A3649CE8102CULL },
+    { { 0xC4, 0xE2, 0x6D, 0x3A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x312E5C92927803E6ULL },
+    { { 0xC4, 0xE2, 0xED, 0x3A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x312E5C92927803E6ULL },
+    { { 0xC4, 0xE2, 0x69, 0x3B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2790B6BD18C200FBULL },
+    { { 0xC4, 0xE2, 0xE9, 0x3B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2790B6BD18C200FBULL },
+    { { 0xC4, 0xE2, 0x6D, 0x3B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE634BDBF47F8C31DULL },
+    { { 0xC4, 0xE2, 0xED, 0x3B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xE634BDBF47F8C31DULL },
+    { { 0xC4, 0xE2, 0x69, 0x3C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE4ED0480623C5262ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x3C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE4ED0480623C5262ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x3C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2FE8FD2511E2BC39ULL },
+    { { 0xC4, 0xE2, 0xED, 0x3C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2FE8FD2511E2BC39ULL },
+    { { 0xC4, 0xE2, 0x69, 0x3D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBE07F5B3509940BULL },
+    { { 0xC4, 0xE2, 0xE9, 0x3D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFBE07F5B3509940BULL },
+    { { 0xC4, 0xE2, 0x6D, 0x3D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x61BC97517AC7883DULL },
+    { { 0xC4, 0xE2, 0xED, 0x3D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x61BC97517AC7883DULL },
+    { { 0xC4, 0xE2, 0x69, 0x3E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD515C19A164A8230ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x3E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD515C19A164A8230ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x3E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1FBFC1335779F7D3ULL },
+    { { 0xC4, 0xE2, 0xED, 0x3E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x1FBFC1335779F7D3ULL },
+    { { 0xC4, 0xE2, 0x69, 0x3F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3577D3C73DAC420FULL },
+    { { 0xC4, 0xE2, 0xE9, 0x3F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3577D3C73DAC420FULL },
+    { { 0xC4, 0xE2, 0x6D, 0x3F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF462B54F4D4B7EACULL },
+    { { 0xC4, 0xE2, 0xED, 0x3F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xF462B54F4D4B7EACULL },
+    { { 0xC4, 0xE2, 0x69, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x55627AB1283A4000ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x55627AB1283A4000ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xC4CAF1A5905567E8ULL },
+    { { 0xC4, 0xE2, 0xED, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xC4CAF1A5905567E8ULL },
+    { { 0xC4, 0xE2, 0x69, 0x45, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x45, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x45, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE2, 0xED, 0x45, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE2, 0x69, 0x46, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6201AA8D3D96AD75ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x46, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2AC02348DCAE990EULL },
+    { { 0xC4, 0xE2, 0x69, 0x47, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x47, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE2, 0x6D, 0x47, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE2, 0xED, 0x47, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE2, 0x69, 0x90, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0xB8FB7E2297B45D6FULL },
+    { { 0xC4, 0xE2, 0xE9, 0x90, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0x887B372A377637FDULL },
+    { { 0xC4, 0xE2, 0x6D, 0x90, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0xEB6F5704A86E91D0ULL },
+    { { 0xC4, 0xE2, 0xED, 0x90, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0x635BB9D434E6D9EAULL },
+    { { 0xC4, 0xE2, 0x69, 0x91, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0x90F57CEEE57B4773ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x91, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0x8AB4025AB27192DDULL },
+    { { 0xC4, 0xE2, 0x6D, 0x91, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0xD0236235AEECC70EULL },
+    { { 0xC4, 0xE2, 0xED, 0x91, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0xAD30CC40A0BFA385ULL },
+    { { 0xC4, 0xE2, 0x69, 0x92, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0xB8FB7E2297B45D6FULL },
+    { { 0xC4, 0xE2, 0xE9, 0x92, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0x887B372A377637FDULL },
+    { { 0xC4, 0xE2, 0x6D, 0x92, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0xEB6F5704A86E91D0ULL },
+    { { 0xC4, 0xE2, 0xED, 0x92, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0x635BB9D434E6D9EAULL },
+    { { 0xC4, 0xE2, 0x69, 0x93, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0x90F57CEEE57B4773ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x93, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFA, 0x8AB4025AB27192DDULL },
+    { { 0xC4, 0xE2, 0x6D, 0x93, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0xD0236235AEECC70EULL },
+    { { 0xC4, 0xE2, 0xED, 0x93, 0x04, 0xDE, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFA, 0xAD30CC40A0BFA385ULL },
+    { { 0xC4, 0xE2, 0x69, 0x96, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8810E59E46D3CC24ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x96, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xCB8C46547F83DA6EULL },
+    { { 0xC4, 0xE2, 0x6D, 0x96, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8E6EF43883198049ULL },
+    { { 0xC4, 0xE2, 0xED, 0x96, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0E9662073110BCFBULL },
+    { { 0xC4, 0xE2, 0x69, 0x97, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x3C2235203CF8E474ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x97, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB604A00D723751EEULL },
+    { { 0xC4, 0xE2, 0x6D, 0x97, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x89B39ADBD0DA0DF2ULL },
+    { { 0xC4, 0xE2, 0xED, 0x97, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCC78F181B9F968EEULL },
+    { { 0xC4, 0xE2, 0x69, 0x98, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB156FF01EB5AF607ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x98, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB604A00D723751EEULL },
+    { { 0xC4, 0xE2, 0x6D, 0x98, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xFC3E699931BB33CBULL },
+    { { 0xC4, 0xE2, 0xED, 0x98, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2D48BE3FEB27DD7BULL },
+    { { 0xC4, 0xE2, 0x69, 0x99, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x075BD407B7A2CAC8ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x99, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x18D55C30A80B97B7ULL },
+    { { 0xC4, 0xE2, 0x69, 0x9A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x204204C6DB2C56E3ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x9A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xCB8C46547F83DA6EULL },
+    { { 0xC4, 0xE2, 0x6D, 0x9A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6DDC37D2418D80ACULL },
+    { { 0xC4, 0xE2, 0xED, 0x9A, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xAA85E3E41251D06EULL },
+    { { 0xC4, 0xE2, 0x69, 0x9B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x0797FF381F5B286FULL },
+    { { 0xC4, 0xE2, 0xE9, 0x9B, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF6546B8B4DC7AC37ULL },
+    { { 0xC4, 0xE2, 0x69, 0x9C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xEEB8EB6312E3D9E3ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x9C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1CE783F8D22DE66EULL },
+    { { 0xC4, 0xE2, 0x6D, 0x9C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x0C155448A419A5ACULL },
+    { { 0xC4, 0xE2, 0xED, 0x9C, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xD8A356FFF895896EULL },
+    { { 0xC4, 0xE2, 0x69, 0x9D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x935E3E66F344A1EFULL },
+    { { 0xC4, 0xE2, 0xE9, 0x9D, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x18D55C30A80B97B7ULL },
+    { { 0xC4, 0xE2, 0x69, 0x9E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAA2CE92A05299E07ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x9E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x64A962691F8D45EEULL },
+    { { 0xC4, 0xE2, 0x6D, 0x9E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5290617D5F1F20CBULL },
+    { { 0xC4, 0xE2, 0xED, 0x9E, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x89ADEB873EB5267BULL },
+    { { 0xC4, 0xE2, 0x69, 0x9F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x857CACF3CA7F3248ULL },
+    { { 0xC4, 0xE2, 0xE9, 0x9F, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF6546B8B4DC7AC37ULL },
+    { { 0xC4, 0xE2, 0x69, 0xA6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x7FF859459DFC2BCCULL },
+    { { 0xC4, 0xE2, 0xE9, 0xA6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8AA48C23A1D1575BULL },
+    { { 0xC4, 0xE2, 0x6D, 0xA6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xA71D92D89B75CDEFULL },
+    { { 0xC4, 0xE2, 0xED, 0xA6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6B030585920E2292ULL },
+    { { 0xC4, 0xE2, 0x69, 0xA7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x581D6E2669401E32ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xA7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x8DC1A154158558E6ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xA7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x72102F3DDDFF978BULL },
+    { { 0xC4, 0xE2, 0xED, 0xA7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6C4033498C918BE4ULL },
+    { { 0xC4, 0xE2, 0x69, 0xA8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x32194E0376522CCCULL },
+    { { 0xC4, 0xE2, 0xE9, 0xA8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xBA2954DFFCA98B66ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xA8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x4A23F5DEF5E5B3F6ULL },
+    { { 0xC4, 0xE2, 0xED, 0xA8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9699D2F773118027ULL },
+    { { 0xC4, 0xE2, 0x69, 0xA9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6D695CF8963539F9ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xA9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x78BA6401727B6194ULL },
+    { { 0xC4, 0xE2, 0x69, 0xAA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x201D6DE27EEA992AULL },
+    { { 0xC4, 0xE2, 0xE9, 0xAA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x31F2F6AD63E560DBULL },
+    { { 0xC4, 0xE2, 0x6D, 0xAA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x2666550BA5B09A72ULL },
+    { { 0xC4, 0xE2, 0xED, 0xAA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8A796E20D28930E1ULL },
+    { { 0xC4, 0xE2, 0x69, 0xAB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC68DD4A34F5E2305ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xAB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x04592046C6BC91F1ULL },
+    { { 0xC4, 0xE2, 0x69, 0xAC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFCD43DB9333C982AULL },
+    { { 0xC4, 0xE2, 0xE9, 0xAC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x7226FF183EEC8ADBULL },
+    { { 0xC4, 0xE2, 0x6D, 0xAC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xFF363A66373D7172ULL },
+    { { 0xC4, 0xE2, 0xED, 0xAC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x01E09C077533DCE1ULL },
+    { { 0xC4, 0xE2, 0x69, 0xAD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x65F24EFAF090C585ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xAD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD140AF33B4E88371ULL },
+    { { 0xC4, 0xE2, 0x69, 0xAE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xD43A158113E018CCULL },
+    { { 0xC4, 0xE2, 0xE9, 0xAE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE4BA2D9A59D74466ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xAE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xCA29C4223A7DA4F6ULL },
+    { { 0xC4, 0xE2, 0xED, 0xAE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x72E66C52FBF85827ULL },
+    { { 0xC4, 0xE2, 0x69, 0xAF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x16DBBAE5D50F0A79ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xAF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC29C193BF23E6A14ULL },
+    { { 0xC4, 0xE2, 0x69, 0xB6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x93A8C2B5D67D30BEULL },
+    { { 0xC4, 0xE2, 0xE9, 0xB6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x1214FD3ADCCCAF0EULL },
+    { { 0xC4, 0xE2, 0x6D, 0xB6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x9CC8DDF287184DAAULL },
+    { { 0xC4, 0xE2, 0xED, 0xB6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xAECF573BAD7EB81AULL },
+    { { 0xC4, 0xE2, 0x69, 0xB7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x346D03B8A93F7F3AULL },
+    { { 0xC4, 0xE2, 0xE9, 0xB7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xAEE05C868CA03B6CULL },
+    { { 0xC4, 0xE2, 0x6D, 0xB7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x568DB4F3DAD86FFAULL },
+    { { 0xC4, 0xE2, 0xED, 0xB7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x5C915020320683D2ULL },
+    { { 0xC4, 0xE2, 0x69, 0xB8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x9FD2CB8026AAF49EULL },
+    { { 0xC4, 0xE2, 0xE9, 0xB8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x82636064E7AE5804ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xB8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x4DF3CB133836CB6AULL },
+    { { 0xC4, 0xE2, 0xED, 0xB8, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x809592D2AACCB4D2ULL },
+    { { 0xC4, 0xE2, 0x69, 0xB9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x83132E913B25617BULL },
+    { { 0xC4, 0xE2, 0xE9, 0xB9, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x5323BCFCCE160E68ULL },
+    { { 0xC4, 0xE2, 0x69, 0xBA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6E85CAEDFE290466ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xBA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xA179D9E30AC64B36ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xBA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xB369501E165FD47EULL },
+    { { 0xC4, 0xE2, 0xED, 0xBA, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xBD721C27625D9D1AULL },
+    { { 0xC4, 0xE2, 0x69, 0xBB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE699C6010F1F69FBULL },
+    { { 0xC4, 0xE2, 0xE9, 0xBB, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x688D3260AF3762FAULL },
+    { { 0xC4, 0xE2, 0x69, 0xBC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xB9E67D52AA082466ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xBC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x056F763F849DD336ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xBC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x36A02A70A316A97EULL },
+    { { 0xC4, 0xE2, 0xED, 0xBC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x4ACED111C980B61AULL },
+    { { 0xC4, 0xE2, 0x69, 0xBD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x874919638C78A37BULL },
+    { { 0xC4, 0xE2, 0xE9, 0xBD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x2570A46E5B21417AULL },
+    { { 0xC4, 0xE2, 0x69, 0xBE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x65F37FA860E44B9EULL },
+    { { 0xC4, 0xE2, 0xE9, 0xBE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x6886E5F65EBB6D04ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xBE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x6AE4383552410F6AULL },
+    { { 0xC4, 0xE2, 0xED, 0xBE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x205AB8D7FE8FB3D2ULL },
+    { { 0xC4, 0xE2, 0x69, 0xBF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xE263DB2EBDCC27FBULL },
+    { { 0xC4, 0xE2, 0xE9, 0xBF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xFAEA5DF471F3F9E8ULL },
+    { { 0xC4, 0xE2, 0x69, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF4EF4D118785C92EULL },
+    { { 0xC4, 0xE2, 0xE9, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xF4EF4D118785C92EULL },
+    { { 0xC4, 0xE2, 0x6D, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xACDA220CFD283414ULL },
+    { { 0xC4, 0xE2, 0xED, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0xACDA220CFD283414ULL },
+    { { 0xC4, 0xE2, 0x69, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xCAE87219909FA0E0ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xCAE87219909FA0E0ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x09325A8EE250A0DAULL },
+    { { 0xC4, 0xE2, 0xED, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x09325A8EE250A0DAULL },
+    { { 0xC4, 0xE2, 0x69, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC7491E01E30978B5ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0xC7491E01E30978B5ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x621AEE6D0CA52D10ULL },
+    { { 0xC4, 0xE2, 0xED, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x621AEE6D0CA52D10ULL },
+    { { 0xC4, 0xE2, 0x69, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4BDFC6DDA006F257ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFE, 0x4BDFC6DDA006F257ULL },
+    { { 0xC4, 0xE2, 0x6D, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8C462D93650EB2E6ULL },
+    { { 0xC4, 0xE2, 0xED, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 32, 0x8D5, 0xFFFE, 0x8C462D93650EB2E6ULL },
+    { { 0xC4, 0xE2, 0x68, 0xF2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x78DD030770AAC42CULL },
+    { { 0xC4, 0xE2, 0xE8, 0xF2, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x9C46D13C7B252A9BULL },
+    { { 0xC4, 0xE2, 0x68, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x7D3A355A8A86454FULL },
+    { { 0xC4, 0xE2, 0xE8, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x7D3A355A8A86454FULL },
+    { { 0xC4, 0xE2, 0x6A, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x91693A50A02A1E3BULL },
+    { { 0xC4, 0xE2, 0xEA, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0xF28487D29C0D6AF4ULL },
+    { { 0xC4, 0xE2, 0x6B, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0xDC9D7F4C965A929FULL },
+    { { 0xC4, 0xE2, 0xEB, 0xF5, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x92456CCBE82CE004ULL },
+    { { 0xC4, 0xE2, 0x6B, 0xF6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0xF2217147D6E8D488ULL },
+    { { 0xC4, 0xE2, 0xEB, 0xF6, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x9D0678C793B88921ULL },
+    { { 0xC4, 0xE2, 0x68, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x6BD8F9BC46C25749ULL },
+    { { 0xC4, 0xE2, 0xE8, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x6BD8F9BC46C25749ULL },
+    { { 0xC4, 0xE2, 0x69, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x07077B9C36E96B01ULL },
+    { { 0xC4, 0xE2, 0xE9, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x7F2743DD9346CFEDULL },
+    { { 0xC4, 0xE2, 0x6A, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0xE8C3980A5C21DE79ULL },
+    { { 0xC4, 0xE2, 0xEA, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x026600D253F02434ULL },
+    { { 0xC4, 0xE2, 0x6B, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0x9A4FF0421067DBD1ULL },
+    { { 0xC4, 0xE2, 0xEB, 0xF7, 0xC1, 0x00, 0x00, 0x00, }, 5, 1, 16, 0x8D5, 0xFFFF, 0xFC87E8C524538FFCULL },
+    { { 0xC4, 0xE3, 0x69, 0x02, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x02, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF4FD7C00AD457677ULL },
+    { { 0xC4, 0xE3, 0x69, 0x02, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0x69, 0x02, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7B3A081379B6C4E3ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x02, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x02, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xBAEE4C1D39F1121CULL },
+    { { 0xC4, 0xE3, 0x6D, 0x02, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x1E8DCAC478B0BCA1ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x02, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x64FA0154A0F94725ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x06, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xF5797F5ACBCF57DEULL },
+    { { 0xC4, 0xE3, 0x6D, 0x06, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6CA26D964B085E71ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x06, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5810082D81CA1DECULL },
+    { { 0xC4, 0xE3, 0x6D, 0x06, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE3, 0x69, 0x0A, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0A, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0A, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0A, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0A, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0A, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0A, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0A, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC8E26AF7EA544FF2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0B, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0B, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0B, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0B, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0B, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0B, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0B, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0B, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x68418B658FD67FD2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0C, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0C, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF4FD7C00AD457677ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0C, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0C, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7B3A081379B6C4E3ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0C, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0C, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF4FD7C00AD457677ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0C, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0C, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7B3A081379B6C4E3ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0C, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0C, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xBAEE4C1D39F1121CULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0C, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x1E8DCAC478B0BCA1ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0C, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x64FA0154A0F94725ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0C, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0C, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xBAEE4C1D39F1121CULL },
+    { { 0xC4, 0xE3, 0xED, 0x0C, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x1E8DCAC478B0BCA1ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0C, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x64FA0154A0F94725ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0D, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0D, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0D, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0D, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0D, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0D, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0D, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0D, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0D, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0D, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6D0D4086288D971EULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0D, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6E54DD836AA0A304ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0D, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xAB24FD7B83F70C5FULL },
+    { { 0xC4, 0xE3, 0xED, 0x0D, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0D, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6D0D4086288D971EULL },
+    { { 0xC4, 0xE3, 0xED, 0x0D, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6E54DD836AA0A304ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0D, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xAB24FD7B83F70C5FULL },
+    { { 0xC4, 0xE3, 0x69, 0x0E, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0E, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x50A7797D83F39100ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0E, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x749D5C06F0A1B162ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0E, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xBD3B77B8750AE9C0ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0E, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0E, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x50A7797D83F39100ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0E, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x749D5C06F0A1B162ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0E, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xBD3B77B8750AE9C0ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0E, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0E, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B9CD17632785A72ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0E, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB46FA29C408C3111ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0E, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x83DF5DC0196CB6A3ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0E, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0E, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B9CD17632785A72ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0E, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB46FA29C408C3111ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0E, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x83DF5DC0196CB6A3ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0F, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0F, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xA8CD2A777CDEBDB9ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0F, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0x69, 0x0F, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0F, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0F, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xA8CD2A777CDEBDB9ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0F, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x0F, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0F, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6E54DD836AA0A304ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0F, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x03FE37B243D22154ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0F, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE3, 0x6D, 0x0F, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE3, 0xED, 0x0F, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6E54DD836AA0A304ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0F, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x03FE37B243D22154ULL },
+    { { 0xC4, 0xE3, 0xED, 0x0F, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE3, 0xED, 0x0F, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE3, 0x6D, 0x18, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xEAFA56ADE34E0799ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x18, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xE98595C65DA2EA16ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x18, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xE98595C65DA2EA16ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x18, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xEAFA56ADE34E0799ULL },
+    { { 0xC4, 0xE3, 0x69, 0x20, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7816BBD0B0F50E50ULL },
+    { { 0xC4, 0xE3, 0x69, 0x20, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC4F18981C4C6F173ULL },
+    { { 0xC4, 0xE3, 0x69, 0x20, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x1FBFCDFFDC557F22ULL },
+    { { 0xC4, 0xE3, 0x69, 0x20, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x36317A1BBEEEA339ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x20, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7816BBD0B0F50E50ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x20, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC4F18981C4C6F173ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x20, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x1FBFCDFFDC557F22ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x20, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x36317A1BBEEEA339ULL },
+    { { 0xC4, 0xE3, 0x69, 0x21, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE3, 0x69, 0x21, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC3E415B39A3ED3EFULL },
+    { { 0xC4, 0xE3, 0x69, 0x21, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0x69, 0x21, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x97C227C795F13D87ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x21, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x21, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xC3E415B39A3ED3EFULL },
+    { { 0xC4, 0xE3, 0xE9, 0x21, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x21, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x97C227C795F13D87ULL },
+    { { 0xC4, 0xE3, 0x69, 0x22, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF953E46DE0146FE8ULL },
+    { { 0xC4, 0xE3, 0x69, 0x22, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x4C78467F5E6D9576ULL },
+    { { 0xC4, 0xE3, 0x69, 0x22, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x4C78467F5E6D9576ULL },
+    { { 0xC4, 0xE3, 0x69, 0x22, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF953E46DE0146FE8ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x22, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7B3687581ED6E47CULL },
+    { { 0xC4, 0xE3, 0xE9, 0x22, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xCB1E87EFEDC66244ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x22, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xCB1E87EFEDC66244ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x22, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7B3687581ED6E47CULL },
+    { { 0xC4, 0xE3, 0x6D, 0x38, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xEAFA56ADE34E0799ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x38, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xE98595C65DA2EA16ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x38, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xE98595C65DA2EA16ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x38, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xEAFA56ADE34E0799ULL },
+    { { 0xC4, 0xE3, 0x69, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0x69, 0x40, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xB0452527E486BCD2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x40, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x4C1C394B488818E1ULL },
+    { { 0xC4, 0xE3, 0x69, 0x40, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xD6A59DBBADD7B8D9ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x40, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xB0452527E486BCD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x40, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x4C1C394B488818E1ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x40, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xD6A59DBBADD7B8D9ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE3, 0x6D, 0x40, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB1486B998F6903DBULL },
+    { { 0xC4, 0xE3, 0x6D, 0x40, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x2B8CB40958AA3246ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x40, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B2CEC8F10F65324ULL },
+    { { 0xC4, 0xE3, 0xED, 0x40, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6C87E4676A3DC5DEULL },
+    { { 0xC4, 0xE3, 0xED, 0x40, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xB1486B998F6903DBULL },
+    { { 0xC4, 0xE3, 0xED, 0x40, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x2B8CB40958AA3246ULL },
+    { { 0xC4, 0xE3, 0xED, 0x40, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5B2CEC8F10F65324ULL },
+    { { 0xC4, 0xE3, 0x69, 0x41, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0x69, 0x41, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xEE00622477243D51ULL },
+    { { 0xC4, 0xE3, 0x69, 0x41, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x88F336D308009EE9ULL },
+    { { 0xC4, 0xE3, 0x69, 0x41, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x41, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x41, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xEE00622477243D51ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x41, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x88F336D308009EE9ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x41, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x606579F74C3CDB99ULL },
+    { { 0xC4, 0xE3, 0x69, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x343501110A3EF7DEULL },
+    { { 0xC4, 0xE3, 0x69, 0x42, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xA9C979453DC2732FULL },
+    { { 0xC4, 0xE3, 0x69, 0x42, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x44E5B4AA92EFB42CULL },
+    { { 0xC4, 0xE3, 0x69, 0x42, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xBB080AA51E3D7266ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x343501110A3EF7DEULL },
+    { { 0xC4, 0xE3, 0xE9, 0x42, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xA9C979453DC2732FULL },
+    { { 0xC4, 0xE3, 0xE9, 0x42, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x44E5B4AA92EFB42CULL },
+    { { 0xC4, 0xE3, 0xE9, 0x42, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xBB080AA51E3D7266ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x1E6067EBF2AA29EDULL },
+    { { 0xC4, 0xE3, 0x6D, 0x42, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x438B5681E40FD5FDULL },
+    { { 0xC4, 0xE3, 0x6D, 0x42, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xD4B4762F9593C8FEULL },
+    { { 0xC4, 0xE3, 0x6D, 0x42, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x2116860F8E8D1AA4ULL },
+    { { 0xC4, 0xE3, 0xED, 0x42, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x1E6067EBF2AA29EDULL },
+    { { 0xC4, 0xE3, 0xED, 0x42, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x438B5681E40FD5FDULL },
+    { { 0xC4, 0xE3, 0xED, 0x42, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xD4B4762F9593C8FEULL },
+    { { 0xC4, 0xE3, 0xED, 0x42, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x2116860F8E8D1AA4ULL },
+    { { 0xC4, 0xE3, 0x69, 0x44, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x2AE4822E4A1EFDD2ULL },
+    { { 0xC4, 0xE3, 0x69, 0x44, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF8B80339B5E1C59AULL },
+    { { 0xC4, 0xE3, 0x69, 0x44, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF8B80339B5E1C59AULL },
+    { { 0xC4, 0xE3, 0x69, 0x44, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x2AE4822E4A1EFDD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x44, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x2AE4822E4A1EFDD2ULL },
+    { { 0xC4, 0xE3, 0xE9, 0x44, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF8B80339B5E1C59AULL },
+    { { 0xC4, 0xE3, 0xE9, 0x44, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0xF8B80339B5E1C59AULL },
+    { { 0xC4, 0xE3, 0xE9, 0x44, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x2AE4822E4A1EFDD2ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x44, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x9CE1BD5ADD35A2CAULL },
+    { { 0xC4, 0xE3, 0x6D, 0x44, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x415786A76FB97B29ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x44, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x415786A76FB97B29ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x44, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x9CE1BD5ADD35A2CAULL },
+    { { 0xC4, 0xE3, 0xED, 0x44, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x9CE1BD5ADD35A2CAULL },
+    { { 0xC4, 0xE3, 0xED, 0x44, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x415786A76FB97B29ULL },
+    { { 0xC4, 0xE3, 0xED, 0x44, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x415786A76FB97B29ULL },
+    { { 0xC4, 0xE3, 0xED, 0x44, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x9CE1BD5ADD35A2CAULL },
+    { { 0xC4, 0xE3, 0x6D, 0x46, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xF5797F5ACBCF57DEULL },
+    { { 0xC4, 0xE3, 0x6D, 0x46, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x6CA26D964B085E71ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x46, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5810082D81CA1DECULL },
+    { { 0xC4, 0xE3, 0x6D, 0x46, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xA53610A9AB12CB6EULL },
+    { { 0xC4, 0xE3, 0x69, 0x4A, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x7B3A081379B6C4E3ULL },
+    { { 0xC4, 0xE3, 0x69, 0x4A, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x3577D3C73DAC420FULL },
+    { { 0xC4, 0xE3, 0x69, 0x4A, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x3CBB1DD0E004A5E5ULL },
+    { { 0xC4, 0xE3, 0x69, 0x4A, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x619AE1E8A1BFE2A5ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4A, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x71E19CB31975F596ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4A, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xF462B54F4D4B7EACULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4A, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x03952C0DC0DAD94AULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4A, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x3C57D6E16EF76A4DULL },
+    { { 0xC4, 0xE3, 0x69, 0x4B, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x4B, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x4B, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x019A4D3737569909ULL },
+    { { 0xC4, 0xE3, 0x69, 0x4B, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x93C53E31CBBE8561ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4B, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x596FBC15CC32DD61ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4B, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x2FF8A2B630CCD4DCULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4B, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xAB24FD7B83F70C5FULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4B, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xEAFA56ADE34E0799ULL },
+    { { 0xC4, 0xE3, 0x69, 0x4C, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x077D23C40F3D581CULL },
+    { { 0xC4, 0xE3, 0x69, 0x4C, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x78140B8854B81EABULL },
+    { { 0xC4, 0xE3, 0x69, 0x4C, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x02C127A28BA310CFULL },
+    { { 0xC4, 0xE3, 0x69, 0x4C, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 16, 0x8D5, 0xFFFE, 0x1443AAB405F8A175ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4C, 0xC1, 0x00, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x7FF76E61F43ADE7EULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4C, 0xC1, 0x1B, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0xE1D70B4DE58FB158ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4C, 0xC1, 0x7F, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x273343497FE7D169ULL },
+    { { 0xC4, 0xE3, 0x6D, 0x4C, 0xC1, 0xE4, 0x00, 0x00, }, 6, 1, 32, 0x8D5, 0xFFFE, 0x5A56FE2FF4C4C787ULL },
+    { { 0x66, 0x0F, 0x38, 0xDB, 0xC1, 0x00, 0x00, 0x00, }, 5, 0, 16, 0x8D5, 0xFFFE, 0xF0E1D05F95860795ULL },
+    { { 0x66, 0x0F, 0x38, 0xDC, 0xC1, 0x00, 0x00, 0x00, }, 5, 0, 16, 0x8D5, 0xFFFE, 0xFC7A1AFD7F1C5026ULL },
+    { { 0x66, 0x0F, 0x38, 0xDD, 0xC1, 0x00, 0x00, 0x00, }, 5, 0, 16, 0x8D5, 0xFFFE, 0xC460B844C26EA0F8ULL },
+    { { 0x66, 0x0F, 0x38, 0xDE, 0xC1, 0x00, 0x00, 0x00, }, 5, 0, 16, 0x8D5, 0xFFFE, 0xB3697CCB368D7D6AULL },
+    { { 0x66, 0x0F, 0x38, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 5, 0, 16, 0x8D5, 0xFFFE, 0x9D573CDD92F8489AULL },
+    { { 0x66, 0x0F, 0x3A, 0x44, 0xC1, 0x00, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0xF9385A2932DF2450ULL },
+    { { 0x66, 0x0F, 0x3A, 0x44, 0xC1, 0x1B, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0x48B8E903DEBD9C3AULL },
+    { { 0x66, 0x0F, 0x3A, 0x44, 0xC1, 0x7F, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0x48B8E903DEBD9C3AULL },
+    { { 0x66, 0x0F, 0x3A, 0x44, 0xC1, 0xE4, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0xF9385A2932DF2450ULL },
+    { { 0x66, 0x0F, 0x3A, 0xDF, 0xC1, 0x00, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0x4054A5780CE21CB9ULL },
+    { { 0x66, 0x0F, 0x3A, 0xDF, 0xC1, 0x1B, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0x158949DCA4BAC061ULL },
+    { { 0x66, 0x0F, 0x3A, 0xDF, 0xC1, 0x7F, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0xB300DDCD88C3B211ULL },
+    { { 0x66, 0x0F, 0x3A, 0xDF, 0xC1, 0xE4, 0x00, 0x00, }, 6, 0, 16, 0x8D5, 0xFFFE, 0x4BA128AE44BE5D89ULL },
+};
+
+static const struct selftest_known selftest_known[] = {
+};
+
+#endif /* selftest_vec_h */
@@ -0,0 +1,622 @@
+//
+//  softfloat.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifdef __KERNEL__
+#include <linux/module.h>
+#endif
+
+#include "softfloat.h"
+
+/*********************************************************
+ *** Integer-only IEEE 754 binary32/binary64.          ***
+ *** add, sub, mul, div, sqrt, fused multiply-add and  ***
+ *** conversions, correctly rounded in the four MXCSR  ***
+ *** modes with x86 NaN propagation, DAZ, FTZ and the  ***
+ *** six exception flags. Built -mgeneral-regs-only:   ***
+ *** the arithmetic touches no XMM register. The       ***
+ *** handlers around it still move operands in XMM.    ***
+ *** Unmasked exceptions are not delivered, the flags  ***
+ *** are set as if masked. Compares return the         ***
+ *** relation, the caller's predicate table maps it.   ***
+ *********************************************************/
+
+#ifdef __KERNEL__
+static bool soft_fp;
+module_param(soft_fp, bool, 0444);
+MODULE_PARM_DESC(soft_fp, "Integer softfloat and SWAR kernels instead of host SSE arithmetic");
+
+DEFINE_STATIC_KEY_FALSE(opemu_softfp_key);
+#else
+int opemu_softfp_user;
+#endif
+
+#define SF_IE 0x01
+#define SF_DE 0x02
+#define SF_ZE 0x04
+#define SF_OE 0x08
+#define SF_UE 0x10
+#define SF_PE 0x20
+
+#define SF_RN 0
+#define SF_RD 1
+#define SF_RU 2
+#define SF_RZ 3
+
+#define SF_ZERO   0
+#define SF_NORMAL 1
+#define SF_INF    2
+#define SF_QNAN   3
+#define SF_SNAN   4
+
+typedef unsigned __int128 u128;
+
+struct sf_fmt {
+    int frac;
+    int bias;
+    int emax;
+    int width;
+};
+
+static const struct sf_fmt sf_f32 = { 23, 127, 0xFF, 32 };
+static const struct sf_fmt sf_f64 = { 52, 1023, 0x7FF, 64 };
+
+struct sf_env {
+    int rc;
+    int daz;
+    int ftz;
+    int flags;
+};
+
+//value = sig * 2^(exp - 62), bit 62 of sig set
+struct sf_num {
+    int sign;
+    int exp;
+    uint64_t sig;
+};
+
+static uint32_t sf_getmxcsr(void)
+{
+    uint32_t mxcsr;
+
+    asm __volatile__ ("stmxcsr %0" : "=m" (mxcsr));
+    return mxcsr;
+}
+
+static void sf_env_begin(struct sf_env *env, int rc)
+{
+    uint32_t mxcsr = sf_getmxcsr();
+
+    env->rc = (rc < 0) ? ((mxcsr >> 13) & 3) : rc;
+    env->daz = (mxcsr >> 6) & 1;
+    env->ftz = (mxcsr >> 15) & 1;
+    env->flags = 0;
+}
+
+static void sf_env_end(struct sf_env *env)
+{
+    uint32_t mxcsr;
+
+    //invalid and divide-by-zero are detected before a denormal operand
+    if (env->flags & (SF_IE | SF_ZE))
+        env->flags &= ~SF_DE;
+    if (!env->flags)
+        return;
+    mxcsr = sf_getmxcsr() | env->flags;
+    asm __volatile__ ("ldmxcsr %0" :: "m" (mxcsr));
+}
+
+static inline int sf_clz128(u128 x)
+{
+    uint64_t hi = (uint64_t)(x >> 64);
+
+    return hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((uint64_t)x);
+}
+
+static inline u128 sf_jam128(u128 x, int d)
+{
+    if (d <= 0)
+        return x;
+    if (d >= 128)
+        return x != 0;
+    return (x >> d) | ((x << (128 - d)) != 0);
+}
+
+static inline uint64_t sf_pack(int sign, int exp, uint64_t sig, const struct sf_fmt *f)
+{
+    return ((uint64_t)sign << (f->width - 1)) + ((uint64_t)exp << f->frac) + sig;
+}
+
+static inline uint64_t sf_inf(int sign, const struct sf_fmt *f)
+{
+    return sf_pack(sign, f->emax, 0, f);
+}
+
+static inline uint64_t sf_default_nan(const struct sf_fmt *f)
+{
+    return sf_pack(1, f->emax, 1ULL << (f->frac - 1), f);
+}
+
+static int sf_unpack(uint64_t x, const struct sf_fmt *f, struct sf_env *env, struct sf_num *n)
+{
+    uint64_t frac = x & ((1ULL << f->frac) - 1);
+    int e = (x >> f->frac) & f->emax;
+    int s;
+
+    n->sign = (x >> (f->width - 1)) & 1;
+    if (e == f->emax) {
+        if (!frac)
+            return SF_INF;
+        return ((frac >> (f->frac - 1)) & 1) ? SF_QNAN : SF_SNAN;
+    }
+    if (!e) {
+        if (!frac || env->daz)
+            return SF_ZERO;
+        env->flags |= SF_DE;
+        s = __builtin_clzll(frac) - (63 - f->frac);
+        frac <<= s;
+        e = 1 - s;
+    } else {
+        frac |= 1ULL << f->frac;
+    }
+    n->sig = frac << (62 - f->frac);
+    n->exp = e - f->bias;
+    return SF_NORMAL;
+}
+
+static inline int sf_isnan(int c)
+{
+    return c >= SF_QNAN;
+}
+
+//SSE rule: the first NaN source, quieted
+static uint64_t sf_nan(uint64_t a, int ca, uint64_t b, int cb, const struct sf_fmt *f, struct sf_env *env)
+{
+    //a NaN operand outranks a denormal one
+    env->flags &= ~SF_DE;
+    if ((ca == SF_SNAN) || (cb == SF_SNAN))
+        env->flags |= SF_IE;
+    return (sf_isnan(ca) ? a : b) | (1ULL << (f->frac - 1));
+}
+
+/** Rounds and packs sig * 2^(exp - 62), tininess after rounding like the hardware. **/
+static uint64_t sf_round(int sign, int exp, uint64_t sig, const struct sf_fmt *f, struct sf_env *env)
+{
+    int r = 62 - f->frac;
+    uint64_t half = 1ULL << (r - 1);
+    uint64_t mask = (1ULL << r) - 1;
+    uint64_t inc, bits;
+    int e = exp + f->bias - 1;
+    int tiny;
+
+    switch (env->rc) {
+        case SF_RN: inc = half; break;
+        case SF_RD: inc = sign ? mask : 0; break;
+        case SF_RU: inc = sign ? 0 : mask; break;
+        default:    inc = 0; break;
+    }
+    bits = sig & mask;
+
+    if ((unsigned int)e >= (unsigned int)(f->emax - 2)) {
+        if (e < 0) {
+            tiny = (e < -1) || (sig + inc < SF_SIGN64);
+            if (tiny && env->ftz) {
+                env->flags |= SF_UE | SF_PE;
+                return sf_pack(sign, 0, 0, f);
+            }
+            sig = (uint64_t)sf_jam128(sig, -e);
+            e = 0;
+            bits = sig & mask;
+            if (tiny && bits)
+                env->flags |= SF_UE;
+        } else if ((e > f->emax - 2) || (sig + inc >= SF_SIGN64)) {
+            env->flags |= SF_OE | SF_PE;
+            return sf_inf(sign, f) - !inc;
+        }
+    }
+
+    sig = (sig + inc) >> r;
+    if (bits)
+        env->flags |= SF_PE;
+    if ((env->rc == SF_RN) && (bits == half))
+        sig &= ~1ULL;
+    if (!sig)
+        e = 0;
+    return sf_pack(sign, e, sig, f);
+}
+
+//m * 2^e, m != 0
+static uint64_t sf_round128(int sign, u128 m, int e, const struct sf_fmt *f, struct sf_env *env)
+{
+    int l = 127 - sf_clz128(m);
+    int sh = l - 62;
+    uint64_t sig;
+
+    if (sh > 0)
+        sig = (uint64_t)sf_jam128(m, sh);
+    else
+        sig = (uint64_t)m << -sh;
+    return sf_round(sign, e + l, sig, f, env);
+}
+
+static inline uint64_t sf_exact_zero(const struct sf_env *env, const struct sf_fmt *f)
+{
+    return sf_pack(env->rc == SF_RD, 0, 0, f);
+}
+
+static uint64_t sf_add(uint64_t a, uint64_t b, int negate, const struct sf_fmt *f, struct sf_env *env)
+{
+    struct sf_num x, y, t;
+    int cx = sf_unpack(a, f, env, &x);
+    int cy = sf_unpack(b, f, env, &y);
+    u128 mx, my;
+
+    if (sf_isnan(cx) || sf_isnan(cy))
+        return sf_nan(a, cx, b, cy, f, env);
+    y.sign ^= negate;
+
+    if (cx == SF_INF) {
+        if ((cy == SF_INF) && (x.sign != y.sign)) {
+            env->flags |= SF_IE;
+            return sf_default_nan(f);
+        }
+        return sf_inf(x.sign, f);
+    }
+    if (cy == SF_INF)
+        return sf_inf(y.sign, f);
+    if ((cx == SF_ZERO) && (cy == SF_ZERO))
+        return (x.sign == y.sign) ? sf_pack(x.sign, 0, 0, f) : sf_exact_zero(env, f);
+    if (cx == SF_ZERO)
+        return sf_round(y.sign, y.exp, y.sig, f, env);
+    if (cy == SF_ZERO)
+        return sf_round(x.sign, x.exp, x.sig, f, env);
+
+    if ((y.exp > x.exp) || ((y.exp == x.exp) && (y.sig > x.sig))) {
+        t = x;
+        x = y;
+        y = t;
+    }
+    mx = (u128)x.sig << 64;
+    my = sf_jam128((u128)y.sig << 64, x.exp - y.exp);
+    mx = (x.sign == y.sign) ? mx + my : mx - my;
+    if (!mx)
+        return sf_exact_zero(env, f);
+    return sf_round128(x.sign, mx, x.exp - 126, f, env);
+}
+
+static uint64_t sf_mul(uint64_t a, uint64_t b, const struct sf_fmt *f, struct sf_env *env)
+{
+    struct sf_num x, y;
+    int cx = sf_unpack(a, f, env, &x);
+    int cy = sf_unpack(b, f, env, &y);
+    int sign = x.sign ^ y.sign;
+
+    if (sf_isnan(cx) || sf_isnan(cy))
+        return sf_nan(a, cx, b, cy, f, env);
+    if ((cx == SF_INF) || (cy == SF_INF)) {
+        if ((cx == SF_ZERO) || (cy == SF_ZERO)) {
+            env->flags |= SF_IE;
+            return sf_default_nan(f);
+        }
+        return sf_inf(sign, f);
+    }
+    if ((cx == SF_ZERO) || (cy == SF_ZERO))
+        return sf_pack(sign, 0, 0, f);
+
+    return sf_round128(sign, (u128)x.sig * y.sig, x.exp + y.exp - 124, f, env);
+}
+
+static uint64_t sf_div(uint64_t a, uint64_t b, const struct sf_fmt *f, struct sf_env *env)
+{
+    struct sf_num x, y;
+    int cx = sf_unpack(a, f, env, &x);
+    int cy = sf_unpack(b, f, env, &y);
+    int sign = x.sign ^ y.sign;
+    uint64_t q, r;
+
+    if (sf_isnan(cx) || sf_isnan(cy))
+        return sf_nan(a, cx, b, cy, f, env);
+    if (cx == SF_INF) {
+        if (cy == SF_INF) {
+            env->flags |= SF_IE;
+            return sf_default_nan(f);
+        }
+        return sf_inf(sign, f);
+    }
+    if (cy == SF_INF)
+        return sf_pack(sign, 0, 0, f);
+    if (cy == SF_ZERO) {
+        if (cx == SF_ZERO) {
+            env->flags |= SF_IE;
+            return sf_default_nan(f);
+        }
+        env->flags |= SF_ZE;
+        return sf_inf(sign, f);
+    }
+    if (cx == SF_ZERO)
+        return sf_pack(sign, 0, 0, f);
+
+    //x.sig * 2^62 / y.sig: the high half x.sig >> 2 is below y.sig, no #DE
+    asm ("divq %4" : "=a" (q), "=d" (r) : "a" (x.sig << 62), "d" (x.sig >> 2), "rm" (y.sig));
+    return sf_round128(sign, ((u128)q << 1) | (r != 0), x.exp - y.exp - 63, f, env);
+}
+
+static uint64_t sf_sqrt(uint64_t a, const struct sf_fmt *f, struct sf_env *env)
+{
+    struct sf_num x;
+    int cx = sf_unpack(a, f, env, &x);
+    u128 m, res = 0, one = (u128)1 << 126;
+    int e;
+
+    if (sf_isnan(cx))
+        return sf_nan(a, cx, a, cx, f, env);
+    if (cx == SF_ZERO)
+        return sf_pack(x.sign, 0, 0, f);
+    if (x.sign) {
+        env->flags |= SF_IE;
+        return sf_default_nan(f);
+    }
+    if (cx == SF_INF)
+        return a;
+
+    //m * 2^e with e even, digit by digit: 64 steps, no division
+    m = (u128)x.sig << 64;
+    e = x.exp - 126;
+    if (e & 1) {
+        m <<= 1;
+        e -= 1;
+    }
+    while (one > m)
+        one >>= 2;
+    while (one) {
+        if (m >= res + one) {
+            m -= res + one;
+            res = (res >> 1) + one;
+        } else {
+            res >>= 1;
+        }
+        one >>= 2;
+    }
+    return sf_round128(0, (res << 1) | (m != 0), e / 2 - 1, f, env);
+}
+
+static uint64_t sf_fma(uint64_t a, uint64_t b, uint64_t c, const struct sf_fmt *f, struct sf_env *env)
+{
+    struct sf_num x, y, z;
+    int cx = sf_unpack(a, f, env, &x);
+    int cy = sf_unpack(b, f, env, &y);
+    int cz = sf_unpack(c, f, env, &z);
+    int sign = x.sign ^ y.sign;
+    u128 p, q;
+    int ep, ez;
+
+    if (sf_isnan(cx) || sf_isnan(cy) || sf_isnan(cz)) {
+        if (cz == SF_SNAN)
+            env->flags |= SF_IE;
+        if (sf_isnan(cx) || sf_isnan(cy))
+            return sf_nan(a, cx, b, cy, f, env);
+        return sf_nan(c, cz, c, cz, f, env);
+    }
+    if ((cx == SF_INF) || (cy == SF_INF)) {
+        if ((cx == SF_ZERO) || (cy == SF_ZERO) || ((cz == SF_INF) && (z.sign != sign))) {
+            env->flags |= SF_IE;
+            return sf_default_nan(f);
+        }
+        return sf_inf(sign, f);
+    }
+    if (cz == SF_INF)
+        return sf_inf(z.sign, f);
+    if ((cx == SF_ZERO) || (cy == SF_ZERO)) {
+        if (cz == SF_ZERO)
+            return (sign == z.sign) ? sf_pack(sign, 0, 0, f) : sf_exact_zero(env, f);
+        return sf_round(z.sign, z.exp, z.sig, f, env);
+    }
+
+    //the exact product, 106 bits at most, and the addend on the same scale
+    p = (u128)x.sig * y.sig;
+    ep = x.exp + y.exp - 124;
+    if (cz == SF_ZERO)
+        return sf_round128(sign, p, ep, f, env);
+    q = (u128)z.sig << 62;
+    ez = z.exp - 124;
+
+    if (ep >= ez) {
+        q = sf_jam128(q, ep - ez);
+    } else {
+        p = sf_jam128(p, ez - ep);
+        ep = ez;
+    }
+    if (sign == z.sign)
+        return sf_round128(sign, p + q, ep, f, env);
+    if (p == q)
+        return sf_exact_zero(env, f);
+    if (p > q)
+        return sf_round128(sign, p - q, ep, f, env);
+    return sf_round128(z.sign, q - p, ep, f, env);
+}
+
+static uint64_t sf_op(int op, uint64_t a, uint64_t b, uint64_t c, const struct sf_fmt *f)
+{
+    struct sf_env env;
+    uint64_t r;
+
+    sf_env_begin(&env, -1);
+    switch (op) {
+        case SF_ADD:  r = sf_add(a, b, 0, f, &env); break;
+        case SF_SUB:  r = sf_add(a, b, 1, f, &env); break;
+        case SF_MUL:  r = sf_mul(a, b, f, &env); break;
+        case SF_DIV:  r = sf_div(a, b, f, &env); break;
+        case SF_SQRT: r = sf_sqrt(a, f, &env); break;
+        default:      r = sf_fma(a, b, c, f, &env); break;
+    }
+    sf_env_end(&env);
+    return r;
+}
+
+uint32_t opemu_sf32(int op, uint32_t a, uint32_t b, uint32_t c)
+{
+    return (uint32_t)sf_op(op, a, b, c, &sf_f32);
+}
+
+uint64_t opemu_sf64(int op, uint64_t a, uint64_t b, uint64_t c)
+{
+    return sf_op(op, a, b, c, &sf_f64);
+}
+
+/*********************************************************/
+
+static uint64_t sf_convert(uint64_t a, const struct sf_fmt *from, const struct sf_fmt *to, struct sf_env *env)
+{
+    struct sf_num x;
+    int cx = sf_unpack(a, from, env, &x);
+    uint64_t frac;
+
+    switch (cx) {
+        case SF_ZERO:
+            return sf_pack(x.sign, 0, 0, to);
+        case SF_INF:
+            return sf_inf(x.sign, to);
+        case SF_QNAN:
+        case SF_SNAN:
+            if (cx == SF_SNAN)
+                env->flags |= SF_IE;
+            //keep the payload from the top
+            frac = a & ((1ULL << from->frac) - 1);
+            frac = (to->frac > from->frac) ? (frac << (to->frac - from->frac)) : (frac >> (from->frac - to->frac));
+            return sf_pack(x.sign, to->emax, frac | (1ULL << (to->frac - 1)), to);
+    }
+    return sf_round(x.sign, x.exp, x.sig, to, env);
+}
+
+static uint64_t sf_from_int(int64_t v, const struct sf_fmt *to, struct sf_env *env)
+{
+    uint64_t m = (v < 0) ? -(uint64_t)v : (uint64_t)v;
+
+    if (!m)
+        return 0;
+    return sf_round128(v < 0, m, 0, to, env);
+}
+
+//x86 integer indefinite on NaN or out of range, IE only
+static uint64_t sf_to_int(uint64_t a, const struct sf_fmt *from, int width, struct sf_env *env)
+{
+    const uint64_t indefinite = 1ULL << (width - 1);
+    struct sf_num x;
+    int cx = sf_unpack(a, from, env, &x);
+    u128 m, rest, half;
+    uint64_t whole;
+    int sh, inc = 0;
+
+    //no denormal-operand flag on integer conversions
+    env->flags &= ~SF_DE;
+    if (cx == SF_ZERO)
+        return 0;
+    if ((cx != SF_NORMAL) || (x.exp > 62)) {
+        env->flags |= SF_IE;
+        return indefinite;
+    }
+
+    //sh fraction bits below the integer part, 64 at least
+    m = (u128)x.sig << 64;
+    sh = 126 - x.exp;
+    if (sh > 128) {
+        //below a quarter: inexact, never rounds to nearest upwards
+        whole = 0;
+        rest = 1;
+        half = 2;
+    } else if (sh == 128) {
+        whole = 0;
+        rest = m;
+        half = (u128)1 << 127;
+    } else {
+        whole = (uint64_t)(m >> sh);
+        rest = m & (((u128)1 << sh) - 1);
+        half = (u128)1 << (sh - 1);
+    }
+
+    switch (env->rc) {
+        case SF_RN: inc = (rest > half) || ((rest == half) && (whole & 1)); break;
+        case SF_RD: inc = x.sign && rest; break;
+        case SF_RU: inc = !x.sign && rest; break;
+    }
+    whole += inc;
+
+    if (whole > indefinite - !x.sign) {
+        env->flags |= SF_IE;
+        return indefinite;
+    }
+    if (rest)
+        env->flags |= SF_PE;
+    whole = x.sign ? -whole : whole;
+    return (width == 32) ? (uint32_t)whole : whole;
+}
+
+uint64_t opemu_sf_cvt(int op, uint64_t a, int rc)
+{
+    struct sf_env env;
+    uint64_t r;
+
+    sf_env_begin(&env, rc);
+    switch (op) {
+        case SF_F32_F64: r = sf_convert(a, &sf_f32, &sf_f64, &env); break;
+        case SF_F64_F32: r = sf_convert(a, &sf_f64, &sf_f32, &env); break;
+        case SF_I32_F32: r = sf_from_int((int32_t)a, &sf_f32, &env); break;
+        case SF_I32_F64: r = sf_from_int((int32_t)a, &sf_f64, &env); break;
+        case SF_I64_F32: r = sf_from_int((int64_t)a, &sf_f32, &env); break;
+        case SF_I64_F64: r = sf_from_int((int64_t)a, &sf_f64, &env); break;
+        case SF_F32_I32: r = sf_to_int(a, &sf_f32, 32, &env); break;
+        case SF_F64_I32: r = sf_to_int(a, &sf_f64, 32, &env); break;
+        case SF_F32_I64: r = sf_to_int(a, &sf_f32, 64, &env); break;
+        default:         r = sf_to_int(a, &sf_f64, 64, &env); break;
+    }
+    sf_env_end(&env);
+    return r;
+}
+
+/*********************************************************/
+static int sf_cmp(uint64_t a, uint64_t b, int signaling, const struct sf_fmt *f, struct sf_env *env)
+{
+    uint64_t mag = (1ULL << (f->width - 1)) - 1;
+    struct sf_num x, y;
+    int64_t ka, kb;
+    int ca = sf_unpack(a, f, env, &x);
+    int cb = sf_unpack(b, f, env, &y);
+
+    if (sf_isnan(ca) || sf_isnan(cb)) {
+        env->flags &= ~SF_DE;
+        if (signaling || (ca == SF_SNAN) || (cb == SF_SNAN))
+            env->flags |= SF_IE;
+        return SF_UN;
+    }
+    //sign-magnitude to ordered keys, -0 == +0, DAZ zeros included
+    ka = (ca == SF_ZERO) ? 0 : (int64_t)(a & mag);
+    kb = (cb == SF_ZERO) ? 0 : (int64_t)(b & mag);
+    ka = x.sign ? -ka : ka;
+    kb = y.sign ? -kb : kb;
+    if (ka == kb)
+        return SF_EQ;
+    return (ka < kb) ? SF_LT : SF_GT;
+}
+
+int opemu_sf_cmp(int width, uint64_t a, uint64_t b, int signaling)
+{
+    struct sf_env env;
+    int r;
+
+    sf_env_begin(&env, -1);
+    r = sf_cmp(a, b, signaling, (width == 32) ? &sf_f32 : &sf_f64, &env);
+    sf_env_end(&env);
+    return r;
+}
+
+#ifdef __KERNEL__
+void opemu_softfp_init(void)
+{
+    if (soft_fp)
+        static_branch_enable(&opemu_softfp_key);
+}
+#endif
@@ -0,0 +1,117 @@
+//
+//  softfloat.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef softfloat_h
+#define softfloat_h
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#else
+#include <stdint.h>
+#endif
+
+//opemu_sf32 / opemu_sf64
+#define SF_ADD  0
+#define SF_SUB  1
+#define SF_MUL  2
+#define SF_DIV  3
+#define SF_SQRT 4
+#define SF_FMA  5
+
+//opemu_sf_cvt
+#define SF_F32_F64  0
+#define SF_F64_F32  1
+#define SF_I32_F32  2
+#define SF_I32_F64  3
+#define SF_I64_F32  4
+#define SF_I64_F64  5
+#define SF_F32_I32  6
+#define SF_F64_I32  7
+#define SF_F32_I64  8
+#define SF_F64_I64  9
+
+//opemu_sf_cmp: relation of a to b
+#define SF_LT 0
+#define SF_EQ 1
+#define SF_GT 2
+#define SF_UN 3
+
+#define SF_SIGN32 0x80000000U
+#define SF_SIGN64 0x8000000000000000ULL
+
+#ifdef __KERNEL__
+
+#include <linux/jump_label.h>
+
+DECLARE_STATIC_KEY_FALSE(opemu_softfp_key);
+
+//integer softfloat and SWAR kernels instead of host SSE arithmetic
+#define opemu_softfp()  static_branch_unlikely(&opemu_softfp_key)
+
+void opemu_softfp_init(void);
+
+#else
+
+//userspace stub: switched at run time, opemu-bench runs both
+extern int opemu_softfp_user;
+#define opemu_softfp()  (opemu_softfp_user)
+
+#endif
+
+//IEEE 754 on bit patterns, rounding, DAZ and FTZ from MXCSR, flags ORed into it
+uint32_t opemu_sf32(int op, uint32_t a, uint32_t b, uint32_t c);
+uint64_t opemu_sf64(int op, uint64_t a, uint64_t b, uint64_t c);
+//rc < 0: MXCSR rounding, 0-3: that rounding (3 truncates)
+uint64_t opemu_sf_cvt(int op, uint64_t a, int rc);
+//width 32 or 64, signaling: IE on a QNaN operand too
+int opemu_sf_cmp(int width, uint64_t a, uint64_t b, int signaling);
+
+/** 64-bit SWAR lanes: no carry or borrow crosses a lane. **/
+static inline uint64_t swar_add8(uint64_t a, uint64_t b)
+{
+    const uint64_t h = 0x8080808080808080ULL;
+
+    return ((a & ~h) + (b & ~h)) ^ ((a ^ b) & h);
+}
+
+static inline uint64_t swar_add16(uint64_t a, uint64_t b)
+{
+    const uint64_t h = 0x8000800080008000ULL;
+
+    return ((a & ~h) + (b & ~h)) ^ ((a ^ b) & h);
+}
+
+static inline uint64_t swar_add32(uint64_t a, uint64_t b)
+{
+    const uint64_t h = 0x8000000080000000ULL;
+
+    return ((a & ~h) + (b & ~h)) ^ ((a ^ b) & h);
+}
+
+static inline uint64_t swar_sub8(uint64_t a, uint64_t b)
+{
+    const uint64_t h = 0x8080808080808080ULL;
+
+    return ((a | h) - (b & ~h)) ^ ((a ^ ~b) & h);
+}
+
+static inline uint64_t swar_sub16(uint64_t a, uint64_t b)
+{
+    const uint64_t h = 0x8000800080008000ULL;
+
+    return ((a | h) - (b & ~h)) ^ ((a ^ ~b) & h);
+}
+
+static inline uint64_t swar_sub32(uint64_t a, uint64_t b)
+{
+    const uint64_t h = 0x8000000080000000ULL;
+
+    return ((a | h) - (b & ~h)) ^ ((a ^ ~b) & h);
+}
+
+#endif /* softfloat_h */
@@ -0,0 +1,499 @@
+//
+//  sse2int.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef sse2int_h
+#define sse2int_h
+
+#include "optrap.h"
+
+/*********************************************************
+ *** SSSE3 / SSE4.1 integer operations as SSE2         ***
+ *** sequences on whole 128-bit halves, so a host      ***
+ *** without either runs them branch-free: pmuludq     ***
+ *** and shuffles for pmulld, bias-xor for unsigned    ***
+ *** compares, compare-and-mask blends for min/max,    ***
+ *** sign, abs and blendv, unpacks for the widening    ***
+ *** moves, psadbw on gathered dwords for mpsadbw and  ***
+ *** a pminsw tree for phminposuw. Shifts by count    ***
+ *** take the native psll/psrl/psra, which clear or    ***
+ *** sign-fill past the element width on their own;    ***
+ *** per-lane counts run it once per distinct lane and ***
+ *** blend, or once when every lane is equal. res, a   ***
+ *** and b hold len (16 or 32) bytes, a is the first   ***
+ *** source.                                           ***
+ *********************************************************/
+
+typedef char      sse2_v16qi __attribute__((vector_size(16)));
+typedef uint8_t   sse2_v16qu __attribute__((vector_size(16)));
+typedef short     sse2_v8hi  __attribute__((vector_size(16)));
+typedef uint16_t  sse2_v8hu  __attribute__((vector_size(16)));
+typedef int       sse2_v4si  __attribute__((vector_size(16)));
+typedef uint32_t  sse2_v4su  __attribute__((vector_size(16)));
+typedef long long sse2_v2di  __attribute__((vector_size(16)));
+typedef unsigned long long sse2_v2du __attribute__((vector_size(16)));
+typedef float     sse2_v4sf  __attribute__((vector_size(16)));
+typedef double    sse2_v2df  __attribute__((vector_size(16)));
+
+//mask ? y : x
+#define SSE2_BLEND(x, y, m) (((y) & (m)) | ((x) & ~(m)))
+
+/************* Multiply *************/
+static inline void sse2_pmulld(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    sse2_v4si x, y, ev, od;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        ev = (sse2_v4si)__builtin_ia32_pmuludq128(x, y);
+        od = (sse2_v4si)__builtin_ia32_pmuludq128((sse2_v4si)((sse2_v2du)x >> 32), (sse2_v4si)((sse2_v2du)y >> 32));
+        x = __builtin_ia32_punpckldq128(__builtin_ia32_pshufd(ev, 0x08), __builtin_ia32_pshufd(od, 0x08));
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+//(a * b + 0x4000) >> 15 from the high and low product halves, wrapping like pmulhrsw
+static inline void sse2_pmulhrsw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    sse2_v8hi x, y, hi;
+    sse2_v8hu lo;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        hi = __builtin_ia32_pmulhw128(x, y);
+        lo = (sse2_v8hu)(x * y);
+        x = (sse2_v8hi)(((sse2_v8hu)hi << 1) + (((lo >> 14) + 1) >> 1));
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+//unsigned bytes of a times signed bytes of b, pairs summed with signed saturation
+static inline void sse2_pmaddubsw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    sse2_v8hi x, y, ev, od;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        ev = (x & 0xFF) * ((y << 8) >> 8);
+        od = (sse2_v8hi)((sse2_v8hu)x >> 8) * (y >> 8);
+        x = __builtin_ia32_paddsw128(ev, od);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/************* Horizontal add / sub *************/
+//op: 0 add, 1 sub, 2 add saturated, 3 sub saturated
+static inline void sse2_phw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int op) {
+    sse2_v4si x, y;
+    sse2_v8hi ev, od;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        //words sign-extended in place, packssdw is then exact
+        ev = __builtin_ia32_packssdw128((x << 16) >> 16, (y << 16) >> 16);
+        od = __builtin_ia32_packssdw128(x >> 16, y >> 16);
+        switch (op) {
+            case 0:  ev = ev + od; break;
+            case 1:  ev = ev - od; break;
+            case 2:  ev = __builtin_ia32_paddsw128(ev, od); break;
+            default: ev = __builtin_ia32_psubsw128(ev, od); break;
+        }
+        memcpy(&res[i], &ev, 16);
+    }
+}
+
+static inline void sse2_phd(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int sub) {
+    sse2_v4si x, y, ev, od;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        ev = (sse2_v4si)__builtin_ia32_punpcklqdq128((sse2_v2di)__builtin_ia32_pshufd(x, 0x08),
+                                                     (sse2_v2di)__builtin_ia32_pshufd(y, 0x08));
+        od = (sse2_v4si)__builtin_ia32_punpcklqdq128((sse2_v2di)__builtin_ia32_pshufd(x, 0x0D),
+                                                     (sse2_v2di)__builtin_ia32_pshufd(y, 0x0D));
+        x = sub ? ev - od : ev + od;
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/************* Min / max *************/
+static inline void sse2_minmaxb(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int max, int sign) {
+    sse2_v16qi x, y, m;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        if (!sign) {
+            x = max ? __builtin_ia32_pmaxub128(x, y) : __builtin_ia32_pminub128(x, y);
+        } else {
+            m = max ? (y > x) : (y < x);
+            x = SSE2_BLEND(x, y, m);
+        }
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+static inline void sse2_minmaxw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int max, int sign) {
+    sse2_v8hi x, y, d;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        if (sign) {
+            x = max ? __builtin_ia32_pmaxsw128(x, y) : __builtin_ia32_pminsw128(x, y);
+        } else {
+            //x -us y is x - min(x, y)
+            d = __builtin_ia32_psubusw128(x, y);
+            x = max ? y + d : x - d;
+        }
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+static inline void sse2_minmaxd(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int max, int sign) {
+    sse2_v4si x, y, bx, by, m;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        //bias-xor: unsigned order as signed
+        bx = sign ? x : x ^ (int)0x80000000;
+        by = sign ? y : y ^ (int)0x80000000;
+        m = max ? (by > bx) : (by < bx);
+        x = SSE2_BLEND(x, y, m);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/************* Compare / blend *************/
+static inline void sse2_pcmpeqq(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    sse2_v4si x, y, t;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        t = x == y;
+        t &= __builtin_ia32_pshufd(t, 0xB1);
+        memcpy(&res[i], &t, 16);
+    }
+}
+
+//mask byte bit 7 picks b
+static inline void sse2_pblendvb(uint8_t *res, const uint8_t *a, const uint8_t *b, const uint8_t *mask, int len) {
+    sse2_v16qi x, y, m;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        memcpy(&m, &mask[i], 16);
+        m = m < 0;
+        x = SSE2_BLEND(x, y, m);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/************* Abs / sign *************/
+static inline void sse2_pabs(uint8_t *res, const uint8_t *a, int len, int size) {
+    sse2_v16qi xb;
+    sse2_v8hi xw;
+    sse2_v4si xd;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        if (size == 1) {
+            //-128 stays 0x80 in both
+            memcpy(&xb, &a[i], 16);
+            xb = __builtin_ia32_pminub128(xb, -xb);
+            memcpy(&res[i], &xb, 16);
+        } else if (size == 2) {
+            memcpy(&xw, &a[i], 16);
+            xw = (xw ^ (xw >> 15)) - (xw >> 15);
+            memcpy(&res[i], &xw, 16);
+        } else {
+            memcpy(&xd, &a[i], 16);
+            xd = (xd ^ (xd >> 31)) - (xd >> 31);
+            memcpy(&res[i], &xd, 16);
+        }
+    }
+}
+
+//a negated where b < 0, zeroed where b == 0
+static inline void sse2_psign(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int size) {
+    sse2_v16qi xb, yb;
+    sse2_v8hi xw, yw;
+    sse2_v4si xd, yd;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        if (size == 1) {
+            memcpy(&xb, &a[i], 16);
+            memcpy(&yb, &b[i], 16);
+            xb = ((xb ^ (yb < 0)) - (yb < 0)) & ~(yb == 0);
+            memcpy(&res[i], &xb, 16);
+        } else if (size == 2) {
+            memcpy(&xw, &a[i], 16);
+            memcpy(&yw, &b[i], 16);
+            xw = ((xw ^ (yw < 0)) - (yw < 0)) & ~(yw == 0);
+            memcpy(&res[i], &xw, 16);
+        } else {
+            memcpy(&xd, &a[i], 16);
+            memcpy(&yd, &b[i], 16);
+            xd = ((xd ^ (yd < 0)) - (yd < 0)) & ~(yd == 0);
+            memcpy(&res[i], &xd, 16);
+        }
+    }
+}
+
+/************* Pack / widen *************/
+//clamp to 0-65535, bias into packssdw range and back
+static inline void sse2_packusdw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    sse2_v4si x, y;
+    sse2_v8hi r;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        x &= ~(x < 0);
+        y &= ~(y < 0);
+        x = SSE2_BLEND(x, 0xFFFF, x > 0xFFFF) - 0x8000;
+        y = SSE2_BLEND(y, 0xFFFF, y > 0xFFFF) - 0x8000;
+        r = __builtin_ia32_packssdw128(x, y) ^ (short)0x8000;
+        memcpy(&res[i], &r, 16);
+    }
+}
+
+//one unpack-low step from size to 2 * size, sign or zero filled
+static inline sse2_v16qi sse2_widen(sse2_v16qi x, int size, int sign) {
+    sse2_v4si d;
+
+    switch (size) {
+        case 1:
+            if (!sign)
+                return __builtin_ia32_punpcklbw128(x, (sse2_v16qi){ 0 });
+            return (sse2_v16qi)((sse2_v8hi)__builtin_ia32_punpcklbw128(x, x) >> 8);
+        case 2:
+            if (!sign)
+                return (sse2_v16qi)__builtin_ia32_punpcklwd128((sse2_v8hi)x, (sse2_v8hi){ 0 });
+            return (sse2_v16qi)((sse2_v4si)__builtin_ia32_punpcklwd128((sse2_v8hi)x, (sse2_v8hi)x) >> 16);
+        default:
+            d = (sse2_v4si)x;
+            return (sse2_v16qi)__builtin_ia32_punpckldq128(d, sign ? d >> 31 : (sse2_v4si){ 0 });
+    }
+}
+
+//vpmovzx/sx: size-byte elements of a to dsize bytes
+static inline void sse2_pmovx(uint8_t *res, const uint8_t *a, int len, int size, int dsize, int sign) {
+    sse2_v16qi x;
+    int i, s;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i * size / dsize], 16);
+        for (s = size; s < dsize; s *= 2)
+            x = sse2_widen(x, s, sign);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+/************* SAD / average *************/
+static inline void sse2_psadbw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len) {
+    sse2_v16qi x, y;
+    sse2_v2di r;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        r = __builtin_ia32_psadbw128(x, y);
+        memcpy(&res[i], &r, 16);
+    }
+}
+
+static inline void sse2_pavg(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int size) {
+    sse2_v16qi xb, yb;
+    sse2_v8hi xw, yw;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        if (size == 1) {
+            memcpy(&xb, &a[i], 16);
+            memcpy(&yb, &b[i], 16);
+            xb = __builtin_ia32_pavgb128(xb, yb);
+            memcpy(&res[i], &xb, 16);
+        } else {
+            memcpy(&xw, &a[i], 16);
+            memcpy(&yw, &b[i], 16);
+            xw = __builtin_ia32_pavgw128(xw, yw);
+            memcpy(&res[i], &xw, 16);
+        }
+    }
+}
+
+//per half: word k is the 4-byte SAD of a[o1 + k] against b[o2], o1 and o2
+//from imm bits 2 and 1:0 (5 and 4:3 for the upper half); psadbw on the
+//windows k and k + 4 placed in the low dword of each qword
+static inline void sse2_mpsadbw(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, uint8_t imm) {
+    uint32_t w, p, q;
+    sse2_v4su x, y;
+    sse2_v2di s, r;
+    int i, k, o1;
+
+    for (i = 0; i < len; i += 16, imm >>= 3) {
+        o1 = i + ((imm >> 2) & 1) * 4;
+        memcpy(&w, &b[i + (imm & 3) * 4], 4);
+        y = (sse2_v4su){ w, 0, w, 0 };
+        r = (sse2_v2di){ 0 };
+        for (k = 0; k < 4; ++k) {
+            memcpy(&p, &a[o1 + k], 4);
+            memcpy(&q, &a[o1 + k + 4], 4);
+            x = (sse2_v4su){ p, 0, q, 0 };
+            s = __builtin_ia32_psadbw128((sse2_v16qi)x, (sse2_v16qi)y);
+            r |= s << (k * 16);
+        }
+        memcpy(&res[i], &r, 16);
+    }
+}
+
+//unsigned minimum word and its lowest index: bias into pminsw range, fold
+//the halves, then the same tree over the indexes of the words equal to it
+static inline void sse2_phminposuw(uint8_t *res, const uint8_t *a) {
+    const sse2_v8hi idx = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const sse2_v8hi none = { 8, 8, 8, 8, 8, 8, 8, 8 };
+    sse2_v8hi x, m, n;
+
+    memcpy(&x, a, 16);
+    x ^= (short)0x8000;
+    m = __builtin_ia32_pminsw128(x, (sse2_v8hi)__builtin_ia32_pshufd((sse2_v4si)x, 0x4E));
+    m = __builtin_ia32_pminsw128(m, (sse2_v8hi)__builtin_ia32_pshufd((sse2_v4si)m, 0xB1));
+    m = __builtin_ia32_pminsw128(m, __builtin_ia32_pshuflw(__builtin_ia32_pshufhw(m, 0xB1), 0xB1));
+    n = SSE2_BLEND(none, idx, x == m);
+    n = __builtin_ia32_pminsw128(n, (sse2_v8hi)__builtin_ia32_pshufd((sse2_v4si)n, 0x4E));
+    n = __builtin_ia32_pminsw128(n, (sse2_v8hi)__builtin_ia32_pshufd((sse2_v4si)n, 0xB1));
+    n = __builtin_ia32_pminsw128(n, __builtin_ia32_pshuflw(n, 0xB1));
+    x = (sse2_v8hi){ m[0] ^ (short)0x8000, n[0], 0, 0, 0, 0, 0, 0 };
+    memcpy(res, &x, 16);
+}
+
+/************* Shift *************/
+//op: 0 left, 1 right logical, 2 right arithmetic (words and dwords only);
+//c is the whole 64-bit count, so no clamping before the shift
+static inline sse2_v2di sse2_shift_half(sse2_v2di x, sse2_v2di c, int size, int op) {
+    switch (size * 4 + op) {
+        case 8:  return (sse2_v2di)__builtin_ia32_psllw128((sse2_v8hi)x, (sse2_v8hi)c);
+        case 9:  return (sse2_v2di)__builtin_ia32_psrlw128((sse2_v8hi)x, (sse2_v8hi)c);
+        case 10: return (sse2_v2di)__builtin_ia32_psraw128((sse2_v8hi)x, (sse2_v8hi)c);
+        case 16: return (sse2_v2di)__builtin_ia32_pslld128((sse2_v4si)x, (sse2_v4si)c);
+        case 17: return (sse2_v2di)__builtin_ia32_psrld128((sse2_v4si)x, (sse2_v4si)c);
+        case 18: return (sse2_v2di)__builtin_ia32_psrad128((sse2_v4si)x, (sse2_v4si)c);
+        case 32: return __builtin_ia32_psllq128(x, c);
+        default: return __builtin_ia32_psrlq128(x, c);
+    }
+}
+
+static inline void sse2_shift(uint8_t *res, const uint8_t *a, int len, int size, int op, uint64_t count) {
+    sse2_v2di x, c = { (long long)count, 0 };
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        x = sse2_shift_half(x, c, size, op);
+        memcpy(&res[i], &x, 16);
+    }
+}
+
+//vpsllv/vpsrlv/vpsrav: dword or qword lanes of a shifted by the same lanes
+//of b; one shift when the counts of a half are all equal, else one per lane
+//with that lane's count, zero-extended, kept under its mask
+static inline void sse2_shiftv(uint8_t *res, const uint8_t *a, const uint8_t *b, int len, int size, int op) {
+    static const sse2_v4si lane_d[4] = { { -1, 0, 0, 0 }, { 0, -1, 0, 0 }, { 0, 0, -1, 0 }, { 0, 0, 0, -1 } };
+    static const sse2_v2di lane_q[2] = { { -1, 0 }, { 0, -1 } };
+    sse2_v2di x, r, c;
+    sse2_v4si y, m;
+    int i, k;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        if (size == 4) {
+            m = __builtin_ia32_pcmpeqd128(y, __builtin_ia32_pshufd(y, 0x00));
+            if (__builtin_ia32_pmovmskb128((sse2_v16qi)m) == 0xFFFF) {
+                c = (sse2_v2di)(y & lane_d[0]);
+                r = sse2_shift_half(x, c, 4, op);
+            } else {
+                r = (sse2_v2di){ 0 };
+                for (k = 0; k < 4; ++k) {
+                    c = (sse2_v2di){ (uint32_t)y[k], 0 };
+                    r |= sse2_shift_half(x, c, 4, op) & (sse2_v2di)lane_d[k];
+                }
+            }
+        } else {
+            m = __builtin_ia32_pcmpeqd128(y, __builtin_ia32_pshufd(y, 0x44));
+            if (__builtin_ia32_pmovmskb128((sse2_v16qi)m) == 0xFFFF) {
+                r = sse2_shift_half(x, (sse2_v2di)y, 8, op);
+            } else {
+                r = sse2_shift_half(x, (sse2_v2di)y, 8, op) & lane_q[0];
+                c = __builtin_ia32_punpckhqdq128((sse2_v2di)y, (sse2_v2di)y);
+                r |= sse2_shift_half(x, c, 8, op) & lane_q[1];
+            }
+        }
+        memcpy(&res[i], &r, 16);
+    }
+}
+
+/************* Sign mask / test *************/
+//sign bit of every size-byte lane, lane 0 in bit 0
+static inline uint32_t sse2_movmsk(const uint8_t *a, int len, int size) {
+    sse2_v2di x;
+    uint32_t m = 0;
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        switch (size) {
+            case 1:  m |= (uint32_t)__builtin_ia32_pmovmskb128((sse2_v16qi)x) << i; break;
+            case 4:  m |= (uint32_t)__builtin_ia32_movmskps((sse2_v4sf)x) << (i / 4); break;
+            default: m |= (uint32_t)__builtin_ia32_movmskpd((sse2_v2df)x) << (i / 8); break;
+        }
+    }
+    return m;
+}
+
+//ptest (size 1, every bit) or vtestps/pd (size 4 or 8, sign bits): ZF when
+//a & b is clear, CF when a & ~b is clear, in their EFLAGS positions
+static inline unsigned long sse2_ptest(const uint8_t *a, const uint8_t *b, int len, int size) {
+    sse2_v2di x, y, z = { 0 }, c = { 0 };
+    int i;
+
+    for (i = 0; i < len; i += 16) {
+        memcpy(&x, &a[i], 16);
+        memcpy(&y, &b[i], 16);
+        z |= x & y;
+        c |= x & ~y;
+    }
+    //any bit: a dword that is not zero gets its sign bit
+    if (size == 1) {
+        z = ~(sse2_v2di)__builtin_ia32_pcmpeqd128((sse2_v4si)z, (sse2_v4si){ 0 });
+        c = ~(sse2_v2di)__builtin_ia32_pcmpeqd128((sse2_v4si)c, (sse2_v4si){ 0 });
+        size = 4;
+    }
+    return (unsigned long)(sse2_movmsk((uint8_t *)&z, 16, size) == 0) << 6 |
+           (sse2_movmsk((uint8_t *)&c, 16, size) == 0);
+}
+
+#endif /* sse2int_h */
@@ -0,0 +1,295 @@
+//
+//  stats.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/hash.h>
+#include <linux/hashtable.h>
+#include <linux/mm.h>
+#include <linux/rculist.h>
+#include <linux/sched.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/uaccess.h>
+#include <linux/version.h>
+
+#include "stats.h"
+
+/*********************************************************
+ *** Per-process stats page, mapped read-only into the ***
+ *** process like vvar. The trap path finds the        ***
+ *** process under RCU and the thread's slot through a ***
+ *** tid hash, then updates the slot with plain stores ***
+ *** inside a sequence count; readers retry on an odd  ***
+ *** or changed count. Only a new thread and the page  ***
+ *** totals take the process' own lock.                ***
+ *********************************************************/
+
+struct stats_proc {
+    struct hlist_node node;
+    struct rcu_head rcu;
+    struct mm_struct *mm;
+    pid_t tgid;
+    int refs;               //mapped vmas, under stats_lock
+    struct opemu_stats_page *page;
+    spinlock_t lock;        //new slots, page totals
+    //tid hash, open addressing: slot index + 1, 0 is free
+    uint8_t slots[1 << STATS_TID_BITS];
+};
+
+//keyed by mm, looked up under RCU on every trap
+static DEFINE_HASHTABLE(stats_hash, STATS_BITS);
+static int stats_count;
+static DEFINE_SPINLOCK(stats_lock);
+
+static struct stats_proc *stats_find(struct mm_struct *mm)
+{
+    struct stats_proc *sp;
+
+    hash_for_each_possible_rcu(stats_hash, sp, node, hash_ptr(mm, STATS_BITS)) {
+        if ((sp->mm == mm) && (sp->tgid == current->tgid))
+            return sp;
+    }
+    return NULL;
+}
+
+static void stats_free(struct rcu_head *rcu)
+{
+    struct stats_proc *sp = container_of(rcu, struct stats_proc, rcu);
+
+    //the mapping holds its own page reference until it is zapped
+    free_page((unsigned long)sp->page);
+    kfree(sp);
+}
+
+//mremap copies the vma before closing the old one
+static void stats_vm_open(struct vm_area_struct *vma)
+{
+    struct stats_proc *sp = vma->vm_private_data;
+
+    spin_lock(&stats_lock);
+    sp->refs++;
+    spin_unlock(&stats_lock);
+}
+
+static void stats_vm_close(struct vm_area_struct *vma)
+{
+    struct stats_proc *sp = vma->vm_private_data;
+    int last;
+
+    spin_lock(&stats_lock);
+    last = (--sp->refs == 0);
+    if (last) {
+        hash_del_rcu(&sp->node);
+        WRITE_ONCE(stats_count, stats_count - 1);
+    }
+    spin_unlock(&stats_lock);
+
+    if (last)
+        call_rcu(&sp->rcu, stats_free);
+}
+
+static const struct vm_operations_struct stats_vm_ops = {
+    .open = stats_vm_open,
+    .close = stats_vm_close,
+};
+
+int opemu_stats_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    struct opemu_stats_page *page;
+    struct stats_proc *sp, *new;
+    int err;
+
+    BUILD_BUG_ON(sizeof(struct opemu_stats_page) > PAGE_SIZE);
+    BUILD_BUG_ON(OPEMU_STATS_THREADS >= (1 << STATS_TID_BITS));
+
+    if ((vma->vm_end - vma->vm_start != PAGE_SIZE) || vma->vm_pgoff)
+        return -EINVAL;
+    if (vma->vm_flags & VM_WRITE)
+        return -EPERM;
+
+    new = kzalloc(sizeof(*new), GFP_KERNEL);
+    page = (struct opemu_stats_page *)get_zeroed_page(GFP_KERNEL);
+    if (!new || !page) {
+        kfree(new);
+        if (page)
+            free_page((unsigned long)page);
+        return -ENOMEM;
+    }
+    page->magic = OPEMU_STATS_MAGIC;
+    new->mm = vma->vm_mm;
+    new->tgid = current->tgid;
+    new->page = page;
+    spin_lock_init(&new->lock);
+
+    spin_lock(&stats_lock);
+    sp = stats_find(vma->vm_mm);
+    if (!sp) {
+        if (stats_count >= STATS_MAX_PROCS) {
+            spin_unlock(&stats_lock);
+            stats_free(&new->rcu);
+            return -ENOSPC;
+        }
+        sp = new;
+        new = NULL;
+        hash_add_rcu(stats_hash, &sp->node, hash_ptr(sp->mm, STATS_BITS));
+        WRITE_ONCE(stats_count, stats_count + 1);
+    }
+    //another mapping of the same page
+    sp->refs++;
+    spin_unlock(&stats_lock);
+
+    if (new)
+        stats_free(&new->rcu);
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6,3,0)
+    vm_flags_mod(vma, VM_DONTCOPY | VM_DONTEXPAND | VM_DONTDUMP, VM_MAYWRITE);
+#else
+    vma->vm_flags |= VM_DONTCOPY | VM_DONTEXPAND | VM_DONTDUMP;
+    vma->vm_flags &= ~VM_MAYWRITE;
+#endif
+    vma->vm_ops = &stats_vm_ops;
+    vma->vm_private_data = sp;
+
+    err = vm_insert_page(vma, vma->vm_start, virt_to_page(sp->page));
+    if (err)
+        stats_vm_close(vma);
+    return err;
+}
+
+int opemu_stats_active(void)
+{
+    return READ_ONCE(stats_count) != 0;
+}
+
+/** Opcode id of the instruction at RIP, see OPEMU_OPCODE_ID. **/
+uint32_t opemu_stats_opcode(struct pt_regs *regs)
+{
+    uint8_t code[8];
+    uint8_t *bytep = code;
+
+    if (copy_from_user(code, (void __user *)regs->ip, sizeof(code)))
+        return 0;
+
+    if (*bytep == 0xC4)
+        return OPEMU_OPCODE_ID(1, bytep[1] & 0x3, bytep[3]);
+    if (*bytep == 0xC5)
+        return OPEMU_OPCODE_ID(1, 1, bytep[2]);
+
+    while ((*bytep == 0x66) || (*bytep == 0xF2) || (*bytep == 0xF3) || (*bytep == 0x67))
+        bytep++;
+    if ((*bytep & 0xF0) == 0x40)
+        bytep++;
+    if (bytep > &code[5])
+        return 0;
+    if (bytep[0] != 0x0F)
+        return OPEMU_OPCODE_ID(0, 0, bytep[0]);
+    if (bytep[1] == 0x38)
+        return OPEMU_OPCODE_ID(0, 2, bytep[2]);
+    if (bytep[1] == 0x3A)
+        return OPEMU_OPCODE_ID(0, 3, bytep[2]);
+    return OPEMU_OPCODE_ID(0, 1, bytep[1]);
+}
+
+//space-saving top-k: unknown ids replace the least counted entry
+static void stats_top(struct opemu_stats_top *top, uint32_t opcode)
+{
+    int i, min = 0;
+
+    for (i = 0; i < OPEMU_STATS_TOP; i++) {
+        if (top[i].count && (top[i].id == opcode)) {
+            top[i].count++;
+            return;
+        }
+        if (top[i].count < top[min].count)
+            min = i;
+    }
+    top[min].id = opcode;
+    top[min].count++;
+}
+
+/** The current thread's slot, NULL once the page is full. **/
+static struct opemu_stats_thread *stats_slot(struct stats_proc *sp)
+{
+    struct opemu_stats_page *page = sp->page;
+    uint32_t mask = (1 << STATS_TID_BITS) - 1;
+    uint32_t h = hash_32(current->pid, STATS_TID_BITS);
+    uint32_t n;
+    int idx;
+
+    for (n = 0; n <= mask; n++, h = (h + 1) & mask) {
+        idx = READ_ONCE(sp->slots[h]);
+        if (!idx)
+            break;
+        //a reused tid takes over the slot
+        if (page->threads[idx - 1].tid == current->pid)
+            return &page->threads[idx - 1];
+    }
+
+    //first trap of this thread: h is the free entry, unless another thread took it meanwhile
+    spin_lock(&sp->lock);
+    while (sp->slots[h]) {
+        idx = sp->slots[h];
+        if (page->threads[idx - 1].tid == current->pid) {
+            spin_unlock(&sp->lock);
+            return &page->threads[idx - 1];
+        }
+        h = (h + 1) & mask;
+    }
+    if (page->nthreads >= OPEMU_STATS_THREADS) {
+        spin_unlock(&sp->lock);
+        return NULL;
+    }
+    idx = page->nthreads;
+    page->threads[idx].tid = current->pid;
+    smp_wmb();
+    WRITE_ONCE(page->nthreads, idx + 1);
+    WRITE_ONCE(sp->slots[h], idx + 1);
+    spin_unlock(&sp->lock);
+
+    return &page->threads[idx];
+}
+
+/** Called after each handled trap of the current thread. **/
+void opemu_stats_account(uint32_t opcode, uint64_t count, uint64_t cycles)
+{
+    struct opemu_stats_thread *slot;
+    struct opemu_stats_page *page;
+    struct stats_proc *sp;
+
+    rcu_read_lock();
+    sp = stats_find(current->mm);
+    if (!sp) {
+        rcu_read_unlock();
+        return;
+    }
+    page = sp->page;
+
+    //only this thread writes its slot
+    slot = stats_slot(sp);
+    if (slot) {
+        WRITE_ONCE(slot->seq, slot->seq + 1);
+        smp_wmb();
+        slot->traps++;
+        slot->instructions += count;
+        slot->cycles += cycles;
+        stats_top(slot->top, opcode);
+        smp_wmb();
+        WRITE_ONCE(slot->seq, slot->seq + 1);
+    }
+
+    spin_lock(&sp->lock);
+    WRITE_ONCE(page->seq, page->seq + 1);
+    smp_wmb();
+    page->traps++;
+    page->instructions += count;
+    page->cycles += cycles;
+    smp_wmb();
+    WRITE_ONCE(page->seq, page->seq + 1);
+    spin_unlock(&sp->lock);
+
+    rcu_read_unlock();
+}
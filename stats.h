@@ -0,0 +1,28 @@
+//
+//  stats.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef stats_h
+#define stats_h
+
+#include <linux/fs.h>
+#include <linux/mm.h>
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+
+//Processes with a mapped stats page
+#define STATS_MAX_PROCS 64
+#define STATS_BITS      6
+#define STATS_TID_BITS  7
+
+int opemu_stats_mmap(struct file *file, struct vm_area_struct *vma);
+int opemu_stats_active(void);
+uint32_t opemu_stats_opcode(struct pt_regs *regs);
+void opemu_stats_account(uint32_t opcode, uint64_t count, uint64_t cycles);
+
+#endif /* stats_h */
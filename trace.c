@@ -0,0 +1,371 @@
+//
+//  trace.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/debugfs.h>
+#include <linux/module.h>
+#include <linux/mutex.h>
+#include <linux/percpu.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/uaccess.h>
+#include <linux/vmalloc.h>
+
+#include "optrap.h"
+#include "trace.h"
+#include "opdev.h"
+
+/*********************************************************
+ *** Emulation trace recorder.                         ***
+ *** The trap path snapshots the registers before and  ***
+ *** after opemu_utrap, plus a window at the first     ***
+ *** memory operand the decoder computes, and queues   ***
+ *** single-instruction traps in a per-CPU ring. A     ***
+ *** trap builds its record in the CPU's preallocated  ***
+ *** scratch; a full ring, or a scratch still held by  ***
+ *** a preempted trap, drops it. Userspace drains      ***
+ *** whole records from debugfs opemu/trace and feeds  ***
+ *** them to opemu-replay.                             ***
+ *********************************************************/
+
+DEFINE_STATIC_KEY_FALSE(opemu_trace_key);
+
+struct trace_ring {
+    spinlock_t lock;
+    uint32_t head;          //next write
+    uint32_t tail;          //next read
+    uint64_t lost;          //ring full or scratch busy
+    uint64_t skipped;       //loop/fused traps, not replayable
+    struct opemu_trace_rec *recs;
+};
+
+//record of the task trapping on this CPU, for trace_mem deep in the decoder
+struct trace_pending {
+    struct task_struct *owner;      //holds scratch, NULL when free
+    struct opemu_trace_rec *rec;
+    struct opemu_trace_rec *scratch;
+};
+
+static struct trace_ring __percpu *trace_rings;
+static struct trace_pending __percpu *trace_pending;
+static struct dentry *trace_files[3];
+static int trace_allocated;
+static DEFINE_MUTEX(trace_mutex);
+
+//registers only through asm and GPR copies, user XMM state is live
+static void trace_state(struct opemu_trace_state *state, struct pt_regs *regs)
+{
+    int n;
+
+    state->regs.r15 = regs->r15;
+    state->regs.r14 = regs->r14;
+    state->regs.r13 = regs->r13;
+    state->regs.r12 = regs->r12;
+    state->regs.bp = regs->bp;
+    state->regs.bx = regs->bx;
+    state->regs.r11 = regs->r11;
+    state->regs.r10 = regs->r10;
+    state->regs.r9 = regs->r9;
+    state->regs.r8 = regs->r8;
+    state->regs.ax = regs->ax;
+    state->regs.cx = regs->cx;
+    state->regs.dx = regs->dx;
+    state->regs.si = regs->si;
+    state->regs.di = regs->di;
+    state->regs.orig_ax = regs->orig_ax;
+    state->regs.ip = regs->ip;
+    state->regs.cs = regs->cs;
+    state->regs.flags = regs->flags;
+    state->regs.sp = regs->sp;
+    state->regs.ss = regs->ss;
+
+    for (n = 0; n < 16; n++) {
+        _store_xmm(n, (XMM*)&state->ymm[n][0]);
+        _copy_u128(&state->ymm[n][16], &_vymm(n)->u128[1]);
+    }
+}
+
+//the trap that held the scratch may end on another CPU
+static void trace_release(struct trace_pending *tp)
+{
+    WRITE_ONCE(tp->rec, NULL);
+    smp_store_release(&tp->owner, NULL);
+}
+
+struct opemu_trace_rec *__opemu_trace_begin(struct pt_regs *regs)
+{
+    struct opemu_trace_rec *rec;
+    struct trace_pending *tp;
+    struct trace_ring *ring;
+    int cpu;
+
+    if (!is_saved_state64(regs))
+        return NULL;
+
+    //claim this CPU's scratch, a trap preempted in its own still holds it
+    cpu = get_cpu();
+    tp = per_cpu_ptr(trace_pending, cpu);
+    if (cmpxchg(&tp->owner, NULL, current) != NULL) {
+        ring = per_cpu_ptr(trace_rings, cpu);
+        spin_lock(&ring->lock);
+        ring->lost++;
+        spin_unlock(&ring->lock);
+        put_cpu();
+        return NULL;
+    }
+    put_cpu();
+
+    rec = tp->scratch;
+    memset(rec, 0, offsetof(struct opemu_trace_rec, pre));
+    rec->magic = OPEMU_TRACE_MAGIC;
+    rec->size = sizeof(*rec);
+    rec->cpu = cpu;
+    if (copy_from_user(rec->ins, (void __user *)regs->ip, sizeof(rec->ins))) {
+        trace_release(tp);
+        return NULL;
+    }
+    trace_state(&rec->pre, regs);
+    WRITE_ONCE(tp->rec, rec);
+
+    return rec;
+}
+
+void __opemu_trace_mem(uint64_t addr)
+{
+    struct opemu_trace_rec *rec = NULL;
+    struct trace_pending *tp;
+    uint32_t len;
+
+    tp = get_cpu_ptr(trace_pending);
+    if (tp->owner == current)
+        rec = READ_ONCE(tp->rec);
+    put_cpu_ptr(trace_pending);
+
+    //the record belongs to our own trap frame, alive until trace_end
+    if (!rec || rec->mem_len)
+        return;
+
+    len = min_t(uint32_t, OPEMU_TRACE_MEM, PAGE_SIZE - (addr & ~PAGE_MASK));
+    if (copy_from_user(rec->pre.mem, (void __user *)addr, len))
+        return;
+    rec->mem_addr = addr;
+    rec->mem_len = len;
+}
+
+void __opemu_trace_end(struct opemu_trace_rec *rec, struct pt_regs *regs, int count)
+{
+    struct trace_pending *tp = per_cpu_ptr(trace_pending, rec->cpu);
+    struct trace_ring *ring;
+
+    WRITE_ONCE(tp->rec, NULL);
+
+    if (count == 1) {
+        trace_state(&rec->post, regs);
+        if (rec->mem_len && copy_from_user(rec->post.mem, (void __user *)rec->mem_addr, rec->mem_len))
+            count = 0;
+    }
+
+    ring = get_cpu_ptr(trace_rings);
+    spin_lock(&ring->lock);
+    if (count != 1) {
+        if (count)
+            ring->skipped++;
+    } else if (ring->head - ring->tail >= TRACE_RING) {
+        ring->lost++;
+    } else {
+        rec->cpu = smp_processor_id();
+        memcpy(&ring->recs[ring->head % TRACE_RING], rec, sizeof(*rec));
+        ring->head++;
+    }
+    spin_unlock(&ring->lock);
+    put_cpu_ptr(trace_rings);
+
+    trace_release(tp);
+}
+
+/**********************************************/
+/**  debugfs                                 **/
+/**********************************************/
+static ssize_t trace_read(struct file *file, char __user *buf, size_t len, loff_t *ppos)
+{
+    struct opemu_trace_rec *rec;
+    struct trace_ring *ring;
+    size_t done = 0;
+    int cpu, got;
+
+    if (len < sizeof(*rec))
+        return -EINVAL;
+    if (!READ_ONCE(trace_allocated))
+        return 0;
+
+    rec = kmalloc(sizeof(*rec), GFP_KERNEL);
+    if (!rec)
+        return -ENOMEM;
+
+    for_each_possible_cpu(cpu) {
+        ring = per_cpu_ptr(trace_rings, cpu);
+        while (len - done >= sizeof(*rec)) {
+            got = 0;
+            spin_lock(&ring->lock);
+            if (ring->tail != ring->head) {
+                memcpy(rec, &ring->recs[ring->tail % TRACE_RING], sizeof(*rec));
+                ring->tail++;
+                got = 1;
+            }
+            spin_unlock(&ring->lock);
+
+            if (!got)
+                break;
+            if (copy_to_user(buf + done, rec, sizeof(*rec))) {
+                kfree(rec);
+                return done ? done : -EFAULT;
+            }
+            done += sizeof(*rec);
+        }
+    }
+
+    kfree(rec);
+    return done;
+}
+
+static const struct file_operations trace_fops = {
+    .owner  = THIS_MODULE,
+    .read   = trace_read,
+    .llseek = noop_llseek,
+};
+
+static int trace_stat_show(struct seq_file *m, void *v)
+{
+    struct trace_ring *ring;
+    int cpu;
+
+    seq_printf(m, "enabled %d\n", static_key_enabled(&opemu_trace_key));
+    if (!READ_ONCE(trace_allocated))
+        return 0;
+
+    seq_puts(m, "cpu queued lost skipped\n");
+    for_each_possible_cpu(cpu) {
+        ring = per_cpu_ptr(trace_rings, cpu);
+        spin_lock(&ring->lock);
+        seq_printf(m, "%d %u %llu %llu\n", cpu, ring->head - ring->tail,
+                   (unsigned long long)ring->lost, (unsigned long long)ring->skipped);
+        spin_unlock(&ring->lock);
+    }
+    return 0;
+}
+
+static int trace_stat_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, trace_stat_show, NULL);
+}
+
+static const struct file_operations trace_stat_fops = {
+    .owner   = THIS_MODULE,
+    .open    = trace_stat_open,
+    .read    = seq_read,
+    .llseek  = seq_lseek,
+    .release = single_release,
+};
+
+//rings and scratch records are allocated on first enable and kept until unload
+static int trace_alloc(void)
+{
+    struct trace_pending *tp;
+    struct trace_ring *ring;
+    int cpu;
+
+    if (trace_allocated)
+        return 0;
+
+    for_each_possible_cpu(cpu) {
+        ring = per_cpu_ptr(trace_rings, cpu);
+        tp = per_cpu_ptr(trace_pending, cpu);
+        if (!ring->recs)
+            ring->recs = vmalloc(TRACE_RING * sizeof(struct opemu_trace_rec));
+        if (!tp->scratch)
+            tp->scratch = vmalloc(sizeof(struct opemu_trace_rec));
+        if (!ring->recs || !tp->scratch)
+            return -ENOMEM;
+    }
+    WRITE_ONCE(trace_allocated, 1);
+    return 0;
+}
+
+static ssize_t trace_enable_read(struct file *file, char __user *buf, size_t len, loff_t *ppos)
+{
+    char state[2] = { static_key_enabled(&opemu_trace_key) ? '1' : '0', '\n' };
+
+    return simple_read_from_buffer(buf, len, ppos, state, sizeof(state));
+}
+
+static ssize_t trace_enable_write(struct file *file, const char __user *buf, size_t len, loff_t *ppos)
+{
+    bool enable;
+    int err;
+
+    err = kstrtobool_from_user(buf, len, &enable);
+    if (err)
+        return err;
+
+    mutex_lock(&trace_mutex);
+    if (enable && !static_key_enabled(&opemu_trace_key)) {
+        err = trace_alloc();
+        if (!err)
+            static_branch_enable(&opemu_trace_key);
+    } else if (!enable && static_key_enabled(&opemu_trace_key)) {
+        static_branch_disable(&opemu_trace_key);
+    }
+    mutex_unlock(&trace_mutex);
+
+    return err ? err : len;
+}
+
+static const struct file_operations trace_enable_fops = {
+    .owner  = THIS_MODULE,
+    .read   = trace_enable_read,
+    .write  = trace_enable_write,
+    .llseek = default_llseek,
+};
+
+int opemu_trace_init(void)
+{
+    int cpu;
+
+    trace_rings = alloc_percpu(struct trace_ring);
+    trace_pending = alloc_percpu(struct trace_pending);
+    if (!trace_rings || !trace_pending) {
+        free_percpu(trace_rings);
+        free_percpu(trace_pending);
+        return -ENOMEM;
+    }
+    for_each_possible_cpu(cpu)
+        spin_lock_init(&per_cpu_ptr(trace_rings, cpu)->lock);
+
+    trace_files[0] = debugfs_create_file("trace_enable", 0600, opemu_debugfs, NULL, &trace_enable_fops);
+    trace_files[1] = debugfs_create_file("trace", 0400, opemu_debugfs, NULL, &trace_fops);
+    trace_files[2] = debugfs_create_file("trace_stat", 0400, opemu_debugfs, NULL, &trace_stat_fops);
+    return 0;
+}
+
+void opemu_trace_exit(void)
+{
+    int cpu;
+
+    debugfs_remove(trace_files[0]);
+    debugfs_remove(trace_files[1]);
+    debugfs_remove(trace_files[2]);
+    static_branch_disable(&opemu_trace_key);
+
+    for_each_possible_cpu(cpu) {
+        vfree(per_cpu_ptr(trace_rings, cpu)->recs);
+        vfree(per_cpu_ptr(trace_pending, cpu)->scratch);
+    }
+    free_percpu(trace_rings);
+    free_percpu(trace_pending);
+}
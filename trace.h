@@ -0,0 +1,48 @@
+//
+//  trace.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef trace_h
+#define trace_h
+
+#include "opemu_ioctl.h"
+
+//Records per CPU ring
+#define TRACE_RING 256
+
+#ifdef __KERNEL__
+
+#include <linux/jump_label.h>
+
+struct pt_regs;
+
+DECLARE_STATIC_KEY_FALSE(opemu_trace_key);
+
+struct opemu_trace_rec *__opemu_trace_begin(struct pt_regs *regs);
+void __opemu_trace_end(struct opemu_trace_rec *rec, struct pt_regs *regs, int count);
+void __opemu_trace_mem(uint64_t addr);
+
+//returns the pending record, NULL while tracing is off
+#define opemu_trace_begin(regs) \
+    (static_branch_unlikely(&opemu_trace_key) ? __opemu_trace_begin(regs) : NULL)
+#define opemu_trace_end(rec, regs, count) \
+    do { if (rec) __opemu_trace_end(rec, regs, count); } while (0)
+//first memory operand of the pending record
+#define opemu_trace_mem(addr) \
+    do { if (static_branch_unlikely(&opemu_trace_key)) __opemu_trace_mem(addr); } while (0)
+
+int opemu_trace_init(void);
+void opemu_trace_exit(void);
+
+#else
+
+//userspace stub: nothing to record
+#define opemu_trace_mem(addr)   do { } while (0)
+
+#endif
+
+#endif /* trace_h */
@@ -19,13 +19,32 @@
 #include <linux/uaccess.h>
 #include <linux/version.h>
 #include <linux/kprobes.h>
+#include <linux/ktime.h>
+#include <linux/timex.h>
 
 #include "optrap.h"
+#include "opdev.h"
+#include "upcall.h"
+#include "pressure.h"
+#include "stats.h"
+#include "phase.h"
+#include "trace.h"
+#include "decode.h"
+#include "pin.h"
+#include "budget.h"
+#include "softfloat.h"
+#include "perm.h"
+#include "xfile.h"
+#include "selftest.h"
 
 MODULE_DESCRIPTION("Intel Instruction set Emulation");
 MODULE_AUTHOR("Meowthra");
 MODULE_LICENSE("GPL");
 
+static bool upcall = true;
+module_param(upcall, bool, 0644);
+MODULE_PARM_DESC(upcall, "Honour per-process signal/upcall modes set through /dev/opemu");
+
 #define USE_FENTRY_OFFSET 0
 
 #if defined(CONFIG_X86_64) && (LINUX_VERSION_CODE >= KERNEL_VERSION(4,17,0))
@@ -222,8 +241,59 @@ static int kernel_trap(struct pt_regs *regs, unsigned long trapnr) {
     return 0;
 }
 static int user_trap(struct pt_regs *regs, unsigned long trapnr) {
+    struct opemu_trace_rec *trace;
+    struct opemu_xfile xfile;
+    struct pin_cache *pin;
+    uint64_t start = 0;
+    uint64_t cycles = 0;
+    uint64_t deadline;
+    uint32_t opcode = 0;
+    int stats = 0;
+    int count;
+
     if (trapnr == 6) {
-        if (opemu_utrap(regs))
+        opemu_phase_begin();
+
+        if (opemu_stats_active()) {
+            stats = 1;
+            opcode = opemu_stats_opcode(regs);
+        }
+
+        if (upcall) {
+            switch (opemu_upcall(regs)) {
+                case 1:
+                    if (opemu_pressure_active())
+                        opemu_pressure_account(1, 0, 0);
+                    if (stats)
+                        opemu_stats_account(opcode, 1, 0);
+                    opemu_phase_end(0);
+                    return 1;
+                case -1:
+                    opemu_phase_end(0);
+                    return 0;
+            }
+        }
+
+        trace = opemu_trace_begin(regs);
+        if (opemu_pressure_active())
+            start = ktime_get_ns();
+        if (stats)
+            cycles = get_cycles();
+        opemu_xfile_begin(&xfile);
+        pin = opemu_pin_begin(regs);
+        deadline = opemu_budget_begin();
+        count = opemu_utrap(regs, deadline);
+        opemu_pin_end(pin);
+        opemu_xfile_end(&xfile);
+        if (count) {
+            if (stats)
+                opemu_stats_account(opcode, count, get_cycles() - cycles);
+            if (start)
+                opemu_pressure_account(count, ktime_get_ns() - start, 1);
+        }
+        opemu_trace_end(trace, regs, count);
+        opemu_phase_end(count != 0);
+        if (count)
             return 1;
     }
 
@@ -274,18 +344,79 @@ static int fh_init(void)
 {
     int err;
     
-    err = fh_install_hooks(demo_hooks, ARRAY_SIZE(demo_hooks));
+    err = opemu_pressure_init();
     if (err)
         return err;
+
+    err = opdev_init();
+    if (err)
+        goto err_pressure;
+
+    err = opemu_phase_init();
+    if (err)
+        goto err_opdev;
+
+    err = opemu_trace_init();
+    if (err)
+        goto err_phase;
+
+    err = opemu_decode_init();
+    if (err)
+        goto err_trace;
+
+    err = opemu_pin_init();
+    if (err)
+        goto err_decode;
+
+    err = opemu_xfile_init();
+    if (err)
+        goto err_pin;
+
+    opemu_softfp_init();
+    opemu_perm_init();
+
+    err = opemu_selftest_init();
+    if (err)
+        goto err_xfile;
+
+    err = fh_install_hooks(demo_hooks, ARRAY_SIZE(demo_hooks));
+    if (err)
+        goto err_selftest;
     
     pr_info("module loaded\n");
     return 0;
+
+err_selftest:
+    opemu_selftest_exit();
+err_xfile:
+    opemu_xfile_exit();
+err_pin:
+    opemu_pin_exit();
+err_decode:
+    opemu_decode_exit();
+err_trace:
+    opemu_trace_exit();
+err_phase:
+    opemu_phase_exit();
+err_opdev:
+    opdev_exit();
+err_pressure:
+    opemu_pressure_exit();
+    return err;
 }
 
 
 static void fh_exit(void)
 {
     fh_remove_hooks(demo_hooks, ARRAY_SIZE(demo_hooks));
+    opemu_selftest_exit();
+    opemu_xfile_exit();
+    opemu_pin_exit();
+    opemu_decode_exit();
+    opemu_trace_exit();
+    opemu_phase_exit();
+    opdev_exit();
+    opemu_pressure_exit();
     pr_info("module unloaded\n");
 }
 
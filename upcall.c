@@ -0,0 +1,163 @@
+//
+//  upcall.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/hash.h>
+#include <linux/hashtable.h>
+#include <linux/rculist.h>
+#include <linux/sched.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/uaccess.h>
+
+#include "upcall.h"
+
+/*********************************************************
+ *** Per-process emulation mode.                       ***
+ *** OPEMU_MODE_UPCALL: on #UD only RIP is redirected  ***
+ *** to the stub mapped in the process, which runs the ***
+ *** same handlers in user mode and jumps back. No     ***
+ *** signal frame, no kernel-mode user memory access.  ***
+ *********************************************************/
+
+struct upcall_proc {
+    struct hlist_node node;
+    struct rcu_head rcu;
+    struct mm_struct *mm;
+    pid_t tgid;
+    struct file *owner;
+    uint64_t mode;
+    uint64_t entry;
+    uint64_t text_start;
+    uint64_t text_end;
+};
+
+//keyed by mm, looked up under RCU on every trap
+static DEFINE_HASHTABLE(upcall_hash, UPCALL_BITS);
+static int upcall_count;
+static DEFINE_SPINLOCK(upcall_lock);
+
+static struct upcall_proc *upcall_find(struct mm_struct *mm, pid_t tgid)
+{
+    struct upcall_proc *up;
+
+    hash_for_each_possible(upcall_hash, up, node, hash_ptr(mm, UPCALL_BITS)) {
+        if ((up->mm == mm) && (up->tgid == tgid))
+            return up;
+    }
+    return NULL;
+}
+
+int opemu_upcall_set(struct file *file, void __user *argp)
+{
+    struct opemu_mode_req req;
+    struct upcall_proc *up = NULL, *old;
+
+    if (copy_from_user(&req, argp, sizeof(req)))
+        return -EFAULT;
+    if (req.mode > OPEMU_MODE_UPCALL)
+        return -EINVAL;
+    if (req.mode == OPEMU_MODE_UPCALL) {
+        if ((req.text_start >= req.text_end) || (req.text_end > TASK_SIZE_MAX))
+            return -EINVAL;
+        if ((req.entry < req.text_start) || (req.entry >= req.text_end))
+            return -EINVAL;
+    }
+
+    //entries are never changed in place, a new mode replaces the whole entry
+    if (req.mode != OPEMU_MODE_KERNEL) {
+        up = kmalloc(sizeof(*up), GFP_KERNEL);
+        if (!up)
+            return -ENOMEM;
+        up->mm = current->mm;
+        up->tgid = current->tgid;
+        up->owner = file;
+        up->mode = req.mode;
+        up->entry = req.entry;
+        up->text_start = req.text_start;
+        up->text_end = req.text_end;
+    }
+
+    spin_lock(&upcall_lock);
+    old = upcall_find(current->mm, current->tgid);
+    if (old && up) {
+        hlist_replace_rcu(&old->node, &up->node);
+    } else if (old) {
+        hash_del_rcu(&old->node);
+        WRITE_ONCE(upcall_count, upcall_count - 1);
+    } else if (up) {
+        if (upcall_count >= UPCALL_MAX_PROCS) {
+            spin_unlock(&upcall_lock);
+            kfree(up);
+            return -ENOSPC;
+        }
+        hash_add_rcu(upcall_hash, &up->node, hash_ptr(up->mm, UPCALL_BITS));
+        WRITE_ONCE(upcall_count, upcall_count + 1);
+    }
+    spin_unlock(&upcall_lock);
+
+    if (old)
+        kfree_rcu(old, rcu);
+    return 0;
+}
+
+//The registration lives as long as the /dev/opemu file it was made on
+void opemu_upcall_release(struct file *file)
+{
+    struct upcall_proc *up;
+    struct hlist_node *tmp;
+    int bkt;
+
+    spin_lock(&upcall_lock);
+    hash_for_each_safe(upcall_hash, bkt, tmp, up, node) {
+        if (up->owner == file) {
+            hash_del_rcu(&up->node);
+            WRITE_ONCE(upcall_count, upcall_count - 1);
+            kfree_rcu(up, rcu);
+        }
+    }
+    spin_unlock(&upcall_lock);
+}
+
+/** returns 1 if RIP now points at the stub, -1 to deliver SIGILL, 0 to emulate here. **/
+int opemu_upcall(struct pt_regs *regs)
+{
+    struct upcall_proc *found, up;
+    struct mm_struct *mm = current->mm;
+    unsigned long sp;
+
+    if (!READ_ONCE(upcall_count))
+        return 0;
+
+    rcu_read_lock();
+    hash_for_each_possible_rcu(upcall_hash, found, node, hash_ptr(mm, UPCALL_BITS)) {
+        if ((found->mm == mm) && (found->tgid == current->tgid)) {
+            up = *found;
+            break;
+        }
+    }
+    rcu_read_unlock();
+
+    if (!found)
+        return 0;
+    if (up.mode == OPEMU_MODE_SIGNAL)
+        return -1;
+
+    //the stub itself (or its give-up ud2) is handled in the kernel
+    if ((regs->ip >= up.text_start) && (regs->ip < up.text_end))
+        return 0;
+    if (!is_saved_state64(regs))
+        return 0;
+
+    sp = regs->sp - OPEMU_UPCALL_RED_ZONE - sizeof(unsigned long);
+    if (put_user(regs->ip, (unsigned long __user *)sp))
+        return 0;
+
+    regs->sp = sp;
+    regs->ip = up.entry;
+    return 1;
+}
@@ -0,0 +1,25 @@
+//
+//  upcall.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef upcall_h
+#define upcall_h
+
+#include <linux/fs.h>
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+
+//Registered processes (OPEMU_MODE_SIGNAL / OPEMU_MODE_UPCALL)
+#define UPCALL_MAX_PROCS 64
+#define UPCALL_BITS      6
+
+int opemu_upcall_set(struct file *file, void __user *argp);
+void opemu_upcall_release(struct file *file);
+int opemu_upcall(struct pt_regs *regs);
+
+#endif /* upcall_h */
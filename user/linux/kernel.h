@@ -0,0 +1,28 @@
+//
+//  kernel.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Userspace stand-in for the kernel header (emulation stub build).
+
+#ifndef user_kernel_h
+#define user_kernel_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 4096UL
+#endif
+
+//the stub stays quiet, the caller reports unhandled opcodes
+static inline int printk(const char *fmt, ...)
+{
+    return 0;
+}
+
+#endif /* user_kernel_h */
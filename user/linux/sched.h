@@ -0,0 +1,20 @@
+//
+//  sched.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Userspace stand-in for the kernel header (emulation stub build).
+
+#ifndef user_sched_h
+#define user_sched_h
+
+//user mode is preemptible, never cut work short
+static inline int need_resched(void)
+{
+    return 0;
+}
+
+#endif /* user_sched_h */
@@ -0,0 +1,41 @@
+//
+//  slab.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Userspace stand-in for the kernel header (emulation stub build).
+//  The stub may interrupt malloc itself, so allocations come from a
+//  single per-thread slot instead. Initial-exec TLS: no __tls_get_addr,
+//  which may allocate, on the way to it.
+
+#ifndef user_slab_h
+#define user_slab_h
+
+#include <stddef.h>
+
+#define GFP_KERNEL 0
+#define GFP_NOWAIT 0
+#define __GFP_NOWARN 0
+#define USER_SLAB_SIZE 8192
+
+static __thread char user_slab[USER_SLAB_SIZE] __attribute__((aligned(64), tls_model("initial-exec")));
+static __thread int user_slab_used __attribute__((tls_model("initial-exec")));
+
+static inline void *kmalloc(size_t size, int flags)
+{
+    if ((size > USER_SLAB_SIZE) || user_slab_used)
+        return NULL;
+    user_slab_used = 1;
+    return user_slab;
+}
+
+static inline void kfree(const void *ptr)
+{
+    if (ptr == user_slab)
+        user_slab_used = 0;
+}
+
+#endif /* user_slab_h */
@@ -0,0 +1,31 @@
+//
+//  uaccess.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Userspace stand-in for the kernel header (emulation stub build).
+
+#ifndef user_uaccess_h
+#define user_uaccess_h
+
+#include <string.h>
+#include <errno.h>
+
+#define __user
+
+static inline unsigned long copy_from_user(void *to, const void __user *from, unsigned long n)
+{
+    memcpy(to, from, n);
+    return 0;
+}
+
+static inline unsigned long copy_to_user(void __user *to, const void *from, unsigned long n)
+{
+    memcpy(to, from, n);
+    return 0;
+}
+
+#endif /* user_uaccess_h */
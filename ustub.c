@@ -0,0 +1,277 @@
+//
+//  ustub.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+//
+//  Userspace emulation stub. Built together with the handler sources
+//  (see user/linux/) into libopemu.so, or linked into a program.
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "optrap.h"
+#include "opemu_ioctl.h"
+#include "ustub.h"
+
+/*********************************************************
+ *** Upcall entry.                                     ***
+ *** The kernel left [rsp] = faulting RIP below the    ***
+ *** 128-byte red zone. Build a struct pt_regs frame,  ***
+ *** save the XMM file under it, run opemu_utrap on    ***
+ *** the copy, restore and "ret $128" to the updated   ***
+ *** RIP. If nothing was emulated, ud2 here: the       ***
+ *** kernel does not upcall from the stub text and the ***
+ *** process gets its SIGILL.                          ***
+ *** MXCSR and the MMX registers stay live: only the   ***
+ *** emulated instruction changes them.                ***
+ *********************************************************/
+asm (
+    ".text\n"
+    ".globl opemu_stub_entry\n"
+    ".globl opemu_stub_end\n"
+    ".type opemu_stub_entry, @function\n"
+    "opemu_stub_entry:\n"
+    "    lea -168(%rsp), %rsp\n"
+    "    mov %rax, 80(%rsp)\n"
+    "    pushfq\n"
+    "    pop %rax\n"
+    "    mov %rax, 144(%rsp)\n"
+    "    cld\n"
+    "    mov %r15, 0(%rsp)\n"
+    "    mov %r14, 8(%rsp)\n"
+    "    mov %r13, 16(%rsp)\n"
+    "    mov %r12, 24(%rsp)\n"
+    "    mov %rbp, 32(%rsp)\n"
+    "    mov %rbx, 40(%rsp)\n"
+    "    mov %r11, 48(%rsp)\n"
+    "    mov %r10, 56(%rsp)\n"
+    "    mov %r9,  64(%rsp)\n"
+    "    mov %r8,  72(%rsp)\n"
+    "    mov %rcx, 88(%rsp)\n"
+    "    mov %rdx, 96(%rsp)\n"
+    "    mov %rsi, 104(%rsp)\n"
+    "    mov %rdi, 112(%rsp)\n"
+    "    movq $-1, 120(%rsp)\n"
+    "    mov 168(%rsp), %rax\n"
+    "    mov %rax, 128(%rsp)\n"
+    "    movq $0x33, 136(%rsp)\n"
+    "    lea 304(%rsp), %rax\n"
+    "    mov %rax, 152(%rsp)\n"
+    "    movq $0x2b, 160(%rsp)\n"
+    "    mov %rsp, %rbx\n"
+    "    lea -256(%rsp), %rsp\n"
+    "    and $-16, %rsp\n"
+    "    movdqa %xmm0, 0(%rsp)\n"
+    "    movdqa %xmm1, 16(%rsp)\n"
+    "    movdqa %xmm2, 32(%rsp)\n"
+    "    movdqa %xmm3, 48(%rsp)\n"
+    "    movdqa %xmm4, 64(%rsp)\n"
+    "    movdqa %xmm5, 80(%rsp)\n"
+    "    movdqa %xmm6, 96(%rsp)\n"
+    "    movdqa %xmm7, 112(%rsp)\n"
+    "    movdqa %xmm8, 128(%rsp)\n"
+    "    movdqa %xmm9, 144(%rsp)\n"
+    "    movdqa %xmm10, 160(%rsp)\n"
+    "    movdqa %xmm11, 176(%rsp)\n"
+    "    movdqa %xmm12, 192(%rsp)\n"
+    "    movdqa %xmm13, 208(%rsp)\n"
+    "    movdqa %xmm14, 224(%rsp)\n"
+    "    movdqa %xmm15, 240(%rsp)\n"
+    "    mov %rbx, %rdi\n"
+    "    mov %rsp, %rsi\n"
+    "    call opemu_stub_trap@PLT\n"
+    "    movdqa 0(%rsp), %xmm0\n"
+    "    movdqa 16(%rsp), %xmm1\n"
+    "    movdqa 32(%rsp), %xmm2\n"
+    "    movdqa 48(%rsp), %xmm3\n"
+    "    movdqa 64(%rsp), %xmm4\n"
+    "    movdqa 80(%rsp), %xmm5\n"
+    "    movdqa 96(%rsp), %xmm6\n"
+    "    movdqa 112(%rsp), %xmm7\n"
+    "    movdqa 128(%rsp), %xmm8\n"
+    "    movdqa 144(%rsp), %xmm9\n"
+    "    movdqa 160(%rsp), %xmm10\n"
+    "    movdqa 176(%rsp), %xmm11\n"
+    "    movdqa 192(%rsp), %xmm12\n"
+    "    movdqa 208(%rsp), %xmm13\n"
+    "    movdqa 224(%rsp), %xmm14\n"
+    "    movdqa 240(%rsp), %xmm15\n"
+    "    mov %rbx, %rsp\n"
+    "    mov 128(%rsp), %rcx\n"
+    "    mov %rcx, 168(%rsp)\n"
+    "    mov %eax, %ecx\n"
+    "    mov 144(%rsp), %rax\n"
+    "    push %rax\n"
+    "    popfq\n"
+    "    jrcxz 1f\n"
+    "    mov 0(%rsp), %r15\n"
+    "    mov 8(%rsp), %r14\n"
+    "    mov 16(%rsp), %r13\n"
+    "    mov 24(%rsp), %r12\n"
+    "    mov 32(%rsp), %rbp\n"
+    "    mov 40(%rsp), %rbx\n"
+    "    mov 48(%rsp), %r11\n"
+    "    mov 56(%rsp), %r10\n"
+    "    mov 64(%rsp), %r9\n"
+    "    mov 72(%rsp), %r8\n"
+    "    mov 80(%rsp), %rax\n"
+    "    mov 88(%rsp), %rcx\n"
+    "    mov 96(%rsp), %rdx\n"
+    "    mov 104(%rsp), %rsi\n"
+    "    mov 112(%rsp), %rdi\n"
+    "    lea 168(%rsp), %rsp\n"
+    "    ret $128\n"
+    "1:\n"
+    "    mov 0(%rsp), %r15\n"
+    "    mov 8(%rsp), %r14\n"
+    "    mov 16(%rsp), %r13\n"
+    "    mov 24(%rsp), %r12\n"
+    "    mov 32(%rsp), %rbp\n"
+    "    mov 40(%rsp), %rbx\n"
+    "    mov 48(%rsp), %r11\n"
+    "    mov 56(%rsp), %r10\n"
+    "    mov 64(%rsp), %r9\n"
+    "    mov 72(%rsp), %r8\n"
+    "    mov 80(%rsp), %rax\n"
+    "    mov 88(%rsp), %rcx\n"
+    "    mov 96(%rsp), %rdx\n"
+    "    mov 104(%rsp), %rsi\n"
+    "    mov 112(%rsp), %rdi\n"
+    "    lea 168(%rsp), %rsp\n"
+    "    ud2\n"
+    "opemu_stub_end:\n"
+    ".size opemu_stub_entry, opemu_stub_end - opemu_stub_entry\n"
+);
+
+/** The stub's C half. returns the number of instructions emulated. **/
+int opemu_stub_trap(struct pt_regs *regs, XMM *xmm)
+{
+    int count;
+
+    opemu_xfile = xmm;
+    count = opemu_utrap(regs, 0);
+    opemu_xfile = NULL;
+    return count;
+}
+
+/*********************************************************
+ *** SIGILL mode, the LD_PRELOAD handler style.        ***
+ *********************************************************/
+static void ustub_sigill(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    greg_t *gregs = uc->uc_mcontext.gregs;
+    struct _libc_fpstate *fp = uc->uc_mcontext.fpregs;
+    struct pt_regs regs;
+    int count;
+
+    regs.r15 = gregs[REG_R15];
+    regs.r14 = gregs[REG_R14];
+    regs.r13 = gregs[REG_R13];
+    regs.r12 = gregs[REG_R12];
+    regs.bp = gregs[REG_RBP];
+    regs.bx = gregs[REG_RBX];
+    regs.r11 = gregs[REG_R11];
+    regs.r10 = gregs[REG_R10];
+    regs.r9 = gregs[REG_R9];
+    regs.r8 = gregs[REG_R8];
+    regs.ax = gregs[REG_RAX];
+    regs.cx = gregs[REG_RCX];
+    regs.dx = gregs[REG_RDX];
+    regs.si = gregs[REG_RSI];
+    regs.di = gregs[REG_RDI];
+    regs.orig_ax = -1;
+    regs.ip = gregs[REG_RIP];
+    regs.cs = 0x33;
+    regs.flags = gregs[REG_EFL];
+    regs.sp = gregs[REG_RSP];
+    regs.ss = 0x2b;
+
+    //the handler runs on a fresh FPU state, sigreturn restores the saved one:
+    //emulate on the saved XMM file, under the interrupted MXCSR
+    asm volatile ("ldmxcsr %0" :: "m" (fp->mxcsr));
+    count = opemu_stub_trap(&regs, (XMM *)fp->_xmm);
+    asm volatile ("stmxcsr %0" : "=m" (fp->mxcsr));
+    if (!count) {
+        signal(SIGILL, SIG_DFL);
+        return;
+    }
+
+    gregs[REG_R15] = regs.r15;
+    gregs[REG_R14] = regs.r14;
+    gregs[REG_R13] = regs.r13;
+    gregs[REG_R12] = regs.r12;
+    gregs[REG_RBP] = regs.bp;
+    gregs[REG_RBX] = regs.bx;
+    gregs[REG_R11] = regs.r11;
+    gregs[REG_R10] = regs.r10;
+    gregs[REG_R9] = regs.r9;
+    gregs[REG_R8] = regs.r8;
+    gregs[REG_RAX] = regs.ax;
+    gregs[REG_RCX] = regs.cx;
+    gregs[REG_RDX] = regs.dx;
+    gregs[REG_RSI] = regs.si;
+    gregs[REG_RDI] = regs.di;
+    gregs[REG_RIP] = regs.ip;
+    gregs[REG_EFL] = regs.flags;
+}
+
+static int ustub_fd = -1;
+
+/** Select how #UD in this process is emulated. returns 0 or -errno. **/
+int opemu_stub_register(int mode)
+{
+    struct opemu_mode_req req;
+    struct sigaction sa;
+
+    if (ustub_fd < 0) {
+        ustub_fd = open(OPEMU_DEVICE, O_RDWR | O_CLOEXEC);
+        if (ustub_fd < 0)
+            return -errno;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    if (mode == OPEMU_MODE_SIGNAL) {
+        sa.sa_sigaction = ustub_sigill;
+        sa.sa_flags = SA_SIGINFO;
+    } else {
+        sa.sa_handler = SIG_DFL;
+    }
+    sigaction(SIGILL, &sa, NULL);
+
+    memset(&req, 0, sizeof(req));
+    req.mode = mode;
+    req.entry = (uint64_t)opemu_stub_entry;
+    req.text_start = (uint64_t)opemu_stub_entry;
+    req.text_end = (uint64_t)opemu_stub_end;
+    if (ioctl(ustub_fd, OPEMU_IOC_SET_MODE, &req) < 0)
+        return -errno;
+
+    return 0;
+}
+
+#ifdef OPEMU_STUB_PRELOAD
+//LD_PRELOAD=libopemu.so OPEMU_MODE=upcall|signal|kernel
+__attribute__((constructor)) static void ustub_init(void)
+{
+    const char *env = getenv("OPEMU_MODE");
+    int mode = OPEMU_MODE_UPCALL;
+
+    if (env && !strcmp(env, "signal"))
+        mode = OPEMU_MODE_SIGNAL;
+    else if (env && !strcmp(env, "kernel"))
+        mode = OPEMU_MODE_KERNEL;
+
+    opemu_stub_register(mode);
+}
+#endif
@@ -0,0 +1,21 @@
+//
+//  ustub.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef ustub_h
+#define ustub_h
+
+#include "optrap.h"
+
+extern char opemu_stub_entry[];
+extern char opemu_stub_end[];
+
+int opemu_stub_trap(struct pt_regs *regs, XMM *xmm);
+
+int opemu_stub_register(int mode);
+
+#endif /* ustub_h */
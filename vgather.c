@@ -51,35 +51,39 @@ int vgather_instruction(struct pt_regs *regs,
                     if (operand_size == 64) { //W1
                         if (reg_size == 128){ //VEX.128
                             //VPGATHERDQ 128 xmm1, vm32x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vpgatherdq128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vpgatherdq128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
 
                         } else { //VEX.256
                             //VPGATHERDQ 256 ymm1, vm32x, ymm2
-                            //_store_ymm(num_dst, &ymmdst);
+                            _store_ymm(num_dst, &ymmres);
                             _store_ymm(vexreg, &ymmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vpgatherdq256(ymmvsrc, xmmindex, &ymmres, regs, modrm, high_base, ins_size);
+                            vpgatherdq256(&ymmvsrc, xmmindex, &ymmres, regs, modrm, high_base, ins_size);
                             _load_ymm(num_dst, &ymmres);
+                            _load_ymm(vexreg, &ymmvsrc);
                         }
                     } else { //W0
                         if (reg_size == 128){ //VEX.128
                             //VPGATHERDD 128 xmm1, vm32x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vpgatherdd128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vpgatherdd128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         } else { //VEX.256
                             //VPGATHERDD 256 ymm1, vm32y, ymm2
-                            //_store_ymm(num_dst, &ymmdst);
+                            _store_ymm(num_dst, &ymmres);
                             _store_ymm(vexreg, &ymmvsrc);
                             _store_ymm(index, &ymmindex);
-                            vpgatherdd256(ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
+                            vpgatherdd256(&ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
                             _load_ymm(num_dst, &ymmres);
+                            _load_ymm(vexreg, &ymmvsrc);
                        }
                     }
                 }
@@ -92,34 +96,38 @@ int vgather_instruction(struct pt_regs *regs,
                     if (operand_size == 64) { //W1
                         if (reg_size == 128){ //VEX.128
                             //VPGATHERQQ 128 xmm1, vm64x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vpgatherqq128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vpgatherqq128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         } else { //VEX.256
                             //VPGATHERQQ 256 ymm1, vm64y, ymm2
-                            //_store_ymm(num_dst, &ymmdst);
+                            _store_ymm(num_dst, &ymmres);
                             _store_ymm(vexreg, &ymmvsrc);
                             _store_ymm(index, &ymmindex);
-                            vpgatherqq256(ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
+                            vpgatherqq256(&ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
                             _load_ymm(num_dst, &ymmres);
+                            _load_ymm(vexreg, &ymmvsrc);
                         }
                     } else { //W0
                         if (reg_size == 128){ //VEX.128
                             //VPGATHERQD 128 xmm1, vm64x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vpgatherqd128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vpgatherqd128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         } else { //VEX.256
                             //VPGATHERQD 256 xmm1, vm64y, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_ymm(index, &ymmindex);
-                            vpgatherqd256(xmmvsrc, ymmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vpgatherqd256(&xmmvsrc, ymmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                        }
                     }
                 }
@@ -132,34 +140,38 @@ int vgather_instruction(struct pt_regs *regs,
                     if (operand_size == 64) { //W1
                         if (reg_size == 128){ //VEX.128
                             //VGATHERDPD 128 xmm1, vm32x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vgatherdpd128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vgatherdpd128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         } else { //VEX.256
                             //VGATHERDPD 256 ymm1, vm32x, ymm2
-                            //_store_ymm(num_dst, &ymmdst);
+                            _store_ymm(num_dst, &ymmres);
                             _store_ymm(vexreg, &ymmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vgatherdpd256(ymmvsrc, xmmindex, &ymmres, regs, modrm, high_base, ins_size);
+                            vgatherdpd256(&ymmvsrc, xmmindex, &ymmres, regs, modrm, high_base, ins_size);
                             _load_ymm(num_dst, &ymmres);
+                            _load_ymm(vexreg, &ymmvsrc);
                         }
                     } else { //W0
                         if (reg_size == 128){ //VEX.128
                             //VGATHERDPS 128 xmm1, vm32x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vgatherdps128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vgatherdps128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                        } else { //VEX.256
                             //VGATHERDPS 256 ymm1, vm32y, ymm2
-                           //_store_ymm(num_dst, &ymmdst);
+                           _store_ymm(num_dst, &ymmres);
                            _store_ymm(vexreg, &ymmvsrc);
                            _store_ymm(index, &ymmindex);
-                           vgatherdps256(ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
+                           vgatherdps256(&ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
                            _load_ymm(num_dst, &ymmres);
+                           _load_ymm(vexreg, &ymmvsrc);
                        }
                     }
                 }
@@ -172,34 +184,38 @@ int vgather_instruction(struct pt_regs *regs,
                     if (operand_size == 64) { //W1
                         if (reg_size == 128){ //VEX.128
                             //VGATHERQPD 128 xmm1, vm64x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vgatherqpd128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vgatherqpd128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         } else { //VEX.256
                             //VGATHERQPD 256 ymm1, vm64y, ymm2
-                            //_store_ymm(num_dst, &ymmdst);
+                            _store_ymm(num_dst, &ymmres);
                             _store_ymm(vexreg, &ymmvsrc);
                             _store_ymm(index, &ymmindex);
-                            vgatherqpd256(ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
+                            vgatherqpd256(&ymmvsrc, ymmindex, &ymmres, regs, modrm, high_base, ins_size);
                             _load_ymm(num_dst, &ymmres);
+                            _load_ymm(vexreg, &ymmvsrc);
                         }
                     } else { //W0
                         if (reg_size == 128){ //VEX.128
                             //VGATHERQPS 128 xmm1, vm64x, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_xmm(index, &xmmindex);
-                            vgatherqps128(xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vgatherqps128(&xmmvsrc, xmmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         } else { //VEX.256
                             //VGATHERQPS 256 xmm1, vm64y, xmm2
-                            //_store_xmm(num_dst, &xmmdst);
+                            _store_xmm(num_dst, &xmmres);
                             _store_xmm(vexreg, &xmmvsrc);
                             _store_ymm(index, &ymmindex);
-                            vgatherqps256(xmmvsrc, ymmindex, &xmmres, regs, modrm, high_base, ins_size);
+                            vgatherqps256(&xmmvsrc, ymmindex, &xmmres, regs, modrm, high_base, ins_size);
                             _load_xmm(num_dst, &xmmres);
+                            _load_xmm(vexreg, &xmmvsrc);
                         }
                     }
                 }
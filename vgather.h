@@ -29,556 +29,98 @@ int vgather_instruction(struct pt_regs *regs,
 /**********************************************/
 /**  AVX Gather instructions implementation  **/
 /**********************************************/
-// Integer Values
-static inline void vpgatherdq128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+/**
+ * count elements of esize bytes, each under the sign bit of its mask
+ * element, into dst. indices are isize bytes, dword ones sign extend.
+ * elements whose mask is clear keep the destination's value, the whole
+ * mask register is zeroed once the gather completes.
+ */
+static inline void vgather_elems(uint8_t *dst, uint8_t *mask, int mask_size, const uint8_t *vindex,
+                                 int count, int esize, int isize,
+                                 struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
     int i;
-    int cs;
-    uint64_t mask_bit = 0;
     uint64_t data_addr = 0;
-    XMM MASK;
     XMM vaddr;
 
-    for (i = 0; i < 2; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 2; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
+    for (i = 0; i < count; ++i) {
+        if (!(mask[i * esize + esize - 1] & 0x80))
+            continue;
+        if (isize == 4)
+            vaddr.a64[0] = *(int32_t*)&vindex[i * 4];
+        else
+            vaddr.a64[0] = *(int64_t*)&vindex[i * 8];
         data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            res->u64[i] = 0;
-        }
+        _read_maddr(&dst[i * esize], data_addr, esize);
     }
+    memset(mask, 0, mask_size);
 }
 
-static inline void vpgatherdq256(YMM vsrc, XMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    YMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            res->u64[i] = 0;
-        }
-    }
+// Integer Values
+static inline void vpgatherdq128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 16, vindex.u8, 2, 8, 4, regs, modrm, high_base, ins_size);
 }
 
-static inline void vpgatherdd128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint32_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            res->u32[i] = 0;
-        }
-    }
+static inline void vpgatherdq256(YMM *vsrc, XMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 32, vindex.u8, 4, 8, 4, regs, modrm, high_base, ins_size);
 }
 
-static inline void vpgatherdd256(YMM vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint32_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    YMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 8; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 8; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            res->u32[i] = 0;
-        }
-    }
+static inline void vpgatherdd128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 16, vindex.u8, 4, 4, 4, regs, modrm, high_base, ins_size);
 }
 
-static inline void vpgatherqq128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 2; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 2; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            res->u64[i] = 0;
-        }
-    }
+static inline void vpgatherdd256(YMM *vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 32, vindex.u8, 8, 4, 4, regs, modrm, high_base, ins_size);
 }
 
-static inline void vpgatherqq256(YMM vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    YMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            res->u64[i] = 0;
-        }
-    }
+static inline void vpgatherqq128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 16, vindex.u8, 2, 8, 8, regs, modrm, high_base, ins_size);
 }
 
-static inline void vpgatherqd128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint32_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 2; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            res->u32[i] = 0;
-        }
-    }
+static inline void vpgatherqq256(YMM *vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 32, vindex.u8, 4, 8, 8, regs, modrm, high_base, ins_size);
 }
 
-static inline void vpgatherqd256(XMM vsrc, YMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint32_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    
-    for (i = 0; i < 8; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            res->u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            res->u32[i] = 0;
-        }
-    }
+//two qword indices fill the low half, the high half is zeroed
+static inline void vpgatherqd128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 16, vindex.u8, 2, 4, 8, regs, modrm, high_base, ins_size);
+    res->u64[1] = 0;
+}
+
+static inline void vpgatherqd256(XMM *vsrc, YMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vgather_elems(res->u8, vsrc->u8, 16, vindex.u8, 4, 4, 8, regs, modrm, high_base, ins_size);
 }
 
 // Float Values
-static inline void vgatherdpd128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    XMM tmp;
-    for (i = 0; i < 2; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 2; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            tmp.u64[i] = 0;
-        }
-    }
-    res->fa64[0] = tmp.fa64[0];
-    res->fa64[1] = tmp.fa64[1];
+static inline void vgatherdpd128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherdq128(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherdpd256(YMM vsrc, XMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    YMM MASK;
-    XMM vaddr;
-    YMM tmp;
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            tmp.u64[i] = 0;
-        }
-    }
-    res->fa64[0] = tmp.fa64[0];
-    res->fa64[1] = tmp.fa64[1];
-    res->fa64[2] = tmp.fa64[2];
-    res->fa64[3] = tmp.fa64[3];
+static inline void vgatherdpd256(YMM *vsrc, XMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherdq256(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherdps128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    XMM tmp;
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            tmp.u32[i] = 0;
-        }
-    }
-    res->fa32[0] = tmp.fa32[0];
-    res->fa32[1] = tmp.fa32[1];
-    res->fa32[2] = tmp.fa32[3];
-    res->fa32[3] = tmp.fa32[3];
+static inline void vgatherdps128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherdd128(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherdps256(YMM vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    YMM MASK;
-    XMM vaddr;
-    YMM tmp;
-    for (i = 0; i < 8; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 8; ++i) {
-        vaddr.a32[0] = vindex.a32[i];
-        vaddr.a32[1] = 0xffffffff;
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            tmp.u32[i] = 0;
-        }
-    }
-    res->fa32[0] = tmp.fa32[0];
-    res->fa32[1] = tmp.fa32[1];
-    res->fa32[2] = tmp.fa32[3];
-    res->fa32[3] = tmp.fa32[3];
-    res->fa32[4] = tmp.fa32[4];
-    res->fa32[5] = tmp.fa32[5];
-    res->fa32[6] = tmp.fa32[6];
-    res->fa32[7] = tmp.fa32[7];
+static inline void vgatherdps256(YMM *vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherdd256(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherqpd128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    XMM tmp;
-    for (i = 0; i < 2; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 2; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            tmp.u64[i] = 0;
-        }
-    }
-    res->fa64[0] = tmp.fa64[0];
-    res->fa64[1] = tmp.fa64[1];
+static inline void vgatherqpd128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherqq128(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherqpd256(YMM vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    YMM MASK;
-    XMM vaddr;
-    YMM tmp;
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u64[i];
-        cs = mask_bit >> 63 & 1;
-        if (cs == 1) {
-            MASK.u64[i] = 0xffffffffffffffff;
-        } else {
-            MASK.u64[i] = 0x0000000000000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u64[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u64[i] = *(uint64_t*)&data_addr;
-        } else {
-            tmp.u64[i] = 0;
-        }
-    }
-    res->fa64[0] = tmp.fa64[0];
-    res->fa64[1] = tmp.fa64[1];
-    res->fa64[2] = tmp.fa64[2];
-    res->fa64[3] = tmp.fa64[3];
+static inline void vgatherqpd256(YMM *vsrc, YMM vindex, YMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherqq256(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherqps128(XMM vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    XMM tmp;
-    for (i = 0; i < 4; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 2; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            tmp.u32[i] = 0;
-        }
-    }
-    res->fa32[0] = tmp.fa32[0];
-    res->fa32[1] = tmp.fa32[1];
+static inline void vgatherqps128(XMM *vsrc, XMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherqd128(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
-static inline void vgatherqps256(XMM vsrc, YMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
-    int i;
-    int cs;
-    uint64_t mask_bit = 0;
-    uint64_t data_addr = 0;
-    XMM MASK;
-    XMM vaddr;
-    XMM tmp;
-    for (i = 0; i < 8; ++i) {
-        mask_bit = vsrc.u32[i];
-        cs = mask_bit >> 31 & 1;
-        if (cs == 1) {
-            MASK.u32[i] = 0xffffffff;
-        } else {
-            MASK.u32[i] = 0x00000000;
-        }
-    }
-    
-    for (i = 0; i < 4; ++i) {
-        vaddr.a64[0] = vindex.a64[i];
-        data_addr = vmaddrs(regs, modrm, high_base, vaddr, ins_size);
-        
-        mask_bit = MASK.u32[i];
-        cs = mask_bit & 1;
-        if (cs == 1) {
-            tmp.u32[i] = *(uint32_t*)&data_addr;
-        } else {
-            tmp.u32[i] = 0;
-        }
-    }
-    res->fa32[0] = tmp.fa32[0];
-    res->fa32[1] = tmp.fa32[1];
-    res->fa32[2] = tmp.fa32[3];
-    res->fa32[3] = tmp.fa32[3];
+static inline void vgatherqps256(XMM *vsrc, YMM vindex, XMM *res, struct pt_regs *regs, uint8_t *modrm, uint8_t high_base, uint8_t ins_size) {
+    vpgatherqd256(vsrc, vindex, res, regs, modrm, high_base, ins_size);
 }
 
 #endif /* vgather_h */
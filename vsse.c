@@ -36,6 +36,10 @@ int vsse_instruction(struct pt_regs *regs,
     if (high_base) num_src += 8;
     
     uint64_t rmaddrs = 0;
+
+    //ps and ss only, 66 and F2 belong to VSSE2
+    if ((simd_prefix == 1) || (simd_prefix == 3))
+        return 0;
     
     if (reg_size == 128) {
         XMM xmmsrc, xmmvsrc, xmmdst, xmmres;
@@ -99,42 +103,46 @@ int vsse_instruction(struct pt_regs *regs,
                 if (simd_prefix == 0) { //None
                     if (leading_opcode == 1) {//0F
                         //VMOVLPS SRC -> DST
-                        if (mod == 0)
+                        if (mod != 3)
                             vmovlps_128a(xmmsrc, xmmvsrc, &xmmres);
-                       //VMOVHLPS
-                        if (mod == 3)
+                        //VMOVHLPS
+                        else
                             vmovhlps(xmmsrc, xmmvsrc, &xmmres);
                         _load_xmm(num_dst, &xmmres);
                     }
                 }
+                break;
             case 0x13: //VMOVLPS DST -> SRC
                 if (simd_prefix == 0) { //None
-                    if (leading_opcode == 1) {//0F
+                    if ((leading_opcode == 1) && (mod != 3)) {//0F
                         vmovlps_128b(xmmdst, &xmmres);
                         rm_size = 64;
                         _load_maddr_from_xmm(rmaddrs, &xmmres, rm_size, regs);
                     }
                 }
+                break;
             case 0x16:
                 if (simd_prefix == 0) { //None
                     if (leading_opcode == 1) {//0F
                         //VMOVHPS SRC -> DST
-                        if (mod == 0)
+                        if (mod != 3)
                             vmovhps_128a(xmmsrc, xmmvsrc, &xmmres);
                         //VMOVLHPS
-                        if (mod == 3)
+                        else
                             vmovlhps(xmmsrc, xmmvsrc, &xmmres);
                         _load_xmm(num_dst, &xmmres);
                     }
                 }
+                break;
             case 0x17: //VMOVHPS DST -> SRC
                 if (simd_prefix == 0) { //None
-                    if (leading_opcode == 1) {//0F
+                    if ((leading_opcode == 1) && (mod != 3)) {//0F
                         vmovhps_128b(xmmdst, &xmmres);
                         rm_size = 64;
                         _load_maddr_from_xmm(rmaddrs, &xmmres, rm_size, regs);
                     }
                 }
+                break;
 
             case 0x28: //VMOVAPS
                 if (simd_prefix == 0) { //None
@@ -364,7 +372,7 @@ int vsse_instruction(struct pt_regs *regs,
             case 0x2F: //VCOMISS
                 if (simd_prefix == 0) { //none
                     if (leading_opcode == 1) {//0F
-                        vucomiss(xmmsrc, xmmdst, regs);
+                        vcomiss(xmmsrc, xmmdst, regs);
                     }
                 }
                 break;
@@ -753,147 +761,6 @@ int minsf(float SRC1, float SRC2) {
     return 0;
 }
 
-//comparison predicate operand
-int cmpoptsf(float SRC1, float SRC2, uint8_t immvar) {
-    int opt = 0;
-    
-    switch(immvar) {
-        case 0:
-            if (SRC1 == SRC2) opt = 1;
-            break;
-        case 1:
-            if (SRC1 < SRC2) opt = 1;
-            break;
-        case 2:
-            if (SRC1 <= SRC2) opt = 1;
-            break;
-        case 3:
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 4:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 5:
-            if (SRC1 >= SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 6:
-            if (SRC1 > SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 7:
-            opt = 1;
-            if (isNaN_f32(SRC1)) opt = 0;
-            if (isNaN_f32(SRC2)) opt = 0;
-            break;
-        case 8:
-            if (SRC1 == SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 9:
-            if (SRC1 < SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 10:
-            if (SRC1 <= SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 11:
-            opt = 0;
-            break;
-        case 12:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 0;
-            if (isNaN_f32(SRC2)) opt = 0;
-            break;
-        case 13:
-            if (SRC1 >= SRC2) opt = 1;
-            break;
-        case 14:
-            if (SRC1 > SRC2) opt = 1;
-            break;
-        case 15:
-            opt = 1;
-            break;
-        case 16:
-            if (SRC1 == SRC2) opt = 1;
-            break;
-        case 17:
-            if (SRC1 < SRC2) opt = 1;
-            break;
-        case 18:
-            if (SRC1 <= SRC2) opt = 1;
-            break;
-        case 19:
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 20:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 21:
-            if (SRC1 >= SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 22:
-            if (SRC1 > SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 23:
-            opt = 1;
-            if (isNaN_f32(SRC1)) opt = 0;
-            if (isNaN_f32(SRC2)) opt = 0;
-            break;
-        case 24:
-            if (SRC1 == SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 25:
-            if (SRC1 < SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 26:
-            if (SRC1 <= SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 1;
-            if (isNaN_f32(SRC2)) opt = 1;
-            break;
-        case 27:
-            opt = 0;
-            break;
-        case 28:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f32(SRC1)) opt = 0;
-            if (isNaN_f32(SRC2)) opt = 0;
-            break;
-        case 29:
-            if (SRC1 >= SRC2) opt = 1;
-            break;
-        case 30:
-            if (SRC1 > SRC2) opt = 1;
-            break;
-        case 31:
-            opt = 1;
-            break;
-        default: return 0;
-    }
-    
-    return opt;
-}
-
 /****** get approximate ******/
 float rcp_sf(float fp32) {
     XMM BAK;
@@ -11,6 +11,10 @@
 
 #include "optrap.h"
 #include "fpins.h"
+#include "fpops.h"
+#include "perm.h"
+#include "fpcmp.h"
+#include "sse2int.h"
 
 int vsse_instruction(struct pt_regs *regs,
                      uint8_t vexreg,
@@ -29,7 +33,6 @@ int vsse_instruction(struct pt_regs *regs,
 
 int maxsf(float SRC1, float SRC2);
 int minsf(float SRC1, float SRC2);
-int cmpoptsf(float SRC1, float SRC2, uint8_t immvar);
 float rcp_sf(float fp32);
 float rsqrt_sf(float fp32);
 
@@ -80,7 +83,7 @@ static inline void vmovhps_128a(XMM src, XMM vsrc, XMM *res) {
     res->a64[1] = src.a64[0];
 }
 static inline void vmovhps_128b(XMM src, XMM *res) {
-    res->a64[0] = src.a64[0];
+    res->a64[0] = src.a64[1];
 }
 static inline void vmovntps_128(XMM dst, XMM *res) {
     res->u128 = dst.u128;
@@ -91,98 +94,98 @@ static inline void vmovntps_256(YMM dst, YMM *res) {
 }
 static inline void vmovmskps_128(XMM src, XMM *res) {
     int i;
-    int xbit;
-    uint32_t mask;
-    uint32_t dest = 0;
-    
+    uint64_t dest = 0;
+
+    if (!opemu_softfp()) {
+        res->u64[0] = sse2_movmsk(src.u8, 16, 4);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        mask = src.u32[i];
-        xbit = (mask >> 31) & 1;
-        dest |= (xbit << i);
+        dest |= (uint64_t)(src.u32[i] >> 31) << i;
     }
-    res->u32[0] = dest;
+    res->u64[0] = dest;
 }
 static inline void vmovmskps_256(YMM src, YMM *res) {
     int i;
-    int xbit;
-    uint32_t mask;
-    uint32_t dest = 0;
-    
+    uint64_t dest = 0;
+
+    if (!opemu_softfp()) {
+        res->u64[0] = sse2_movmsk(src.u8, 32, 4);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
-        mask = src.u32[i];
-        xbit = (mask >> 31) & 1;
-        dest |= (xbit << i);
+        dest |= (uint64_t)(src.u32[i] >> 31) << i;
     }
-    res->u32[0] = dest;
+    res->u64[0] = dest;
 }
 /************* ADD *************/
 static inline void vaddps_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     for (i = 0; i < 4; ++i) {
-        res->fa32[i] = vsrc.fa32[i] + src.fa32[i];
+        res->u32[i] = fp32_add(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vaddps_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     for (i = 0; i < 8; ++i) {
-        res->fa32[i] = vsrc.fa32[i] + src.fa32[i];
+        res->u32[i] = fp32_add(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vaddss(XMM src, XMM vsrc, XMM *res) {
     res->u128 = vsrc.u128;
-    res->fa32[0] = vsrc.fa32[0] + src.fa32[0];
+    res->u32[0] = fp32_add(vsrc.u32[0], src.u32[0]);
 }
 
 /************* SUB *************/
 static inline void vsubps_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     for (i = 0; i < 4; ++i) {
-        res->fa32[i] = vsrc.fa32[i] - src.fa32[i];
+        res->u32[i] = fp32_sub(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vsubps_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     for (i = 0; i < 8; ++i) {
-        res->fa32[i] = vsrc.fa32[i] - src.fa32[i];
+        res->u32[i] = fp32_sub(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vsubss(XMM src, XMM vsrc, XMM *res) {
     res->u128 = vsrc.u128;
-    res->fa32[0] = vsrc.fa32[0] - src.fa32[0];
+    res->u32[0] = fp32_sub(vsrc.u32[0], src.u32[0]);
 }
 /************* Multiply *************/
 static inline void vmulps_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     for (i = 0; i < 4; ++i) {
-        res->fa32[i] = vsrc.fa32[i] * src.fa32[i];
+        res->u32[i] = fp32_mul(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vmulps_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     for (i = 0; i < 8; ++i) {
-        res->fa32[i] = vsrc.fa32[i] * src.fa32[i];
+        res->u32[i] = fp32_mul(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vmulss(XMM src, XMM vsrc, XMM *res) {
     res->u128 = vsrc.u128;
-    res->fa32[0] = vsrc.fa32[0] * src.fa32[0];
+    res->u32[0] = fp32_mul(vsrc.u32[0], src.u32[0]);
 }
 /************* Divide *************/
 static inline void vdivps_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     for (i = 0; i < 4; ++i) {
-        res->fa32[i] = vsrc.fa32[i] / src.fa32[i];
+        res->u32[i] = fp32_div(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vdivps_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     for (i = 0; i < 8; ++i) {
-        res->fa32[i] = vsrc.fa32[i] / src.fa32[i];
+        res->u32[i] = fp32_div(vsrc.u32[i], src.u32[i]);
     }
 }
 static inline void vdivss(XMM src, XMM vsrc, XMM *res) {
     res->u128 = vsrc.u128;
-    res->fa32[0] = vsrc.fa32[0] / src.fa32[0];
+    res->u32[0] = fp32_div(vsrc.u32[0], src.u32[0]);
 }
 /************* AND *************/
 static inline void vandps_128(XMM src, XMM vsrc, XMM *res) {
@@ -263,32 +266,19 @@ static inline void vxorps_256(YMM src, YMM vsrc, YMM *res) {
 
 /************* Converts *************/
 static inline void vcvtsi2ss(XMM src, XMM vsrc, XMM *res, uint8_t operand_size) {
-    float f = 0;
     res->u128 = vsrc.u128;
     
     if (operand_size == 64) {
-        int64_t ix = src.a64[0];
-        f = ix;
-        res->fa32[0] = f;
+        res->u32[0] = i64_to_fp32(src.a64[0]);
     } else {
-        int32_t ix = src.a32[0];
-        f = ix;
-        res->fa32[0] = f;
+        res->u32[0] = i32_to_fp32(src.a32[0]);
     }
 }
 static inline void vcvtss2si(XMM src, XMM *res, int rc, uint8_t operand_size) {
-    double df = 0;
-    
     if (operand_size == 64) {
-        int64_t ix = 0;
-        df = round_fp32(src.fa32[0], rc);
-        ix= df;
-        res->a64[0] = ix;
+        res->a64[0] = fp32_to_i64(src.u32[0], rc);
     } else {
-        int32_t ix = 0;
-        df = round_fp32(src.fa32[0], rc);
-        ix = df;
-        res->a32[0] = ix;
+        res->a32[0] = fp32_to_i32(src.u32[0], rc);
         res->a32[1] = 0;
     }
 }
@@ -298,7 +288,7 @@ static inline void vminps_128(XMM src, XMM vsrc, XMM *res) {
     int MIN = 0;
     float SRC1, SRC2;
     
-    for (i = 0; i < 2; ++i) {
+    for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.fa32[i];
         SRC2 = src.fa32[i];
         MIN = minsf(SRC1, SRC2);
@@ -313,7 +303,7 @@ static inline void vminps_256(YMM src, YMM vsrc, YMM *res) {
     int MIN = 0;
     float SRC1, SRC2;
     
-    for (i = 0; i < 4; ++i) {
+    for (i = 0; i < 8; ++i) {
         SRC1 = vsrc.fa32[i];
         SRC2 = src.fa32[i];
         MIN = minsf(SRC1, SRC2);
@@ -330,7 +320,7 @@ static inline void vmaxps_128(XMM src, XMM vsrc, XMM *res) {
     int MAX = 0;
     float SRC1, SRC2;
     
-    for (i = 0; i < 2; ++i) {
+    for (i = 0; i < 4; ++i) {
         SRC1 = vsrc.fa32[i];
         SRC2 = src.fa32[i];
         MAX = maxsf(SRC1, SRC2);
@@ -345,7 +335,7 @@ static inline void vmaxps_256(YMM src, YMM vsrc, YMM *res) {
     int MAX = 0;
     float SRC1, SRC2;
     
-    for (i = 0; i < 4; ++i) {
+    for (i = 0; i < 8; ++i) {
         SRC1 = vsrc.fa32[i];
         SRC2 = src.fa32[i];
         MAX = maxsf(SRC1, SRC2);
@@ -381,148 +371,41 @@ static inline void vmaxss(XMM src, XMM vsrc, XMM *res) {
 
 /************* Compare *************/
 static inline void vucomiss(XMM src, XMM dst, struct pt_regs *regs) {
-    unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
-    float SRC1 = dst.fa32[0];
-    float SRC2 = src.fa32[0];
-    
-    //UNORDERED
-    if ((isNaN_f32(SRC1)) || (isNaN_f32(SRC1))) {
-        FLAGS |= 0x00000040; //set ZF = 1
-        FLAGS |= 0x00000004; //set PF = 1
-        FLAGS |= 0x00000001; //set CF = 1
-    }
-    //GREATER_THAN
-    if (SRC1 > SRC2) {
-        FLAGS = (FLAGS | 0x00000040) ^ 0x00000040;  //set ZF = 0
-        FLAGS = (FLAGS | 0x00000004) ^ 0x00000004;  //set PF = 0
-        FLAGS = (FLAGS | 0x00000001) ^ 0x00000001;  //set CF = 0
-    }
-    //LESS_THAN
-    if (SRC1 < SRC2) {
-        FLAGS = (FLAGS | 0x00000040) ^ 0x00000040;  //set ZF = 0
-        FLAGS = (FLAGS | 0x00000004) ^ 0x00000004;  //set PF = 0
-        FLAGS |= 0x00000001; //set CF = 1
-    }
-    //EQUAL
-    if (SRC1 == SRC2) {
-        FLAGS |= 0x00000040; //set ZF = 1
-        FLAGS = (FLAGS | 0x00000004) ^ 0x00000004;  //set PF = 0
-        FLAGS = (FLAGS | 0x00000001) ^ 0x00000001;  //set CF = 0
-    }
-    
-    FLAGS = (FLAGS | 0x00000800) ^ 0x00000800;  //set OF = 0
-    FLAGS = (FLAGS | 0x00000010) ^ 0x00000010;  //set AF = 0
-    FLAGS = (FLAGS | 0x00000080) ^ 0x00000080;  //set SF = 0
-    
-    regs->flags = FLAGS;
+    regs->flags = (regs->flags & ~0x8D5UL) | fpcmp_eflags(dst.u8, src.u8, 32, 0);
+}
+static inline void vcomiss(XMM src, XMM dst, struct pt_regs *regs) {
+    regs->flags = (regs->flags & ~0x8D5UL) | fpcmp_eflags(dst.u8, src.u8, 32, 1);
 }
 static inline void vcmpps_128(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
-    int i;
-    int CMP = 0;
-    float SRC1, SRC2;
-    uint8_t immvar = imm & 31;
-    
-    for (i = 0; i < 4; ++i) {
-        SRC1 = vsrc.fa32[i];
-        SRC2 = src.fa32[i];
-        CMP = cmpoptsf(SRC1, SRC2, immvar);
-        if (CMP)
-            res->u32[i] = 0xFFFFFFFF;
-        else
-            res->u32[i] = 0;
-    }
+    fpcmp_packed(res->u8, vsrc.u8, src.u8, 16, 32, imm);
 }
 static inline void vcmpps_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    int i;
-    int CMP = 0;
-    float SRC1, SRC2;
-    uint8_t immvar = imm & 31;
-    
-    for (i = 0; i < 8; ++i) {
-        SRC1 = vsrc.fa32[i];
-        SRC2 = src.fa32[i];
-        CMP = cmpoptsf(SRC1, SRC2, immvar);
-        if (CMP)
-            res->u32[i] = 0xFFFFFFFF;
-        else
-            res->u32[i] = 0;
-    }
+    fpcmp_packed(res->u8, vsrc.u8, src.u8, 32, 32, imm);
 }
 static inline void vcmpss(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
-    int CMP = 0;
-    uint8_t immvar = imm & 31;
-    res->u128 = vsrc.u128;
-    float SRC1 = vsrc.fa32[0];
-    float SRC2 = src.fa32[0];
-    CMP = cmpoptsf(SRC1, SRC2, immvar);
-    if (CMP)
-        res->u32[0] = 0xFFFFFFFF;
-    else
-        res->u32[0] = 0;
+    fpcmp_scalar(res->u8, vsrc.u8, src.u8, 32, imm);
 }
 
 /************* Interleave *************/
 static inline void vunpcklps_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa32[0] = vsrc.fa32[0];
-    res->fa32[1] = src.fa32[0];
-    res->fa32[2] = vsrc.fa32[1];
-    res->fa32[3] = src.fa32[1];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_UNPCKLDQ, 0), 16);
 }
 static inline void vunpcklps_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa32[0] = vsrc.fa32[0];
-    res->fa32[1] = src.fa32[0];
-    res->fa32[2] = vsrc.fa32[1];
-    res->fa32[3] = src.fa32[1];
-    res->fa32[4] = vsrc.fa32[4];
-    res->fa32[5] = src.fa32[4];
-    res->fa32[6] = vsrc.fa32[5];
-    res->fa32[7] = src.fa32[5];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_UNPCKLDQ, 0), 32);
 }
 static inline void vunpckhps_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa32[0] = vsrc.fa32[2];
-    res->fa32[1] = src.fa32[2];
-    res->fa32[2] = vsrc.fa32[3];
-    res->fa32[3] = src.fa32[3];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_UNPCKHDQ, 0), 16);
 }
 static inline void vunpckhps_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa32[0] = vsrc.fa32[2];
-    res->fa32[1] = src.fa32[2];
-    res->fa32[2] = vsrc.fa32[3];
-    res->fa32[3] = src.fa32[3];
-    res->fa32[4] = vsrc.fa32[6];
-    res->fa32[5] = src.fa32[6];
-    res->fa32[6] = vsrc.fa32[7];
-    res->fa32[7] = src.fa32[7];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_UNPCKHDQ, 0), 32);
 }
 /************* Select *************/
 static inline void vshufps_128(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
-    int imm0 = imm & 3;
-    int imm1 = (imm >> 2) & 3;
-    int imm2 = (imm >> 4) & 3;
-    int imm3 = (imm >> 6) & 3;
-    
-    res->fa32[0] = vsrc.fa32[imm0];
-    res->fa32[1] = vsrc.fa32[imm1];
-    res->fa32[2] = src.fa32[imm2];
-    res->fa32[3] = src.fa32[imm3];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_SHUFPS, imm), 16);
 }
 
 static inline void vshufps_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    int imm0 = imm & 3;
-    int imm1 = (imm >> 2) & 3;
-    int imm2 = (imm >> 4) & 3;
-    int imm3 = (imm >> 6) & 3;
-    
-    res->fa32[0] = vsrc.fa32[imm0];
-    res->fa32[1] = vsrc.fa32[imm1];
-    res->fa32[2] = src.fa32[imm2];
-    res->fa32[3] = src.fa32[imm3];
-    res->fa32[4] = vsrc.fa32[imm0];
-    res->fa32[5] = vsrc.fa32[imm1];
-    res->fa32[6] = src.fa32[imm2];
-    res->fa32[7] = src.fa32[imm3];
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_SHUFPS, imm), 32);
 }
 
 /************* Computes *************/
@@ -878,7 +878,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xD1: //VPSRLW
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsrlw_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -887,7 +887,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xD2: //VPSRLD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsrld_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -896,7 +896,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xD3: //VPSRLQ
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsrlq_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -905,7 +905,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xE1: //VPSRAW
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsraw_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -914,7 +914,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xE2: //VPSRAD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsrad_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -923,7 +923,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xF1: //VPSLLW
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsllw_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -932,7 +932,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xF2: //VPSLLD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpslld_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -941,7 +941,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xF3: //VPSLLQ
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = xmmsrc.u8[0];
+                        uint64_t count = xmmsrc.u64[0];
                         vpsllq_128(xmmvsrc, &xmmres, count);
                         _load_xmm(num_dst, &xmmres);
                     }
@@ -1072,7 +1072,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0x2F: //VCOMISD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        vucomusd(xmmsrc, xmmdst, regs);
+                        vcomisd(xmmsrc, xmmdst, regs);
                     }
                 }
                 break;
@@ -1789,7 +1789,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xD1: //VPSRLW
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsrlw_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1798,7 +1798,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xD2: //VPSRLD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsrld_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1807,7 +1807,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xD3: //VPSRLQ
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsrlq_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1816,7 +1816,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xE1: //VPSRAW
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsraw_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1825,7 +1825,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xE2: //VPSRAD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsrad_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1834,7 +1834,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xF1: //VPSLLW
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsllw_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1843,7 +1843,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xF2: //VPSLLD
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpslld_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1852,7 +1852,7 @@ int vsse2_instruction(struct pt_regs *regs,
             case 0xF3: //VPSLLQ
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
-                        uint8_t count = ymmsrc.u8[0];
+                        uint64_t count = ymmsrc.u64[0];
                         vpsllq_256(ymmvsrc, &ymmres, count);
                         _load_ymm(num_dst, &ymmres);
                     }
@@ -1890,6 +1890,7 @@ int vsse2_instruction(struct pt_regs *regs,
                         _load_ymm(num_dst, &ymmres);
                     }
                 }
+                break;
             case 0x68: //VPUNPCKHBW Byte
                 if (simd_prefix == 1) { //66
                     if (leading_opcode == 1) {//0F
@@ -2047,144 +2048,3 @@ int mindf(double SRC1, double SRC2) {
 
     return 0;
 }
-
-//comparison predicate operand
-int cmpoptdf(double SRC1, double SRC2, uint8_t immvar) {
-    int opt = 0;
-    
-    switch(immvar) {
-        case 0:
-            if (SRC1 == SRC2) opt = 1;
-            break;
-        case 1:
-            if (SRC1 < SRC2) opt = 1;
-            break;
-        case 2:
-            if (SRC1 <= SRC2) opt = 1;
-            break;
-        case 3:
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 4:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 5:
-            if (SRC1 >= SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 6:
-            if (SRC1 > SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 7:
-            opt = 1;
-            if (isNaN_f64(SRC1)) opt = 0;
-            if (isNaN_f64(SRC2)) opt = 0;
-            break;
-        case 8:
-            if (SRC1 == SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 9:
-            if (SRC1 < SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 10:
-            if (SRC1 <= SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-           break;
-        case 11:
-            opt = 0;
-            break;
-        case 12:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 0;
-            if (isNaN_f64(SRC2)) opt = 0;
-            break;
-        case 13:
-            if (SRC1 >= SRC2) opt = 1;
-            break;
-        case 14:
-            if (SRC1 > SRC2) opt = 1;
-            break;
-        case 15:
-            opt = 1;
-            break;
-        case 16:
-            if (SRC1 == SRC2) opt = 1;
-            break;
-        case 17:
-            if (SRC1 < SRC2) opt = 1;
-            break;
-        case 18:
-            if (SRC1 <= SRC2) opt = 1;
-            break;
-        case 19:
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 20:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-           break;
-        case 21:
-            if (SRC1 >= SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 22:
-            if (SRC1 > SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 23:
-            opt = 1;
-            if (isNaN_f64(SRC1)) opt = 0;
-            if (isNaN_f64(SRC2)) opt = 0;
-            break;
-        case 24:
-            if (SRC1 == SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 25:
-            if (SRC1 < SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 26:
-            if (SRC1 <= SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 1;
-            if (isNaN_f64(SRC2)) opt = 1;
-            break;
-        case 27:
-            opt = 0;
-            break;
-        case 28:
-            if (SRC1 != SRC2) opt = 1;
-            if (isNaN_f64(SRC1)) opt = 0;
-            if (isNaN_f64(SRC2)) opt = 0;
-            break;
-        case 29:
-            if (SRC1 >= SRC2) opt = 1;
-            break;
-        case 30:
-            if (SRC1 > SRC2) opt = 1;
-            break;
-        case 31:
-            opt = 1;
-            break;
-        default: return 0;
-    }
-    
-    return opt;
-}
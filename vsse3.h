@@ -10,6 +10,8 @@
 #define vsse3_h
 
 #include "optrap.h"
+#include "fpops.h"
+#include "fpred.h"
 
 int vsse3_instruction(struct pt_regs *regs,
                       uint8_t vexreg,
@@ -82,87 +84,135 @@ static inline void vlddqu_256(YMM src, YMM *res) {
 }
 
 static inline void vhaddpd_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa64[0] = vsrc.fa64[0] + vsrc.fa64[1];
-    res->fa64[1] = src.fa64[0] + src.fa64[1];
+    if (!opemu_softfp()) {
+        fpred_hpd(res->u8, vsrc.u8, src.u8, 16, 0);
+        return;
+    }
+    res->u64[0] = fp64_add(vsrc.u64[0], vsrc.u64[1]);
+    res->u64[1] = fp64_add(src.u64[0], src.u64[1]);
 }
 static inline void vhaddpd_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa64[0] = vsrc.fa64[0] + vsrc.fa64[1];
-    res->fa64[1] = src.fa64[0] + src.fa64[1];
-    res->fa64[2] = vsrc.fa64[2] + vsrc.fa64[3];
-    res->fa64[3] = src.fa64[2] + src.fa64[3];
+    if (!opemu_softfp()) {
+        fpred_hpd(res->u8, vsrc.u8, src.u8, 32, 0);
+        return;
+    }
+    res->u64[0] = fp64_add(vsrc.u64[0], vsrc.u64[1]);
+    res->u64[1] = fp64_add(src.u64[0], src.u64[1]);
+    res->u64[2] = fp64_add(vsrc.u64[2], vsrc.u64[3]);
+    res->u64[3] = fp64_add(src.u64[2], src.u64[3]);
 }
 
 static inline void vhaddps_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa32[0] = vsrc.fa32[0] + vsrc.fa32[1];
-    res->fa32[1] = vsrc.fa32[2] + vsrc.fa32[3];
-    res->fa32[2] = src.fa32[0] + src.fa32[1];
-    res->fa32[3] = src.fa32[2] + src.fa32[3];
+    if (!opemu_softfp()) {
+        fpred_hps(res->u8, vsrc.u8, src.u8, 16, 0);
+        return;
+    }
+    res->u32[0] = fp32_add(vsrc.u32[0], vsrc.u32[1]);
+    res->u32[1] = fp32_add(vsrc.u32[2], vsrc.u32[3]);
+    res->u32[2] = fp32_add(src.u32[0], src.u32[1]);
+    res->u32[3] = fp32_add(src.u32[2], src.u32[3]);
 }
 static inline void vhaddps_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa32[0] = vsrc.fa32[0] + vsrc.fa32[1];
-    res->fa32[1] = vsrc.fa32[2] + vsrc.fa32[3];
-    res->fa32[2] = src.fa32[0] + src.fa32[1];
-    res->fa32[3] = src.fa32[2] + src.fa32[3];
-    res->fa32[4] = vsrc.fa32[4] + vsrc.fa32[5];
-    res->fa32[5] = vsrc.fa32[6] + vsrc.fa32[7];
-    res->fa32[6] = src.fa32[4] + src.fa32[5];
-    res->fa32[7] = src.fa32[6] + src.fa32[7];
+    if (!opemu_softfp()) {
+        fpred_hps(res->u8, vsrc.u8, src.u8, 32, 0);
+        return;
+    }
+    res->u32[0] = fp32_add(vsrc.u32[0], vsrc.u32[1]);
+    res->u32[1] = fp32_add(vsrc.u32[2], vsrc.u32[3]);
+    res->u32[2] = fp32_add(src.u32[0], src.u32[1]);
+    res->u32[3] = fp32_add(src.u32[2], src.u32[3]);
+    res->u32[4] = fp32_add(vsrc.u32[4], vsrc.u32[5]);
+    res->u32[5] = fp32_add(vsrc.u32[6], vsrc.u32[7]);
+    res->u32[6] = fp32_add(src.u32[4], src.u32[5]);
+    res->u32[7] = fp32_add(src.u32[6], src.u32[7]);
 }
 
 static inline void vhsubpd_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa64[0] = vsrc.fa64[0] - vsrc.fa64[1];
-    res->fa64[1] = src.fa64[0] - src.fa64[1];
+    if (!opemu_softfp()) {
+        fpred_hpd(res->u8, vsrc.u8, src.u8, 16, 1);
+        return;
+    }
+    res->u64[0] = fp64_sub(vsrc.u64[0], vsrc.u64[1]);
+    res->u64[1] = fp64_sub(src.u64[0], src.u64[1]);
 }
 static inline void vhsubpd_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa64[0] = vsrc.fa64[0] - vsrc.fa64[1];
-    res->fa64[1] = src.fa64[0] - src.fa64[1];
-    res->fa64[2] = vsrc.fa64[2] - vsrc.fa64[3];
-    res->fa64[3] = src.fa64[2] - src.fa64[3];
+    if (!opemu_softfp()) {
+        fpred_hpd(res->u8, vsrc.u8, src.u8, 32, 1);
+        return;
+    }
+    res->u64[0] = fp64_sub(vsrc.u64[0], vsrc.u64[1]);
+    res->u64[1] = fp64_sub(src.u64[0], src.u64[1]);
+    res->u64[2] = fp64_sub(vsrc.u64[2], vsrc.u64[3]);
+    res->u64[3] = fp64_sub(src.u64[2], src.u64[3]);
 }
 
 static inline void vhsubps_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa32[0] = vsrc.fa32[0] - vsrc.fa32[1];
-    res->fa32[1] = vsrc.fa32[2] - vsrc.fa32[3];
-    res->fa32[2] = src.fa32[0] - src.fa32[1];
-    res->fa32[3] = src.fa32[2] - src.fa32[3];
+    if (!opemu_softfp()) {
+        fpred_hps(res->u8, vsrc.u8, src.u8, 16, 1);
+        return;
+    }
+    res->u32[0] = fp32_sub(vsrc.u32[0], vsrc.u32[1]);
+    res->u32[1] = fp32_sub(vsrc.u32[2], vsrc.u32[3]);
+    res->u32[2] = fp32_sub(src.u32[0], src.u32[1]);
+    res->u32[3] = fp32_sub(src.u32[2], src.u32[3]);
 }
 static inline void vhsubps_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa32[0] = vsrc.fa32[0] - vsrc.fa32[1];
-    res->fa32[1] = vsrc.fa32[2] - vsrc.fa32[3];
-    res->fa32[2] = src.fa32[0] - src.fa32[1];
-    res->fa32[3] = src.fa32[2] - src.fa32[3];
-    res->fa32[4] = vsrc.fa32[4] - vsrc.fa32[5];
-    res->fa32[5] = vsrc.fa32[6] - vsrc.fa32[7];
-    res->fa32[6] = src.fa32[4] - src.fa32[5];
-    res->fa32[7] = src.fa32[6] - src.fa32[7];
+    if (!opemu_softfp()) {
+        fpred_hps(res->u8, vsrc.u8, src.u8, 32, 1);
+        return;
+    }
+    res->u32[0] = fp32_sub(vsrc.u32[0], vsrc.u32[1]);
+    res->u32[1] = fp32_sub(vsrc.u32[2], vsrc.u32[3]);
+    res->u32[2] = fp32_sub(src.u32[0], src.u32[1]);
+    res->u32[3] = fp32_sub(src.u32[2], src.u32[3]);
+    res->u32[4] = fp32_sub(vsrc.u32[4], vsrc.u32[5]);
+    res->u32[5] = fp32_sub(vsrc.u32[6], vsrc.u32[7]);
+    res->u32[6] = fp32_sub(src.u32[4], src.u32[5]);
+    res->u32[7] = fp32_sub(src.u32[6], src.u32[7]);
 }
 
 static inline void vaddsubpd_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa64[0] = vsrc.fa64[0] - src.fa64[0];
-    res->fa64[1] = vsrc.fa64[1] + src.fa64[1];
+    if (!opemu_softfp()) {
+        fpred_addsubpd(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
+    res->u64[0] = fp64_sub(vsrc.u64[0], src.u64[0]);
+    res->u64[1] = fp64_add(vsrc.u64[1], src.u64[1]);
 }
 static inline void vaddsubpd_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa64[0] = vsrc.fa64[0] - src.fa64[0];
-    res->fa64[1] = vsrc.fa64[1] + src.fa64[1];
-    res->fa64[2] = vsrc.fa64[2] - src.fa64[2];
-    res->fa64[3] = vsrc.fa64[3] + src.fa64[3];
+    if (!opemu_softfp()) {
+        fpred_addsubpd(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
+    res->u64[0] = fp64_sub(vsrc.u64[0], src.u64[0]);
+    res->u64[1] = fp64_add(vsrc.u64[1], src.u64[1]);
+    res->u64[2] = fp64_sub(vsrc.u64[2], src.u64[2]);
+    res->u64[3] = fp64_add(vsrc.u64[3], src.u64[3]);
 }
 
 static inline void vaddsubps_128(XMM src, XMM vsrc, XMM *res) {
-    res->fa32[0] = vsrc.fa32[0] - src.fa32[0];
-    res->fa32[1] = vsrc.fa32[1] + src.fa32[1];
-    res->fa32[2] = vsrc.fa32[2] - src.fa32[2];
-    res->fa32[3] = vsrc.fa32[3] + src.fa32[3];
+    if (!opemu_softfp()) {
+        fpred_addsubps(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
+    res->u32[0] = fp32_sub(vsrc.u32[0], src.u32[0]);
+    res->u32[1] = fp32_add(vsrc.u32[1], src.u32[1]);
+    res->u32[2] = fp32_sub(vsrc.u32[2], src.u32[2]);
+    res->u32[3] = fp32_add(vsrc.u32[3], src.u32[3]);
 }
 static inline void vaddsubps_256(YMM src, YMM vsrc, YMM *res) {
-    res->fa32[0] = vsrc.fa32[0] - src.fa32[0];
-    res->fa32[1] = vsrc.fa32[1] + src.fa32[1];
-    res->fa32[2] = vsrc.fa32[2] - src.fa32[2];
-    res->fa32[3] = vsrc.fa32[3] + src.fa32[3];
-    res->fa32[4] = vsrc.fa32[4] - src.fa32[4];
-    res->fa32[5] = vsrc.fa32[5] + src.fa32[5];
-    res->fa32[6] = vsrc.fa32[6] - src.fa32[6];
-    res->fa32[7] = vsrc.fa32[7] + src.fa32[7];
+    if (!opemu_softfp()) {
+        fpred_addsubps(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
+    res->u32[0] = fp32_sub(vsrc.u32[0], src.u32[0]);
+    res->u32[1] = fp32_add(vsrc.u32[1], src.u32[1]);
+    res->u32[2] = fp32_sub(vsrc.u32[2], src.u32[2]);
+    res->u32[3] = fp32_add(vsrc.u32[3], src.u32[3]);
+    res->u32[4] = fp32_sub(vsrc.u32[4], src.u32[4]);
+    res->u32[5] = fp32_add(vsrc.u32[5], src.u32[5]);
+    res->u32[6] = fp32_sub(vsrc.u32[6], src.u32[6]);
+    res->u32[7] = fp32_add(vsrc.u32[7], src.u32[7]);
 }
 
 #endif /* vsse3_h */
@@ -84,7 +84,8 @@ int vsse41_instruction(struct pt_regs *regs,
                     }
                     //VINSERTPS
                     if (leading_opcode == 3) {//0F3A
-                        vinsertps(xmmsrc, xmmvsrc, &xmmres, imm);
+                        //m32 form: the loaded dword is element 0
+                        vinsertps(xmmsrc, xmmvsrc, &xmmres, (mod == 3) ? imm : imm & 0x3F);
                         _load_xmm(num_dst, &xmmres);
                         ins_size++;
                     }
@@ -11,6 +11,10 @@
 
 #include "optrap.h"
 #include "fpins.h"
+#include "fpops.h"
+#include "perm.h"
+#include "sse2int.h"
+#include "fpred.h"
 
 int vsse41_instruction(struct pt_regs *regs,
                        uint8_t vexreg,
@@ -54,210 +58,233 @@ static inline void vpinsrq(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
     res->u64[sel] = src.u64[0];
 }
 static inline void vinsertps(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
-    int i;
-    int xbit;
-
-    int count_s = (imm >> 6) & 3;
-    int count_d = (imm >> 4) & 3;
-    int zmask = imm & 15;
-    float tmp = src.fa32[count_s];
-    XMM tmp2;
-
-    tmp2.u128 = vsrc.u128;
-    tmp2.fa32[count_d] = tmp;
-
-    for (i = 0; i < 4; ++i) {
-        xbit = (zmask >> i) & 1;
-        if (xbit)
-            res->fa32[i] = 0;
-        else
-            res->fa32[i] = tmp2.fa32[i];
-    }
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_INSERTPS, imm), 16);
 }
 
 static inline void vpmovsxbw_128(XMM src, XMM *res) {
-    int i;
+    XMM sign;
 
-    for (i = 0; i < 8; ++i) {
-        res->a16[i] = src.a8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 1, 2, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 16);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXBW, 0), 16);
 }
 static inline void vpmovsxbw_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 16; ++i) {
-        res->a16[i] = src.a8[i];
+    YMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 1, 2, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 32);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXBW, 0), 32);
 }
 
 static inline void vpmovsxbd_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->a32[i] = src.a8[i];
+    XMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 1, 4, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 16);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXBD, 0), 16);
 }
 static inline void vpmovsxbd_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 8; ++i) {
-        res->a32[i] = src.a8[i];
+    YMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 1, 4, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 32);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXBD, 0), 32);
 }
 
 static inline void vpmovsxbq_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 2; ++i) {
-        res->a64[i] = src.a8[i];
+    XMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 1, 8, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 16);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXBQ, 0), 16);
 }
 static inline void vpmovsxbq_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->a64[i] = src.a8[i];
+    YMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 1, 8, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 32);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXBQ, 0), 32);
 }
 
 static inline void vpmovsxwd_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->a32[i] = src.a16[i];
+    XMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 2, 4, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 16);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXWD, 0), 16);
 }
 static inline void vpmovsxwd_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 8; ++i) {
-        res->a32[i] = src.a16[i];
+    YMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 2, 4, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 32);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXWD, 0), 32);
 }
 
 static inline void vpmovsxwq_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 2; ++i) {
-        res->a64[i] = src.a16[i];
+    XMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 2, 8, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 16);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXWQ, 0), 16);
 }
 static inline void vpmovsxwq_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->a64[i] = src.a16[i];
+    YMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 2, 8, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 32);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXWQ, 0), 32);
 }
 
 static inline void vpmovsxdq_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 2; ++i) {
-        res->a64[i] = src.a32[i];
+    XMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 4, 8, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 16);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXDQ, 0), 16);
 }
 static inline void vpmovsxdq_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->a64[i] = src.a32[i];
+    YMM sign;
+
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 4, 8, 1);
+        return;
     }
+    perm_signs(sign.u8, src.u8, 32);
+    perm_apply(res->u8, src.u8, sign.u8, perm_imm(PERM_PMOVSXDQ, 0), 32);
 }
 
 static inline void vpmovzxbw_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 8; ++i) {
-        res->u16[i] = src.u8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 1, 2, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXBW, 0), 16);
 }
 static inline void vpmovzxbw_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 16; ++i) {
-        res->u16[i] = src.u8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 1, 2, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXBW, 0), 32);
 }
 
 static inline void vpmovzxbd_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->u32[i] = src.u8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 1, 4, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXBD, 0), 16);
 }
 static inline void vpmovzxbd_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 8; ++i) {
-        res->u32[i] = src.u8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 1, 4, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXBD, 0), 32);
 }
 
 static inline void vpmovzxbq_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 2; ++i) {
-        res->u64[i] = src.u8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 1, 8, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXBQ, 0), 16);
 }
 static inline void vpmovzxbq_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->u64[i] = src.u8[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 1, 8, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXBQ, 0), 32);
 }
 
 static inline void vpmovzxwd_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->u32[i] = src.u16[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 2, 4, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXWD, 0), 16);
 }
 static inline void vpmovzxwd_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 8; ++i) {
-        res->u32[i] = src.u16[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 2, 4, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXWD, 0), 32);
 }
 
 static inline void vpmovzxwq_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 2; ++i) {
-        res->u64[i] = src.u16[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 2, 8, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXWQ, 0), 16);
 }
 static inline void vpmovzxwq_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->u64[i] = src.u16[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 2, 8, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXWQ, 0), 32);
 }
 
 static inline void vpmovzxdq_128(XMM src, XMM *res) {
-    int i;
-    
-    for (i = 0; i < 2; ++i) {
-        res->u64[i] = src.u32[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 16, 4, 8, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXDQ, 0), 16);
 }
 static inline void vpmovzxdq_256(YMM src, YMM *res) {
-    int i;
-    
-    for (i = 0; i < 4; ++i) {
-        res->u64[i] = src.u32[i];
+    if (!opemu_softfp()) {
+        sse2_pmovx(res->u8, src.u8, 32, 4, 8, 0);
+        return;
     }
+    perm_apply(res->u8, src.u8, NULL, perm_imm(PERM_PMOVZXDQ, 0), 32);
 }
 
 /************* Convert *************/
 static inline void vpackusdw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_packusdw(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         res->u16[i] = STUW(vsrc.a32[i]);
         res->u16[i+4] = STUW(src.a32[i]);
@@ -265,6 +292,11 @@ static inline void vpackusdw_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpackusdw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_packusdw(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         res->u16[i] = STUW(vsrc.a32[i]);
         res->u16[i+4] = STUW(src.a32[i]);
@@ -278,6 +310,11 @@ static inline void vpackusdw_256(YMM src, YMM vsrc, YMM *res) {
 /************* Compare *************/
 static inline void vpcmpeqq_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_pcmpeqq(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
         if (vsrc.u64[i] == src.u64[i])
             res->u64[i] = 0xffffffffffffffff;
@@ -287,6 +324,11 @@ static inline void vpcmpeqq_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpcmpeqq_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_pcmpeqq(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         if (vsrc.u64[i] == src.u64[i])
             res->u64[i] = 0xffffffffffffffff;
@@ -296,6 +338,11 @@ static inline void vpcmpeqq_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpmaxsb_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 16, 1, 1);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.a8[i] > src.a8[i])
             res->a8[i] = vsrc.a8[i];
@@ -305,6 +352,11 @@ static inline void vpmaxsb_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpmaxsb_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 32, 1, 1);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         if (vsrc.a8[i] > src.a8[i])
             res->a8[i] = vsrc.a8[i];
@@ -314,6 +366,11 @@ static inline void vpmaxsb_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpmaxsw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 16, 1, 1);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.a16[i] > src.a16[i])
             res->a16[i] = vsrc.a16[i];
@@ -323,6 +380,11 @@ static inline void vpmaxsw_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpmaxsw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 32, 1, 1);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.a16[i] > src.a16[i])
             res->a16[i] = vsrc.a16[i];
@@ -332,6 +394,11 @@ static inline void vpmaxsw_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpmaxsd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 16, 1, 1);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         if (vsrc.a32[i] > src.a32[i])
             res->a32[i] = vsrc.a32[i];
@@ -341,6 +408,11 @@ static inline void vpmaxsd_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpmaxsd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 32, 1, 1);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.a32[i] > src.a32[i])
             res->a32[i] = vsrc.a32[i];
@@ -351,6 +423,11 @@ static inline void vpmaxsd_256(YMM src, YMM vsrc, YMM *res) {
 
 static inline void vpmaxub_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 16, 1, 0);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.u8[i] > src.u8[i])
             res->u8[i] = vsrc.u8[i];
@@ -360,6 +437,11 @@ static inline void vpmaxub_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpmaxub_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 32, 1, 0);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         if (vsrc.u8[i] > src.u8[i])
             res->u8[i] = vsrc.u8[i];
@@ -369,6 +451,11 @@ static inline void vpmaxub_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpmaxuw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 16, 1, 0);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.u16[i] > src.u16[i])
             res->u16[i] = vsrc.u16[i];
@@ -378,6 +465,11 @@ static inline void vpmaxuw_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpmaxuw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 32, 1, 0);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.u16[i] > src.u16[i])
             res->u16[i] = vsrc.u16[i];
@@ -387,6 +479,11 @@ static inline void vpmaxuw_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpmaxud_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 16, 1, 0);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         if (vsrc.u32[i] > src.u32[i])
             res->u32[i] = vsrc.u32[i];
@@ -396,6 +493,11 @@ static inline void vpmaxud_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpmaxud_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 32, 1, 0);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.u32[i] > src.u32[i])
             res->u32[i] = vsrc.u32[i];
@@ -406,6 +508,11 @@ static inline void vpmaxud_256(YMM src, YMM vsrc, YMM *res) {
 
 static inline void vpminsb_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 16, 0, 1);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.a8[i] < src.a8[i])
             res->a8[i] = vsrc.a8[i];
@@ -415,6 +522,11 @@ static inline void vpminsb_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpminsb_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 32, 0, 1);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         if (vsrc.a8[i] < src.a8[i])
             res->a8[i] = vsrc.a8[i];
@@ -424,6 +536,11 @@ static inline void vpminsb_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpminsw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 16, 0, 1);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.a16[i] < src.a16[i])
             res->a16[i] = vsrc.a16[i];
@@ -433,6 +550,11 @@ static inline void vpminsw_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpminsw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 32, 0, 1);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.a16[i] < src.a16[i])
             res->a16[i] = vsrc.a16[i];
@@ -442,6 +564,11 @@ static inline void vpminsw_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpminsd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 16, 0, 1);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         if (vsrc.a32[i] < src.a32[i])
             res->a32[i] = vsrc.a32[i];
@@ -451,6 +578,11 @@ static inline void vpminsd_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpminsd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 32, 0, 1);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.a32[i] < src.a32[i])
             res->a32[i] = vsrc.a32[i];
@@ -461,6 +593,11 @@ static inline void vpminsd_256(YMM src, YMM vsrc, YMM *res) {
 
 static inline void vpminub_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 16, 0, 0);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.u8[i] < src.u8[i])
             res->u8[i] = vsrc.u8[i];
@@ -470,6 +607,11 @@ static inline void vpminub_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpminub_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxb(res->u8, vsrc.u8, src.u8, 32, 0, 0);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         if (vsrc.u8[i] < src.u8[i])
             res->u8[i] = vsrc.u8[i];
@@ -479,6 +621,11 @@ static inline void vpminub_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpminuw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 16, 0, 0);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.u16[i] < src.u16[i])
             res->u16[i] = vsrc.u16[i];
@@ -488,6 +635,11 @@ static inline void vpminuw_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpminuw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxw(res->u8, vsrc.u8, src.u8, 32, 0, 0);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         if (vsrc.u16[i] < src.u16[i])
             res->u16[i] = vsrc.u16[i];
@@ -497,6 +649,11 @@ static inline void vpminuw_256(YMM src, YMM vsrc, YMM *res) {
 }
 static inline void vpminud_128(XMM src, XMM vsrc, XMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 16, 0, 0);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         if (vsrc.u32[i] < src.u32[i])
             res->u32[i] = vsrc.u32[i];
@@ -506,6 +663,11 @@ static inline void vpminud_128(XMM src, XMM vsrc, XMM *res) {
 }
 static inline void vpminud_256(YMM src, YMM vsrc, YMM *res) {
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_minmaxd(res->u8, vsrc.u8, src.u8, 32, 0, 0);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         if (vsrc.u32[i] < src.u32[i])
             res->u32[i] = vsrc.u32[i];
@@ -516,19 +678,24 @@ static inline void vpminud_256(YMM src, YMM vsrc, YMM *res) {
 
 /************* multiply *************/
 static inline void vpmuldq_128(XMM src, XMM vsrc, XMM *res) {
-    res->a64[0] = vsrc.a32[0] * src.a32[0];
-    res->a64[1] = vsrc.a32[2] * src.a32[2];
+    res->a64[0] = (int64_t)vsrc.a32[0] * src.a32[0];
+    res->a64[1] = (int64_t)vsrc.a32[2] * src.a32[2];
 }
 static inline void vpmuldq_256(YMM src, YMM vsrc, YMM *res) {
-    res->a64[0] = vsrc.a32[0] * src.a32[0];
-    res->a64[1] = vsrc.a32[2] * src.a32[2];
-    res->a64[2] = vsrc.a32[4] * src.a32[4];
-    res->a64[3] = vsrc.a32[6] * src.a32[6];
+    res->a64[0] = (int64_t)vsrc.a32[0] * src.a32[0];
+    res->a64[1] = (int64_t)vsrc.a32[2] * src.a32[2];
+    res->a64[2] = (int64_t)vsrc.a32[4] * src.a32[4];
+    res->a64[3] = (int64_t)vsrc.a32[6] * src.a32[6];
 }
 
 static inline void vpmulld_128(XMM src, XMM vsrc, XMM *res) {
     XMM tmp;
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_pmulld(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         tmp.a64[0] = vsrc.a32[i] * src.a32[i];
         res->a32[i] = tmp.a32[0];
@@ -537,6 +704,11 @@ static inline void vpmulld_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vpmulld_256(YMM src, YMM vsrc, YMM *res) {
     XMM tmp;
     int i;
+
+    if (!opemu_softfp()) {
+        sse2_pmulld(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         tmp.a64[0] = vsrc.a32[i] * src.a32[i];
         res->a32[i] = tmp.a32[0];
@@ -545,125 +717,83 @@ static inline void vpmulld_256(YMM src, YMM vsrc, YMM *res) {
 
 static inline void vdpps_128(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
     int i;
-    int immvar;
     int imm0var = imm & 15;
     int imm4var = imm >> 4;
 
-    XMM temp1, temp2, temp3, temp4;
-    XMM SRC1, SRC2;
-    
-    //127:0 bit
-    SRC1.u128 = vsrc.u128;
-    SRC2.u128 = src.u128;
+    XMM temp1, temp2, temp3;
+
+    if (!opemu_softfp()) {
+        fpred_dpps(res->u8, vsrc.u8, src.u8, 16, imm);
+        return;
+    }
 
+    //every lane sums on its own, in the hardware's operand order
     for (i = 0; i < 4; ++i) {
-        immvar = (imm4var > i) & 1;
-        if (immvar == 1)
-            temp1.fa32[i] = SRC1.fa32[i] * SRC2.fa32[i];
+        if ((imm4var >> i) & 1)
+            temp1.u32[i] = fp32_mul(vsrc.u32[i], src.u32[i]);
         else
-            temp1.fa32[i] = 0.0;
+            temp1.u32[i] = 0;
     }
-    
-    temp2.fa32[0] = temp1.fa32[0] + temp1.fa32[1];
-    temp3.fa32[0] = temp1.fa32[2] + temp1.fa32[3];
-    temp4.fa32[0] = temp2.fa32[0] + temp3.fa32[0];
-    
+    for (i = 0; i < 4; ++i)
+        temp2.u32[i] = fp32_add(temp1.u32[i ^ 1], temp1.u32[i]);
+    for (i = 0; i < 4; ++i)
+        temp3.u32[i] = fp32_add(temp2.u32[i], temp2.u32[i ^ 2]);
+
     for (i = 0; i < 4; ++i) {
-        immvar = (imm0var > i) & 1;
-        if (immvar == 1)
-            res->fa32[i] = temp4.fa32[0];
+        if ((imm0var >> i) & 1)
+            res->u32[i] = temp3.u32[i];
         else
-            res->fa32[i] = 0.0;
+            res->u32[i] = 0;
     }
 }
 
 static inline void vdpps_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    int i;
-    int immvar;
-    int imm0var = imm & 15;
-    int imm4var = imm >> 4;
-    
-    XMM temp1, temp2, temp3, temp4;
-    XMM SRC1, SRC2;
-    
+    XMM SRC1, SRC2, RES;
+
+    if (!opemu_softfp()) {
+        fpred_dpps(res->u8, vsrc.u8, src.u8, 32, imm);
+        return;
+    }
+
     //127:0 bit
     SRC1.u128 = vsrc.u128[0];
     SRC2.u128 = src.u128[0];
-    
-    for (i = 0; i < 4; ++i) {
-        immvar = (imm4var > i) & 1;
-        if (immvar == 1)
-            temp1.fa32[i] = SRC1.fa32[i] * SRC2.fa32[i];
-        else
-            temp1.fa32[i] = 0.0;
-    }
-    
-    temp2.fa32[0] = temp1.fa32[0] + temp1.fa32[1];
-    temp3.fa32[0] = temp1.fa32[2] + temp1.fa32[3];
-    temp4.fa32[0] = temp2.fa32[0] + temp3.fa32[0];
-    
-    for (i = 0; i < 4; ++i) {
-        immvar = (imm0var > i) & 1;
-        if (immvar == 1)
-            res->fa32[i] = temp4.fa32[0];
-        else
-            res->fa32[i] = 0.0;
-    }
-    
+    vdpps_128(SRC2, SRC1, &RES, imm);
+    res->u128[0] = RES.u128;
+
     //255:128 bit
     SRC1.u128 = vsrc.u128[1];
     SRC2.u128 = src.u128[1];
-
-    for (i = 0; i < 4; ++i) {
-        immvar = (imm4var > i) & 1;
-        if (immvar == 1)
-            temp1.fa32[i] = SRC1.fa32[i] * SRC2.fa32[i];
-        else
-            temp1.fa32[i] = 0.0;
-    }
-    
-    temp2.fa32[0] = temp1.fa32[0] + temp1.fa32[1];
-    temp3.fa32[0] = temp1.fa32[2] + temp1.fa32[3];
-    temp4.fa32[0] = temp2.fa32[0] + temp3.fa32[0];
-
-    for (i = 0; i < 4; ++i) {
-        immvar = (imm0var > i) & 1;
-        if (immvar == 1)
-            res->fa32[i+4] = temp4.fa32[0];
-        else
-            res->fa32[i+4] = 0.0;
-    }
+    vdpps_128(SRC2, SRC1, &RES, imm);
+    res->u128[1] = RES.u128;
 }
 
 static inline void vdppd(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
     int i;
-    int immvar;
     int imm0var = imm & 15;
     int imm4var = imm >> 4;
-    
+
     XMM temp1, temp2;
-    XMM SRC1, SRC2;
-    
-    //127:0 bit
-    SRC1.u128 = vsrc.u128;
-    SRC2.u128 = src.u128;
-    
+
+    if (!opemu_softfp()) {
+        fpred_dppd(res->u8, vsrc.u8, src.u8, imm);
+        return;
+    }
+
     for (i = 0; i < 2; ++i) {
-        immvar = (imm4var > i) & 1;
-        if (immvar == 1)
-            temp1.fa64[i] = SRC1.fa64[i] * SRC2.fa64[i];
+        if ((imm4var >> i) & 1)
+            temp1.u64[i] = fp64_mul(vsrc.u64[i], src.u64[i]);
         else
-            temp1.fa64[i] = 0.0;
+            temp1.u64[i] = 0;
     }
-    
-    temp2.fa64[0] = temp1.fa64[0] + temp1.fa64[1];
-    
+    for (i = 0; i < 2; ++i)
+        temp2.u64[i] = fp64_add(temp1.u64[i], temp1.u64[i ^ 1]);
+
     for (i = 0; i < 2; ++i) {
-        immvar = (imm0var > i) & 1;
-        if (immvar == 1)
-            res->fa64[i] = temp2.fa64[0];
+        if ((imm0var >> i) & 1)
+            res->u64[i] = temp2.u64[i];
         else
-            res->fa64[i] = 0.0;
+            res->u64[i] = 0;
     }
 }
 
@@ -679,7 +809,7 @@ static inline void vroundps_128(XMM src, XMM *res, uint8_t imm) {
     }
     
     for (i = 0; i < 4; ++i) {
-        res->fa32[i] = round_fp32(src.fa32[i], rc);
+        res->fa32[i] = round_fp32(src.fa32[i], rc, (imm >> 3) & 1);
     }
 }
 
@@ -695,7 +825,7 @@ static inline void vroundps_256(YMM src, YMM *res, uint8_t imm) {
     }
     
     for (i = 0; i < 8; ++i) {
-        res->fa32[i] = round_fp32(src.fa32[i], rc);
+        res->fa32[i] = round_fp32(src.fa32[i], rc, (imm >> 3) & 1);
     }
 }
 
@@ -711,7 +841,7 @@ static inline void vroundpd_128(XMM src, XMM *res, uint8_t imm) {
     }
     
     for (i = 0; i < 2; ++i) {
-        res->fa64[i] = round_fp64(src.fa64[i], rc);
+        res->fa64[i] = round_fp64(src.fa64[i], rc, (imm >> 3) & 1);
     }
 }
 static inline void vroundpd_256(YMM src, YMM *res, uint8_t imm) {
@@ -726,7 +856,7 @@ static inline void vroundpd_256(YMM src, YMM *res, uint8_t imm) {
     }
     
     for (i = 0; i < 4; ++i) {
-        res->fa64[i] = round_fp64(src.fa64[i], rc);
+        res->fa64[i] = round_fp64(src.fa64[i], rc, (imm >> 3) & 1);
     }
 }
 
@@ -740,7 +870,7 @@ static inline void vroundss(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
         rc = getmxcsr();
     }
     res->u128 = vsrc.u128;
-    res->fa32[0] = round_fp32(src.fa32[0], rc);
+    res->fa32[0] = round_fp32(src.fa32[0], rc, (imm >> 3) & 1);
 }
 
 static inline void vroundsd(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
@@ -753,7 +883,7 @@ static inline void vroundsd(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
         rc = getmxcsr();
     }
     res->u128 = vsrc.u128;
-    res->fa64[0] = round_fp64(src.fa64[0], rc);
+    res->fa64[0] = round_fp64(src.fa64[0], rc, (imm >> 3) & 1);
 }
 
 /************* Select *************/
@@ -819,8 +949,9 @@ static inline void vpblendw_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
     int i;
     int xbit = 0;
     
+    //imm8 selects the words of each 128-bit lane
     for (i = 0; i < 16; ++i) {
-        xbit = (imm >> i) & 1;
+        xbit = (imm >> (i & 7)) & 1;
         if (xbit)
             res->u16[i] = src.u16[i];
         else
@@ -891,6 +1022,10 @@ static inline void vpblendvb_128(XMM src, XMM vsrc, XMM *res, XMM immsrc) {
     int xbit = 0;
     uint8_t mask;
 
+    if (!opemu_softfp()) {
+        sse2_pblendvb(res->u8, vsrc.u8, src.u8, immsrc.u8, 16);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         mask = immsrc.u8[i];
         xbit = (mask >> 7) & 1;
@@ -904,7 +1039,11 @@ static inline void vpblendvb_256(YMM src, YMM vsrc, YMM *res, YMM immsrc) {
     int i;
     int xbit = 0;
     uint8_t mask;
-    
+
+    if (!opemu_softfp()) {
+        sse2_pblendvb(res->u8, vsrc.u8, src.u8, immsrc.u8, 32);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         mask = immsrc.u8[i];
         xbit = (mask >> 7) & 1;
@@ -946,168 +1085,96 @@ static inline void vextractps(XMM dst, XMM *res, uint8_t imm) {
 static inline void vphminposuw(XMM src, XMM *res) {
     int i;
     int index = 0;
-    uint16_t min = src.u16[0];
-    
+
+    if (!opemu_softfp()) {
+        sse2_phminposuw(res->u8, src.u8);
+        return;
+    }
     for (i = 1; i < 8; ++i) {
-        if (src.u16[i] < min)
+        if (src.u16[i] < src.u16[index])
             index = i;
     }
-    min = src.u16[index];
-    
+
     res->u128 = 0;
-    res->u16[0] = min;
+    res->u16[0] = src.u16[index];
     res->u16[1] = index;
 }
 
 static inline void vptest_128(XMM src, XMM dst, struct pt_regs *regs) {
+    uint64_t AND1 = 0, AND2 = 0;
     unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
-    XMM AND1, AND2;
-    
-    AND1.u128 = src.u128 & dst.u128;
-    AND2.u128 = src.u128 & ~(dst.u128);
+    int i;
 
-    if (AND1.u128 == 0) {
-        FLAGS |= 0x00000040; //set ZF = 1
+    if (!opemu_softfp()) {
+        FLAGS = sse2_ptest(src.u8, dst.u8, 16, 1);
     } else {
-        FLAGS = (FLAGS | 0x00000040) ^ 0x00000040;  //set ZF = 0
+        for (i = 0; i < 2; ++i) {
+            AND1 |= src.u64[i] & dst.u64[i];
+            AND2 |= src.u64[i] & ~dst.u64[i];
+        }
+        FLAGS = (unsigned long)(AND1 == 0) << 6 | (AND2 == 0);
     }
-    
-    if (AND2.u128 == 0) {
-        FLAGS |= 0x00000001; //set CF = 1
-    } else {
-        FLAGS = (FLAGS | 0x00000001) ^ 0x00000001;  //set CF = 0
-    }
-
-    FLAGS = (FLAGS | 0x00000800) ^ 0x00000800;  //set OF = 0
-    FLAGS = (FLAGS | 0x00000010) ^ 0x00000010;  //set AF = 0
-    FLAGS = (FLAGS | 0x00000080) ^ 0x00000080;  //set SF = 0
-    FLAGS = (FLAGS | 0x00000004) ^ 0x00000004;  //set PF = 0
-    
-    regs->flags = FLAGS;
+    //ZF and CF, OF, AF, SF and PF = 0
+    regs->flags = (regs->flags & ~0x8D5UL) | FLAGS;
 }
 
 static inline void vptest_256(YMM src, YMM dst, struct pt_regs *regs) {
+    uint64_t AND1 = 0, AND2 = 0;
     unsigned long FLAGS;
-    FLAGS = regs->flags;
-    
-    XMM AND11, AND12, AND21, AND22;
-    
-    AND11.u128 = src.u128[0] & dst.u128[0];
-    AND12.u128 = src.u128[0] & dst.u128[0];
+    int i;
 
-    AND21.u128 = src.u128[1] & ~(dst.u128[1]);
-    AND22.u128 = src.u128[1] & ~(dst.u128[1]);
-    
-    if ( (AND11.u128 == 0) && (AND12.u128 == 0) ) {
-        FLAGS |= 0x00000040; //set ZF = 1
+    if (!opemu_softfp()) {
+        FLAGS = sse2_ptest(src.u8, dst.u8, 32, 1);
     } else {
-        FLAGS = (FLAGS | 0x00000040) ^ 0x00000040;  //set ZF = 0
+        for (i = 0; i < 4; ++i) {
+            AND1 |= src.u64[i] & dst.u64[i];
+            AND2 |= src.u64[i] & ~dst.u64[i];
+        }
+        FLAGS = (unsigned long)(AND1 == 0) << 6 | (AND2 == 0);
     }
-    
-    if  ( (AND21.u128 == 0) && (AND22.u128 == 0) )  {
-        FLAGS |= 0x00000001; //set CF = 1
-    } else {
-        FLAGS = (FLAGS | 0x00000001) ^ 0x00000001;  //set CF = 0
-    }
-
-    FLAGS = (FLAGS | 0x00000800) ^ 0x00000800;  //set OF = 0
-    FLAGS = (FLAGS | 0x00000010) ^ 0x00000010;  //set AF = 0
-    FLAGS = (FLAGS | 0x00000080) ^ 0x00000080;  //set SF = 0
-    FLAGS = (FLAGS | 0x00000004) ^ 0x00000004;  //set PF = 0
-    
-    regs->flags = FLAGS;
+    //ZF and CF, OF, AF, SF and PF = 0
+    regs->flags = (regs->flags & ~0x8D5UL) | FLAGS;
 }
 
 static inline void vmpsadbw_128(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
-    int i;
-    int8_t X;
-    int blk1 = (imm >> 2) & 1 ;  //imm8[2]
-    int blk2 = imm & 3;          //imm8[1:0]
-    XMM src1_byte, src2_byte;
-    uint8_t temp0, temp1, temp2, temp3;
-    
-    src1_byte.u32[0] = vsrc.u32[blk1];
-    src1_byte.u32[0] = vsrc.u32[blk1+1];
-    src1_byte.u32[0] = vsrc.u32[blk1+2];
-    
-    src2_byte.u32[0] = src.u32[blk2];
-    
+    int i, j;
+    int blk1 = ((imm >> 2) & 1) * 4;   //imm8[2]
+    int blk2 = (imm & 3) * 4;          //imm8[1:0]
+    uint8_t x, y;
+
+    if (!opemu_softfp()) {
+        sse2_mpsadbw(res->u8, vsrc.u8, src.u8, 16, imm);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
-        X = src1_byte.a8[i] - src2_byte.a8[0];
-        temp0 = ABS(X);
-        X = src1_byte.a8[1+i] - src2_byte.a8[1];
-        temp1 = ABS(X);
-        X = src1_byte.a8[2+i] - src2_byte.a8[2];
-        temp2 = ABS(X);
-        X = src1_byte.a8[3+i] - src2_byte.a8[3];
-        temp3 = ABS(X);
-        res->u16[i] = temp0 + temp1 + temp2 + temp3;
+        res->u16[i] = 0;
+        for (j = 0; j < 4; ++j) {
+            x = vsrc.u8[blk1 + i + j];
+            y = src.u8[blk2 + j];
+            res->u16[i] += (x > y) ? x - y : y - x;
+        }
     }
 }
 
 static inline void vmpsadbw_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    int i;
-    int8_t X;
-    int blk1;
-    int blk2;
-    XMM src1, src2, src1_byte, src2_byte;
-    XMM dest;
-    uint8_t temp0, temp1, temp2, temp3;
-    
-    //[127:0] bit
-    blk1 = (imm >> 2) & 1; //imm8[2]
-    blk2 = imm & 3;        //imm8[1:0]
-    src1.u128 = vsrc.u128[0];
-    src2.u128 = src.u128[0];
-    
-    src1_byte.u32[0] = src1.u32[blk1];
-    src1_byte.u32[0] = src1.u32[blk1+1];
-    src1_byte.u32[0] = src1.u32[blk1+2];
-    
-    src2_byte.u32[0] = src2.u32[blk2];
-    
-    for (i = 0; i < 8; ++i) {
-        X = src1_byte.a8[i] - src2_byte.a8[0];
-        temp0 = ABS(X);
-        X = src1_byte.a8[i+1] - src2_byte.a8[1];
-        temp1 = ABS(X);
-        X = src1_byte.a8[i+2] - src2_byte.a8[2];
-        temp2 = ABS(X);
-        X = src1_byte.a8[i+3] - src2_byte.a8[3];
-        temp3 = ABS(X);
-        dest.u16[i] = temp0 + temp1 + temp2 + temp3;
-    }
-    
-    res->u128[0] = dest.u128;
-    
-    //[255:128] bit
-    blk1 = (imm >> 5) & 1; //imm8[5]
-    blk2 = (imm >> 3) & 3; //imm8[4:3]
+    XMM SRC1, SRC2, RES;
 
-    src1.u128 = vsrc.u128[1];
-    src2.u128 = src.u128[1];
+    if (!opemu_softfp()) {
+        sse2_mpsadbw(res->u8, vsrc.u8, src.u8, 32, imm);
+        return;
+    }
 
-    src1_byte.u32[0] = src1.u32[blk1];
-    src1_byte.u32[0] = src1.u32[blk1+1];
-    src1_byte.u32[0] = src1.u32[blk1+2];
-    
-    src2_byte.u32[0] = src2.u32[blk2];
+    //[127:0] bit
+    SRC1.u128 = vsrc.u128[0];
+    SRC2.u128 = src.u128[0];
+    vmpsadbw_128(SRC2, SRC1, &RES, imm);
+    res->u128[0] = RES.u128;
 
-    for (i = 0; i < 8; ++i) {
-        X = src1_byte.a8[i] - src2_byte.a8[0];
-        temp0 = ABS(X);
-        X = src1_byte.a8[i+1] - src2_byte.a8[1];
-        temp1 = ABS(X);
-        X = src1_byte.a8[i+2] - src2_byte.a8[2];
-        temp2 = ABS(X);
-        X = src1_byte.a8[i+3] - src2_byte.a8[3];
-        temp3 = ABS(X);
-        dest.u16[i] = temp0 + temp1 + temp2 + temp3;
-    }
-    
-    res->u128[1] = dest.u128;
+    //[255:128] bit, imm8[5:3]
+    SRC1.u128 = vsrc.u128[1];
+    SRC2.u128 = src.u128[1];
+    vmpsadbw_128(SRC2, SRC1, &RES, imm >> 3);
+    res->u128[1] = RES.u128;
 }
 
 #endif /* vsse41_h */
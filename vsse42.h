@@ -76,7 +76,7 @@ static inline void pcmpestrm(XMM src, XMM dst, uint8_t imm, struct pt_regs *regs
     //load mask to xmm0
     XMM res;
     res.a128 = mask;
-    asm __volatile__ ("movdqu %0, %%xmm0" :: "m" (res));
+    _load_xmm(0, &res);
 }
 
 static inline void pcmpestri(XMM src, XMM dst, uint8_t imm, struct pt_regs *regs) {
@@ -114,7 +114,7 @@ static inline void pcmpistrm(XMM src, XMM dst, uint8_t imm, struct pt_regs *regs
     //load mask to xmm0
     XMM res;
     res.a128 = mask;
-    asm __volatile__ ("movdqu %0, %%xmm0" :: "m" (res));
+    _load_xmm(0, &res);
 }
 
 static inline void pcmpistri(XMM src, XMM dst, uint8_t imm, struct pt_regs *regs) {
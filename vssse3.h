@@ -10,6 +10,9 @@
 #define vssse3_h
 
 #include "optrap.h"
+#include "softfloat.h"
+#include "perm.h"
+#include "sse2int.h"
 
 int vssse3_instruction(struct pt_regs *regs,
                        uint8_t vexreg,
@@ -30,45 +33,28 @@ int vssse3_instruction(struct pt_regs *regs,
 /**  VSSSE3  instructions implementation       **/
 /**********************************************/
 static inline void vpshufb_128(XMM src, XMM vsrc, XMM *res) {
-    int i;
-    int index;
-    int xbit;
-    uint8_t mask;
-    for (i = 0; i < 16; ++i) {
-        mask = src.u8[i];
-        xbit = (mask >> 7) & 1;
-        if (xbit) {
-            res->u8[i] = 0;
-        } else {
-            index = src.u8[i] & 15;
-            res->u8[i] = vsrc.u8[index];
+    uint8_t idx[16];
 
-        }
-    }
+    perm_pshufb_idx(idx, src.u8, 16);
+    perm_apply(res->u8, vsrc.u8, NULL, idx, 16);
 }
 static inline void vpshufb_256(YMM src, YMM vsrc, YMM *res) {
-    int i;
-    int index;
-    int xbit;
-    uint8_t mask;
-    for (i = 0; i < 32; ++i) {
-        mask = src.u8[i];
-        xbit = (mask >> 7) & 1;
-        if (xbit) {
-            res->u8[i] = 0;
-        } else {
-            index = src.u8[i] & 15;
-            res->u8[i] = vsrc.u8[index];
-        }
-    }
+    uint8_t idx[32];
 
+    perm_pshufb_idx(idx, src.u8, 32);
+    perm_apply(res->u8, vsrc.u8, NULL, idx, 32);
 }
 
 static inline void vphaddw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 16, 0);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->u16[i] = vsrc.u16[j+1] + vsrc.u16[j];
         res->u16[i+4] = src.u16[j+1] + src.u16[j];
     }
@@ -76,13 +62,18 @@ static inline void vphaddw_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vphaddw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 32, 0);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->u16[i] = vsrc.u16[j+1] + vsrc.u16[j];
         res->u16[i+4] = src.u16[j+1] + src.u16[j];
     }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->u16[i+8] = vsrc.u16[j+9] + vsrc.u16[j+8];
         res->u16[i+12] = src.u16[j+9] + src.u16[j+8];
     }
@@ -91,8 +82,13 @@ static inline void vphaddw_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vphaddd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phd(res->u8, vsrc.u8, src.u8, 16, 0);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->u32[i] = vsrc.u32[j+1] + vsrc.u32[j];
         res->u32[i+2] = src.u32[j+1] + src.u32[j];
     }
@@ -100,13 +96,18 @@ static inline void vphaddd_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vphaddd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phd(res->u8, vsrc.u8, src.u8, 32, 0);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->u32[i] = vsrc.u32[j+1] + vsrc.u32[j];
         res->u32[i+2] = src.u32[j+1] + src.u32[j];
     }
     for (i = 0; i < 2; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->u32[i+4] = vsrc.u32[j+5] + vsrc.u32[j+4];
         res->u32[i+6] = src.u32[j+5] + src.u32[j+4];
     }
@@ -115,9 +116,14 @@ static inline void vphaddd_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vphaddsw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
-    int16_t X;
+    int X;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 16, 2);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         X = vsrc.a16[j+1] + vsrc.a16[j];
         res->a16[i] = STSW(X);
         X = src.a16[j+1] + src.a16[j];
@@ -127,16 +133,21 @@ static inline void vphaddsw_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vphaddsw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
-    int16_t X;
+    int X;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 32, 2);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         X = vsrc.a16[j+1] + vsrc.a16[j];
         res->a16[i] = STSW(X);
         X = src.a16[j+1] + src.a16[j];
         res->a16[i+4] = STSW(X);
     }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         X = vsrc.a16[j+9] + vsrc.a16[j+8];
         res->a16[i+8] = STSW(X);
         X = src.a16[j+9] + src.a16[j+8];
@@ -147,28 +158,43 @@ static inline void vphaddsw_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vpmaddubsw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
-    int16_t X;
+    int X;
+
+    if (!opemu_softfp()) {
+        sse2_pmaddubsw(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
-        j = i < 1;
-        X = (src.a8[j+1] * vsrc.a8[j+1]) + (src.a8[j] * vsrc.a8[j]);
+        j = i * 2;
+        X = (src.a8[j+1] * vsrc.u8[j+1]) + (src.a8[j] * vsrc.u8[j]);
         res->a16[i] = STSW(X);
     }
 }
 static inline void vpmaddubsw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
-    int16_t X;
+    int X;
+
+    if (!opemu_softfp()) {
+        sse2_pmaddubsw(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
-        j = i < 1;
-        X = (src.a8[j+1] * vsrc.a8[j+1]) + (src.a8[j] * vsrc.a8[j]);
+        j = i * 2;
+        X = (src.a8[j+1] * vsrc.u8[j+1]) + (src.a8[j] * vsrc.u8[j]);
         res->a16[i] = STSW(X);
     }
 }
 static inline void vphsubw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 16, 1);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->a16[i] = vsrc.a16[j] - vsrc.a16[j+1];
         res->a16[i+4] = src.a16[j] - src.a16[j+1];
     }
@@ -176,13 +202,18 @@ static inline void vphsubw_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vphsubw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 32, 1);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->a16[i] = vsrc.a16[j] - vsrc.a16[j+1];
         res->a16[i+4] = src.a16[j] - src.a16[j+1];
     }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->a16[i+8] = vsrc.a16[j+8] - vsrc.a16[j+9];
         res->a16[i+12] = src.a16[j+8] - src.a16[j+9];
     }
@@ -191,8 +222,13 @@ static inline void vphsubw_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vphsubd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phd(res->u8, vsrc.u8, src.u8, 16, 1);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->a32[i] = vsrc.a32[j] - vsrc.a32[j+1];
         res->a32[i+2] = src.a32[j] - src.a32[j+1];
     }
@@ -200,13 +236,18 @@ static inline void vphsubd_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vphsubd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
+
+    if (!opemu_softfp()) {
+        sse2_phd(res->u8, vsrc.u8, src.u8, 32, 1);
+        return;
+    }
     for (i = 0; i < 2; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->a32[i] = vsrc.a32[j] - vsrc.a32[j+1];
         res->a32[i+2] = src.a32[j] - src.a32[j+1];
     }
     for (i = 0; i < 2; ++i) {
-        j = i < 1;
+        j = i * 2;
         res->a32[i+4] = vsrc.a32[j+4] - vsrc.a32[j+5];
         res->a32[i+6] = src.a32[j+4] - src.a32[j+5];
     }
@@ -214,9 +255,14 @@ static inline void vphsubd_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vphsubsw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int j;
-    int16_t X;
+    int X;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 16, 3);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         X = vsrc.a16[j] - vsrc.a16[j+1];
         res->a16[i] = STSW(X);
         X = src.a16[j] - src.a16[j+1];
@@ -226,16 +272,21 @@ static inline void vphsubsw_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vphsubsw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int j;
-    int16_t X;
+    int X;
+
+    if (!opemu_softfp()) {
+        sse2_phw(res->u8, vsrc.u8, src.u8, 32, 3);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         X = vsrc.a16[j] - vsrc.a16[j+1];
         res->a16[i] = STSW(X);
         X = src.a16[j] - src.a16[j+1];
         res->a16[i+4] = STSW(X);
     }
     for (i = 0; i < 4; ++i) {
-        j = i < 1;
+        j = i * 2;
         X = vsrc.a16[j+8] - vsrc.a16[j+9];
         res->a16[i+8] = STSW(X);
         X = src.a16[j+8] - src.a16[j+9];
@@ -246,6 +297,11 @@ static inline void vphsubsw_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vpsignb_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int8_t mask;
+
+    if (!opemu_softfp()) {
+        sse2_psign(res->u8, vsrc.u8, src.u8, 16, 1);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         mask = src.a8[i];
         if (mask < 0 )
@@ -253,12 +309,17 @@ static inline void vpsignb_128(XMM src, XMM vsrc, XMM *res) {
         else if (mask == 0 )
             res->u8[i] = 0;
         else if (mask > 0 )
-            res->u8[i] = res->u8[i];
+            res->u8[i] = vsrc.u8[i];
     }
 }
 static inline void vpsignb_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int8_t mask;
+
+    if (!opemu_softfp()) {
+        sse2_psign(res->u8, vsrc.u8, src.u8, 32, 1);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         mask = src.a8[i];
         if (mask < 0 )
@@ -266,13 +327,18 @@ static inline void vpsignb_256(YMM src, YMM vsrc, YMM *res) {
         else if (mask == 0 )
             res->u8[i] = 0;
         else if (mask > 0 )
-            res->u8[i] = res->u8[i];
+            res->u8[i] = vsrc.u8[i];
     }
 }
 
 static inline void vpsignw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int16_t mask;
+
+    if (!opemu_softfp()) {
+        sse2_psign(res->u8, vsrc.u8, src.u8, 16, 2);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         mask = src.a16[i];
         if (mask < 0 )
@@ -280,12 +346,17 @@ static inline void vpsignw_128(XMM src, XMM vsrc, XMM *res) {
         else if (mask == 0 )
             res->u16[i] = 0;
         else if (mask > 0 )
-            res->u16[i] = res->u16[i];
+            res->u16[i] = vsrc.u16[i];
     }
 }
 static inline void vpsignw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int16_t mask;
+
+    if (!opemu_softfp()) {
+        sse2_psign(res->u8, vsrc.u8, src.u8, 32, 2);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         mask = src.a16[i];
         if (mask < 0 )
@@ -293,13 +364,18 @@ static inline void vpsignw_256(YMM src, YMM vsrc, YMM *res) {
         else if (mask == 0 )
             res->u16[i] = 0;
         else if (mask > 0 )
-            res->u16[i] = res->u16[i];
+            res->u16[i] = vsrc.u16[i];
     }
 }
 
 static inline void vpsignd_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     int32_t mask;
+
+    if (!opemu_softfp()) {
+        sse2_psign(res->u8, vsrc.u8, src.u8, 16, 4);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         mask = src.a32[i];
         if (mask < 0 )
@@ -307,12 +383,17 @@ static inline void vpsignd_128(XMM src, XMM vsrc, XMM *res) {
         else if (mask == 0 )
             res->u32[i] = 0;
         else if (mask > 0 )
-            res->u32[i] = res->u32[i];
+            res->u32[i] = vsrc.u32[i];
     }
 }
 static inline void vpsignd_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     int32_t mask;
+
+    if (!opemu_softfp()) {
+        sse2_psign(res->u8, vsrc.u8, src.u8, 32, 4);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         mask = src.a32[i];
         if (mask < 0 )
@@ -320,13 +401,18 @@ static inline void vpsignd_256(YMM src, YMM vsrc, YMM *res) {
         else if (mask == 0 )
             res->u32[i] = 0;
         else if (mask > 0 )
-            res->u32[i] = res->u32[i];
+            res->u32[i] = vsrc.u32[i];
     }
 }
 
 static inline void vpmulhrsw_128(XMM src, XMM vsrc, XMM *res) {
     int i;
     XMM temp;
+
+    if (!opemu_softfp()) {
+        sse2_pmulhrsw(res->u8, vsrc.u8, src.u8, 16);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         temp.a32[0] = ((vsrc.a16[i] * src.a16[i] + 0x4000) >> 15);
         res->a16[i] = temp.a16[0];
@@ -335,6 +421,11 @@ static inline void vpmulhrsw_128(XMM src, XMM vsrc, XMM *res) {
 static inline void vpmulhrsw_256(YMM src, YMM vsrc, YMM *res) {
     int i;
     XMM temp;
+
+    if (!opemu_softfp()) {
+        sse2_pmulhrsw(res->u8, vsrc.u8, src.u8, 32);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         temp.a32[0] = ((vsrc.a16[i] * src.a16[i] + 0x4000) >> 15);
         res->a16[i] = temp.a16[0];
@@ -344,6 +435,11 @@ static inline void vpmulhrsw_256(YMM src, YMM vsrc, YMM *res) {
 static inline void vpabsb_128(XMM src, XMM *res) {
     int i;
     int8_t x;
+
+    if (!opemu_softfp()) {
+        sse2_pabs(res->u8, src.u8, 16, 1);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         x = src.a8[i];
         res->u8[i] = ABS(x);
@@ -352,6 +448,11 @@ static inline void vpabsb_128(XMM src, XMM *res) {
 static inline void vpabsb_256(YMM src, YMM *res) {
     int i;
     int8_t x;
+
+    if (!opemu_softfp()) {
+        sse2_pabs(res->u8, src.u8, 32, 1);
+        return;
+    }
     for (i = 0; i < 32; ++i) {
         x = src.a8[i];
         res->u8[i] = ABS(x);
@@ -361,6 +462,11 @@ static inline void vpabsb_256(YMM src, YMM *res) {
 static inline void vpabsw_128(XMM src, XMM *res) {
     int i;
     int16_t x;
+
+    if (!opemu_softfp()) {
+        sse2_pabs(res->u8, src.u8, 16, 2);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         x = src.a16[i];
         res->u16[i] = ABS(x);
@@ -369,6 +475,11 @@ static inline void vpabsw_128(XMM src, XMM *res) {
 static inline void vpabsw_256(YMM src, YMM *res) {
     int i;
     int16_t x;
+
+    if (!opemu_softfp()) {
+        sse2_pabs(res->u8, src.u8, 32, 2);
+        return;
+    }
     for (i = 0; i < 16; ++i) {
         x = src.a16[i];
         res->u16[i] = ABS(x);
@@ -377,6 +488,11 @@ static inline void vpabsw_256(YMM src, YMM *res) {
 static inline void vpabsd_128(XMM src, XMM *res) {
     int i;
     int32_t x;
+
+    if (!opemu_softfp()) {
+        sse2_pabs(res->u8, src.u8, 16, 4);
+        return;
+    }
     for (i = 0; i < 4; ++i) {
         x = src.a32[i];
         res->u32[i] = ABS(x);
@@ -385,6 +501,11 @@ static inline void vpabsd_128(XMM src, XMM *res) {
 static inline void vpabsd_256(YMM src, YMM *res) {
     int i;
     int32_t x;
+
+    if (!opemu_softfp()) {
+        sse2_pabs(res->u8, src.u8, 32, 4);
+        return;
+    }
     for (i = 0; i < 8; ++i) {
         x = src.a32[i];
         res->u32[i] = ABS(x);
@@ -392,56 +513,10 @@ static inline void vpabsd_256(YMM src, YMM *res) {
 }
 
 static inline void vpalignr_128(XMM src, XMM vsrc, XMM *res, uint8_t imm) {
-    XMM src1, src2;
-    src1.u128 = vsrc.u128;
-    src2.u128 = src.u128;
-    
-    if (imm == 0) {
-        res->u128 = src2.u128;
-    } else if (imm < 16) {
-        res->u128 = (src1.u128 << (128 - (imm * 8))) | (src2.u128 >> (imm * 8));
-    } else if (imm == 16) {
-        res->u128 = src1.u128;
-    } else if (imm < 32) {
-        res->u128 = src1.u128 >> ((imm - 16) * 8);
-    } else if (imm > 31) {
-        res->u128 = 0;
-    }
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_PALIGNR, imm), 16);
 }
 static inline void vpalignr_256(YMM src, YMM vsrc, YMM *res, uint8_t imm) {
-    XMM src1, src2;
-
-    //127:0 bit
-    src1.u128 = vsrc.u128[0];
-    src2.u128 = src.u128[0];
-
-    if (imm == 0) {
-        res->u128[0] = src2.u128;
-    } else if (imm < 16) {
-        res->u128[0] = (src1.u128 << (128 - (imm * 8))) | (src2.u128 >> (imm * 8));
-    } else if (imm == 16) {
-        res->u128[0] = src1.u128;
-    } else if (imm < 32) {
-        res->u128[0] = src1.u128 >> ((imm - 16) * 8);
-    } else if (imm > 31) {
-        res->u128[0] = 0;
-    }
-    
-    //255:128 bit
-    src1.u128 = vsrc.u128[1];
-    src2.u128 = src.u128[1];
-
-    if (imm == 0) {
-        res->u128[1] = src2.u128;
-    } else if (imm < 16) {
-        res->u128[1] = (src1.u128 << (128 - (imm * 8))) | (src2.u128 >> (imm * 8));
-    } else if (imm == 16) {
-        res->u128[1] = src1.u128;
-    } else if (imm < 32) {
-        res->u128[1] = src1.u128 >> ((imm - 16) * 8);
-    } else if (imm > 31) {
-        res->u128[1] = 0;
-    }
+    perm_apply(res->u8, vsrc.u8, src.u8, perm_imm(PERM_PALIGNR, imm), 32);
 }
 
 #endif /* vssse3_h */
@@ -0,0 +1,167 @@
+//
+//  xfile.c
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#include <linux/kernel.h>
+#include <linux/module.h>
+#include <linux/percpu.h>
+#include <linux/preempt.h>
+#include <linux/sched.h>
+#include <linux/version.h>
+#include <asm/fpu/api.h>
+
+#include "xfile.h"
+
+/*********************************************************
+ *** XMM image of the trapping task.                   ***
+ *** The handlers are built with SSE and the compiler  ***
+ *** uses any XMM register as a temporary, the user's  ***
+ *** registers included. opemu_xfile_begin copies the  ***
+ *** sixteen registers to the trap's stack from code   ***
+ *** built -mgeneral-regs-only, before any handler     ***
+ *** runs, and _store_xmm/_load_xmm work on the copy   ***
+ *** while it is published in this CPU's slot. A       ***
+ *** preempt notifier publishes it again on whatever   ***
+ *** CPU the task is scheduled in on. opemu_xfile_end  ***
+ *** loads the copy back, after switch_fpu_return if a ***
+ *** context switch left the registers in the fpstate. ***
+ *** Without preempt notifiers the handlers work on    ***
+ *** the hardware registers as before.                 ***
+ *********************************************************/
+
+DEFINE_PER_CPU(struct opemu_xslot, opemu_xslots);
+
+#ifdef OPEMU_XFILE
+
+static void xfile_save(uint8_t (*xmm)[16])
+{
+    asm volatile ("movdqa %%xmm0, 0(%0)\n\t"    "movdqa %%xmm1, 16(%0)\n\t"
+                  "movdqa %%xmm2, 32(%0)\n\t"   "movdqa %%xmm3, 48(%0)\n\t"
+                  "movdqa %%xmm4, 64(%0)\n\t"   "movdqa %%xmm5, 80(%0)\n\t"
+                  "movdqa %%xmm6, 96(%0)\n\t"   "movdqa %%xmm7, 112(%0)\n\t"
+                  "movdqa %%xmm8, 128(%0)\n\t"  "movdqa %%xmm9, 144(%0)\n\t"
+                  "movdqa %%xmm10, 160(%0)\n\t" "movdqa %%xmm11, 176(%0)\n\t"
+                  "movdqa %%xmm12, 192(%0)\n\t" "movdqa %%xmm13, 208(%0)\n\t"
+                  "movdqa %%xmm14, 224(%0)\n\t" "movdqa %%xmm15, 240(%0)"
+                  :: "r" (xmm) : "memory");
+}
+
+static void xfile_load(uint8_t (*xmm)[16])
+{
+    asm volatile ("movdqa 0(%0), %%xmm0\n\t"    "movdqa 16(%0), %%xmm1\n\t"
+                  "movdqa 32(%0), %%xmm2\n\t"   "movdqa 48(%0), %%xmm3\n\t"
+                  "movdqa 64(%0), %%xmm4\n\t"   "movdqa 80(%0), %%xmm5\n\t"
+                  "movdqa 96(%0), %%xmm6\n\t"   "movdqa 112(%0), %%xmm7\n\t"
+                  "movdqa 128(%0), %%xmm8\n\t"  "movdqa 144(%0), %%xmm9\n\t"
+                  "movdqa 160(%0), %%xmm10\n\t" "movdqa 176(%0), %%xmm11\n\t"
+                  "movdqa 192(%0), %%xmm12\n\t" "movdqa 208(%0), %%xmm13\n\t"
+                  "movdqa 224(%0), %%xmm14\n\t" "movdqa 240(%0), %%xmm15"
+                  :: "r" (xmm) : "memory");
+}
+
+//preemption off, on the CPU the slot belongs to
+static void xfile_publish(struct opemu_xfile *xf, int cpu)
+{
+    struct opemu_xslot *slot = per_cpu_ptr(&opemu_xslots, cpu);
+    int i;
+
+    slot->xmm = xf->xmm;
+    WRITE_ONCE(slot->owner, current);
+
+    for (i = 0; i < min(xf->ncpus, XFILE_CPUS); i++) {
+        if (xf->cpus[i] == cpu)
+            return;
+    }
+    if (xf->ncpus < XFILE_CPUS)
+        xf->cpus[xf->ncpus] = cpu;
+    if (xf->ncpus <= XFILE_CPUS)
+        xf->ncpus++;
+}
+
+static void xfile_sched_in(struct preempt_notifier *pn, int cpu)
+{
+    xfile_publish(container_of(pn, struct opemu_xfile, pn), cpu);
+}
+
+static void xfile_sched_out(struct preempt_notifier *pn, struct task_struct *next)
+{
+}
+
+static struct preempt_ops xfile_ops = {
+    .sched_in  = xfile_sched_in,
+    .sched_out = xfile_sched_out,
+};
+
+void opemu_xfile_begin(struct opemu_xfile *xf)
+{
+    xf->ncpus = 0;
+    preempt_notifier_init(&xf->pn, &xfile_ops);
+
+    fpregs_lock();
+    //preempted since the trap: the user registers are in the fpstate
+    if (test_thread_flag(TIF_NEED_FPU_LOAD))
+        switch_fpu_return();
+    xfile_save(xf->xmm);
+    preempt_notifier_register(&xf->pn);
+    xfile_publish(xf, smp_processor_id());
+    fpregs_unlock();
+}
+
+void opemu_xfile_end(struct opemu_xfile *xf)
+{
+    int cpu, i;
+
+    fpregs_lock();
+    preempt_notifier_unregister(&xf->pn);
+    //the registers hold handler temporaries, live or in the fpstate
+    if (test_thread_flag(TIF_NEED_FPU_LOAD))
+        switch_fpu_return();
+    xfile_load(xf->xmm);
+    fpregs_unlock();
+
+    //no slot may name this task once the image is gone
+    if (xf->ncpus > XFILE_CPUS) {
+        for_each_possible_cpu(cpu)
+            cmpxchg(&per_cpu_ptr(&opemu_xslots, cpu)->owner, current, NULL);
+    } else {
+        for (i = 0; i < xf->ncpus; i++)
+            cmpxchg(&per_cpu_ptr(&opemu_xslots, xf->cpus[i])->owner, current, NULL);
+    }
+}
+
+int opemu_xfile_init(void)
+{
+    preempt_notifier_inc();
+    return 0;
+}
+
+void opemu_xfile_exit(void)
+{
+    preempt_notifier_dec();
+}
+
+#else
+
+//no preempt notifiers: the slot could not follow the task, the handlers use the registers
+void opemu_xfile_begin(struct opemu_xfile *xf)
+{
+}
+
+void opemu_xfile_end(struct opemu_xfile *xf)
+{
+}
+
+int opemu_xfile_init(void)
+{
+    return 0;
+}
+
+void opemu_xfile_exit(void)
+{
+}
+
+#endif
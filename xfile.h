@@ -0,0 +1,81 @@
+//
+//  xfile.h
+//  opemu
+//
+//  Created by Meowthra on 2026/10/17.
+//  Copyright © 2026 Meowthra. All rights reserved.
+//  Made in Taiwan.
+
+#ifndef xfile_h
+#define xfile_h
+
+#define XFILE_CPUS  4       //CPUs a trap remembers, past that every slot is checked at the end
+
+#ifdef __KERNEL__
+
+#include <linux/percpu.h>
+#include <linux/preempt.h>
+#include <linux/sched.h>
+#include <linux/types.h>
+#include <linux/version.h>
+
+//the image can follow a preempted trap to another CPU
+#if defined(CONFIG_PREEMPT_NOTIFIERS) && (LINUX_VERSION_CODE >= KERNEL_VERSION(5,2,0))
+#define OPEMU_XFILE 1
+#endif
+
+//the trap running on this CPU and its image, written only on this CPU
+struct opemu_xslot {
+    struct task_struct *owner;
+    void *xmm;
+};
+
+//on the trap's stack from opemu_xfile_begin to opemu_xfile_end
+struct opemu_xfile {
+    uint8_t xmm[16][16] __aligned(16);
+#ifdef CONFIG_PREEMPT_NOTIFIERS
+    struct preempt_notifier pn;
+#endif
+    int ncpus;
+    int cpus[XFILE_CPUS];
+};
+
+DECLARE_PER_CPU(struct opemu_xslot, opemu_xslots);
+
+void opemu_xfile_begin(struct opemu_xfile *xf);
+void opemu_xfile_end(struct opemu_xfile *xf);
+int opemu_xfile_init(void);
+void opemu_xfile_exit(void);
+
+/** The XMM image of the trap the current task is in, NULL outside one. **/
+static inline void *opemu_xfile_cur(void)
+{
+    void *xmm = NULL;
+
+    preempt_disable();
+    if (__this_cpu_read(opemu_xslots.owner) == current)
+        xmm = __this_cpu_read(opemu_xslots.xmm);
+    preempt_enable();
+
+    return xmm;
+}
+
+/** Publish an image for code that is not a trap, preemption off until opemu_xfile_leave. **/
+static inline void opemu_xfile_enter(void *xmm)
+{
+#ifdef OPEMU_XFILE
+    __this_cpu_write(opemu_xslots.xmm, xmm);
+    __this_cpu_write(opemu_xslots.owner, current);
+#endif
+}
+
+static inline void opemu_xfile_leave(void)
+{
+#ifdef OPEMU_XFILE
+    __this_cpu_write(opemu_xslots.owner, NULL);
+#endif
+}
+
+#endif
+
+#endif /* xfile_h */